@@ -0,0 +1,226 @@
+/**
+ * frontend_stress - 文本前端并发一致性检查
+ *
+ * 多个线程共享同一个后端实例, 反复并发调用 textToTokenIds,
+ * 每次结果必须与单线程下的结果逐 token 相同。任一结果不一致时打印差异并返回 1。
+ *
+ * 用法:
+ *   frontend_stress [-b matcha-zh|matcha-en|matcha-zh-en|kokoro] [-m model_dir]
+ *                   [-n threads] [-r rounds] [-f corpus.txt]
+ *
+ *   -b  后端 (默认 matcha-zh); kokoro 只需 cpp-pinyin 词典, 不加载模型
+ *   -m  Matcha 模型目录 (默认 ~/.cache/matcha-tts)
+ *   -n  线程数 (默认 CPU 核数)
+ *   -r  每个线程遍历语料的轮数 (默认 50)
+ *   -f  语料文件, 每行一句 (默认使用内置中英混合语料)
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "internal/backends/kokoro/kokoro_phonemizer.hpp"
+#include "internal/backends/matcha/matcha_en_backend.hpp"
+#include "internal/backends/matcha/matcha_zh_backend.hpp"
+#include "internal/backends/matcha/matcha_zh_en_backend.hpp"
+
+using Frontend = std::function<std::vector<int64_t>(const std::string&)>;
+
+// 公开 Matcha 后端受保护的前端接口
+template <typename Backend>
+class FrontendProbe : public Backend {
+public:
+    using Backend::textToTokenIds;
+};
+
+static const std::vector<std::string> kDefaultCorpus = {
+    "今天天气很好，我们去公园散步吧。",
+    "会议定于2024年3月15日下午14:30在三楼会议室召开。",
+    "这台电脑的价格是¥8,999.00，比上个月便宜了12%。",
+    "请拨打客服电话400-123-4567，工作时间为9:00至18:00。",
+    "The quick brown fox jumps over the lazy dog.",
+    "We shipped 1,234 units in Q3, up 15% from last year.",
+    "我正在学习Machine Learning和Deep Learning。",
+    "他用iPhone 15拍了一张照片，然后发到了WeChat上。",
+    "第Ⅲ章讨论了重庆、长沙和厦门的方言差异。",
+    "银行行长说：“这笔钱还要还给还没还钱的人。”",
+};
+
+static bool loadCorpus(const std::string& path, std::vector<std::string>& corpus) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "无法打开语料: " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty()) {
+            corpus.push_back(line);
+        }
+    }
+    return !corpus.empty();
+}
+
+template <typename Backend>
+static std::shared_ptr<FrontendProbe<Backend>> createMatcha(const std::string& model_dir) {
+    auto backend = std::make_shared<FrontendProbe<Backend>>();
+    tts::TtsConfig config;
+    config.model_dir = model_dir;
+    config.enable_warmup = false;
+    auto err = backend->initialize(config);
+    if (!err.isOk()) {
+        std::cerr << "后端初始化失败: " << err.message << std::endl;
+        return nullptr;
+    }
+    return backend;
+}
+
+static Frontend createFrontend(const std::string& name, const std::string& model_dir) {
+    if (name == "kokoro") {
+        auto phonemizer = std::make_shared<tts::KokoroPhonemizer>();
+        try {
+            phonemizer->initPinyin();
+        } catch (const std::exception& e) {
+            std::cerr << "cpp-pinyin 初始化失败: " << e.what() << std::endl;
+            return nullptr;
+        }
+        return [phonemizer](const std::string& text) { return phonemizer->textToTokenIds(text); };
+    }
+    if (name == "matcha-zh") {
+        auto backend = createMatcha<tts::MatchaZhBackend>(model_dir);
+        if (!backend) return nullptr;
+        return [backend](const std::string& text) { return backend->textToTokenIds(text); };
+    }
+    if (name == "matcha-en") {
+        auto backend = createMatcha<tts::MatchaEnBackend>(model_dir);
+        if (!backend) return nullptr;
+        return [backend](const std::string& text) { return backend->textToTokenIds(text); };
+    }
+    if (name == "matcha-zh-en") {
+        auto backend = createMatcha<tts::MatchaZhEnBackend>(model_dir);
+        if (!backend) return nullptr;
+        return [backend](const std::string& text) { return backend->textToTokenIds(text); };
+    }
+    std::cerr << "未知后端: " << name << std::endl;
+    return nullptr;
+}
+
+static std::string formatTokens(const std::vector<int64_t>& tokens) {
+    std::string out = "[";
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        if (i > 0) out += ' ';
+        out += std::to_string(tokens[i]);
+    }
+    return out + "]";
+}
+
+static void printUsage(const char* prog) {
+    std::cerr << "用法: " << prog
+              << " [-b matcha-zh|matcha-en|matcha-zh-en|kokoro] [-m model_dir]"
+                 " [-n threads] [-r rounds] [-f corpus.txt]" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::string backend_name = "matcha-zh";
+    std::string model_dir;
+    std::string corpus_path;
+    int num_threads = static_cast<int>(std::thread::hardware_concurrency());
+    int rounds = 50;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(arg, "-b") == 0 && has_value) {
+            backend_name = argv[++i];
+        } else if (std::strcmp(arg, "-m") == 0 && has_value) {
+            model_dir = argv[++i];
+        } else if (std::strcmp(arg, "-n") == 0 && has_value) {
+            num_threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "-r") == 0 && has_value) {
+            rounds = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "-f") == 0 && has_value) {
+            corpus_path = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+    if (num_threads < 2) num_threads = 2;
+    if (rounds < 1) rounds = 1;
+
+    std::vector<std::string> corpus;
+    if (corpus_path.empty()) {
+        corpus = kDefaultCorpus;
+    } else if (!loadCorpus(corpus_path, corpus)) {
+        return 2;
+    }
+
+    Frontend frontend = createFrontend(backend_name, model_dir);
+    if (!frontend) {
+        return 2;
+    }
+
+    // 单线程参考结果
+    std::vector<std::vector<int64_t>> expected;
+    expected.reserve(corpus.size());
+    for (const auto& text : corpus) {
+        expected.push_back(frontend(text));
+    }
+
+    std::atomic<size_t> calls{0};
+    std::atomic<size_t> mismatches{0};
+    std::mutex report_mutex;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int round = 0; round < rounds; ++round) {
+                // 各线程从不同位置开始, 同一时刻处理不同的句子
+                for (size_t k = 0; k < corpus.size(); ++k) {
+                    size_t index = (k + static_cast<size_t>(t)) % corpus.size();
+                    std::vector<int64_t> actual = frontend(corpus[index]);
+                    calls++;
+                    if (actual == expected[index]) {
+                        continue;
+                    }
+                    if (mismatches++ < 5) {
+                        std::lock_guard<std::mutex> lock(report_mutex);
+                        std::cerr << "MISMATCH thread " << t << " round " << round
+                                  << ": \"" << corpus[index] << "\"\n"
+                                  << "  expected: " << formatTokens(expected[index]) << "\n"
+                                  << "  actual:   " << formatTokens(actual) << std::endl;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << backend_name << ": " << num_threads << " threads, " << calls.load() << " calls in "
+              << seconds << " s (" << (seconds > 0 ? calls.load() / seconds : 0.0) << " calls/s)"
+              << std::endl;
+    if (mismatches.load() > 0) {
+        std::cerr << mismatches.load() << " results differ from single-threaded output" << std::endl;
+        return 1;
+    }
+    std::cout << "All results match single-threaded output" << std::endl;
+    return 0;
+}
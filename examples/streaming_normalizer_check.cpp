@@ -0,0 +1,91 @@
+/**
+ * streaming_normalizer_check - 增量文本规范化一致性检查
+ *
+ * 对每条用例, 在所有可能的位置把文本切成两段 (以及逐字节输入) 送入
+ * StreamingTextNormalizer, 拼接的输出必须与整段 TextNormalizer::normalize 相同。
+ * 任一用例不一致时打印差异并返回 1。
+ *
+ * 用法: streaming_normalizer_check
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "internal/text/text_normalizer.hpp"
+
+using tts::text::Language;
+using tts::text::StreamingTextNormalizer;
+using tts::text::TextNormalizer;
+
+static const std::vector<std::string> kCases = {
+    // 数字、日期、时间、单位、货币被切开
+    "价格是3.14元",
+    "会议在2024年3月15日14:30开始",
+    "速度为120km/h",
+    "共计$1,234.56",
+    "温度是-5度",
+    // 数字的语言取决于左侧已输出的文本
+    "The total is 42.",
+    "We sold 3 of 12 units",
+    "总数是42。",
+    // 减号与负号取决于左侧字符
+    "x-5",
+    "a - -3",
+    "计算(-5)+2",
+};
+
+static std::string streamed(const std::vector<std::string>& fragments) {
+    StreamingTextNormalizer normalizer;
+    std::string output;
+    for (const auto& fragment : fragments) {
+        output += normalizer.push(fragment);
+    }
+    return output + normalizer.flush();
+}
+
+static bool check(const std::string& text, const std::vector<std::string>& fragments,
+                  const std::string& expected) {
+    std::string actual = streamed(fragments);
+    if (actual == expected) {
+        return true;
+    }
+    std::cerr << "MISMATCH \"" << text << "\" split as";
+    for (const auto& fragment : fragments) {
+        std::cerr << " [" << fragment << "]";
+    }
+    std::cerr << "\n  expected: " << expected << "\n  actual:   " << actual << std::endl;
+    return false;
+}
+
+int main() {
+    TextNormalizer normalizer;
+    int failures = 0;
+
+    for (const auto& text : kCases) {
+        const std::string expected = normalizer.normalize(text, Language::AUTO);
+
+        // 任意两段切分 (含切在 UTF-8 字符中间)
+        for (size_t cut = 0; cut <= text.size(); ++cut) {
+            if (!check(text, {text.substr(0, cut), text.substr(cut)}, expected)) {
+                ++failures;
+            }
+        }
+
+        // 逐字节输入
+        std::vector<std::string> bytes;
+        for (char c : text) {
+            bytes.emplace_back(1, c);
+        }
+        if (!check(text, bytes, expected)) {
+            ++failures;
+        }
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " mismatches" << std::endl;
+        return 1;
+    }
+    std::cout << "All " << kCases.size() << " cases match whole-string normalization" << std::endl;
+    return 0;
+}
@@ -0,0 +1,674 @@
+/**
+ * tts_batch - 批量语料合成工具
+ *
+ * 读取清单 (TSV / JSONL)，在多个引擎实例间分片合成，逐条写出音频文件。
+ *
+ * 清单格式:
+ *   TSV:   id<TAB>text[<TAB>speed=1.1,speaker=2]
+ *   JSONL: {"id": "0001", "text": "你好世界", "speed": 1.1, "speaker": 2}
+ *
+ * 特性:
+ *   - 按文本长度排序后分组，工作线程按组领取任务 (长文本优先，减少尾部等待);
+ *     每组经 CallMany 一次批量推理 (语速/说话人不同的条目分开提交)
+ *   - 每个工作线程独占一个引擎实例，-t 控制每个实例的推理线程数
+ *   - 音频先写入 .part 临时文件，完成后重命名，并追加到检查点文件;
+ *     中断后重新运行同一命令会跳过已完成条目
+ *   - 定期打印吞吐 (字/s, 音频秒/s) 与预计剩余时间
+ */
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "internal/text/text_utils.hpp"
+#include "tts_api.hpp"
+#include "tts_sink.hpp"
+
+// =============================================================================
+// 清单
+// =============================================================================
+
+struct BatchItem {
+    std::string id;
+    std::string text;
+    float speed = 0.0f;         // 0 = 使用默认语速
+    int speaker = -1;           // -1 = 使用默认说话人
+    size_t num_chars = 0;       // UTF-8 字符数
+};
+
+
+static std::string trim(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin, end - begin + 1);
+}
+
+// 解析 "speed=1.1,speaker=2"
+static void parseOptions(const std::string& options, BatchItem& item) {
+    size_t pos = 0;
+    while (pos < options.size()) {
+        size_t end = options.find_first_of(",;", pos);
+        if (end == std::string::npos) {
+            end = options.size();
+        }
+        std::string pair = options.substr(pos, end - pos);
+        size_t eq = pair.find('=');
+        if (eq != std::string::npos) {
+            std::string key = trim(pair.substr(0, eq));
+            std::string value = trim(pair.substr(eq + 1));
+            try {
+                if (key == "speed") {
+                    item.speed = std::stof(value);
+                } else if (key == "speaker" || key == "speaker_id") {
+                    item.speaker = std::stoi(value);
+                }
+            } catch (const std::exception&) {
+                // 忽略无效选项
+            }
+        }
+        pos = end + 1;
+    }
+}
+
+static bool parseTsvLine(const std::string& line, BatchItem& item) {
+    size_t tab1 = line.find('\t');
+    if (tab1 == std::string::npos) {
+        return false;
+    }
+    size_t tab2 = line.find('\t', tab1 + 1);
+
+    item.id = trim(line.substr(0, tab1));
+    item.text = trim(line.substr(tab1 + 1,
+        tab2 == std::string::npos ? std::string::npos : tab2 - tab1 - 1));
+    if (tab2 != std::string::npos) {
+        parseOptions(line.substr(tab2 + 1), item);
+    }
+    return !item.id.empty() && !item.text.empty();
+}
+
+static void appendUtf8(std::string& out, uint32_t cp) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+/**
+ * 单层 JSON 对象解析 (仅支持字符串 / 数字 / 布尔值)，足以读取清单行
+ */
+class JsonLineParser {
+public:
+    explicit JsonLineParser(const std::string& line) : s_(line) {}
+
+    bool parse(BatchItem& item) {
+        skipSpace();
+        if (!consume('{')) return false;
+        skipSpace();
+        if (consume('}')) return false;
+
+        while (true) {
+            std::string key;
+            std::string value;
+            skipSpace();
+            if (!parseString(key)) return false;
+            skipSpace();
+            if (!consume(':')) return false;
+            skipSpace();
+            if (!parseValue(value)) return false;
+
+            try {
+                if (key == "id") {
+                    item.id = value;
+                } else if (key == "text") {
+                    item.text = value;
+                } else if (key == "speed") {
+                    item.speed = std::stof(value);
+                } else if (key == "speaker" || key == "speaker_id") {
+                    item.speaker = std::stoi(value);
+                }
+            } catch (const std::exception&) {
+                return false;
+            }
+
+            skipSpace();
+            if (consume(',')) continue;
+            if (consume('}')) break;
+            return false;
+        }
+        return !item.id.empty() && !item.text.empty();
+    }
+
+private:
+    void skipSpace() {
+        while (pos_ < s_.size() && std::isspace(static_cast<unsigned char>(s_[pos_]))) pos_++;
+    }
+
+    bool consume(char c) {
+        if (pos_ < s_.size() && s_[pos_] == c) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    bool parseHex4(uint32_t& value) {
+        if (pos_ + 4 > s_.size()) return false;
+        value = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = s_[pos_++];
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= c - '0';
+            else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+            else return false;
+        }
+        return true;
+    }
+
+    bool parseString(std::string& out) {
+        if (!consume('"')) return false;
+        while (pos_ < s_.size()) {
+            char c = s_[pos_++];
+            if (c == '"') return true;
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (pos_ >= s_.size()) return false;
+            char e = s_[pos_++];
+            switch (e) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'u': {
+                    uint32_t cp;
+                    if (!parseHex4(cp)) return false;
+                    // UTF-16 代理对
+                    if (cp >= 0xD800 && cp <= 0xDBFF && pos_ + 1 < s_.size() &&
+                        s_[pos_] == '\\' && s_[pos_ + 1] == 'u') {
+                        pos_ += 2;
+                        uint32_t low;
+                        if (!parseHex4(low)) return false;
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(out, cp);
+                    break;
+                }
+                default: out += e; break;
+            }
+        }
+        return false;
+    }
+
+    bool parseValue(std::string& out) {
+        if (pos_ < s_.size() && s_[pos_] == '"') {
+            return parseString(out);
+        }
+        size_t start = pos_;
+        while (pos_ < s_.size() && s_[pos_] != ',' && s_[pos_] != '}' &&
+               !std::isspace(static_cast<unsigned char>(s_[pos_]))) {
+            pos_++;
+        }
+        out = s_.substr(start, pos_ - start);
+        return !out.empty();
+    }
+
+    const std::string& s_;
+    size_t pos_ = 0;
+};
+
+static bool endsWith(const std::string& s, const std::string& suffix) {
+    return s.size() >= suffix.size() &&
+        s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static bool loadManifest(const std::string& path, std::vector<BatchItem>& items) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "无法打开清单: " << path << std::endl;
+        return false;
+    }
+
+    bool is_jsonl = endsWith(path, ".jsonl") || endsWith(path, ".json");
+    std::unordered_set<std::string> seen;
+    std::string line;
+    size_t line_no = 0;
+    while (std::getline(file, line)) {
+        line_no++;
+        std::string trimmed = trim(line);
+        if (trimmed.empty() || trimmed[0] == '#') {
+            continue;
+        }
+
+        BatchItem item;
+        bool ok = is_jsonl ? JsonLineParser(trimmed).parse(item) : parseTsvLine(line, item);
+        if (!ok) {
+            std::cerr << "清单第 " << line_no << " 行格式错误, 已跳过" << std::endl;
+            continue;
+        }
+        if (!seen.insert(item.id).second) {
+            std::cerr << "清单第 " << line_no << " 行 id 重复: " << item.id << ", 已跳过" << std::endl;
+            continue;
+        }
+        item.num_chars = tts::text::utf8Length(item.text);
+        items.push_back(std::move(item));
+    }
+    return true;
+}
+
+// id -> 文件名 (替换路径分隔符等不安全字符)
+static std::string safeFileName(const std::string& id) {
+    std::string name = id;
+    for (char& c : name) {
+        if (c == '/' || c == '\\' || c == ':' || c == '\0') {
+            c = '_';
+        }
+    }
+    return name;
+}
+
+// =============================================================================
+// 检查点
+// =============================================================================
+
+static std::unordered_set<std::string> loadCheckpoint(const std::string& path) {
+    std::unordered_set<std::string> done;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty()) {
+            done.insert(line);
+        }
+    }
+    return done;
+}
+
+/// 追加写入已完成的 id (每条立即刷新, 中断时最多丢失正在写入的一条)
+class CheckpointWriter {
+public:
+    bool open(const std::string& path) {
+        file_.open(path, std::ios::app);
+        return file_.good();
+    }
+
+    void markDone(const std::string& id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        file_ << id << '\n';
+        file_.flush();
+    }
+
+private:
+    std::mutex mutex_;
+    std::ofstream file_;
+};
+
+// =============================================================================
+// 进度统计
+// =============================================================================
+
+struct Progress {
+    size_t total_items = 0;
+    size_t total_chars = 0;
+    std::atomic<size_t> done_items{0};
+    std::atomic<size_t> failed_items{0};
+    std::atomic<size_t> done_chars{0};
+    std::atomic<int64_t> audio_ms{0};
+    std::chrono::steady_clock::time_point start_time;
+};
+
+static std::string formatDuration(double seconds) {
+    if (seconds < 0 || seconds > 1e7) {
+        return "--:--:--";
+    }
+    int total = static_cast<int>(seconds + 0.5);
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%02d:%02d:%02d", total / 3600, (total / 60) % 60, total % 60);
+    return buf;
+}
+
+static void printProgress(const Progress& p, bool final_report) {
+    double elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - p.start_time).count();
+    size_t done = p.done_items.load();
+    size_t failed = p.failed_items.load();
+    size_t chars = p.done_chars.load();
+    double audio_s = p.audio_ms.load() / 1000.0;
+
+    double chars_per_s = elapsed > 0 ? chars / elapsed : 0.0;
+    double audio_per_s = elapsed > 0 ? audio_s / elapsed : 0.0;
+    double eta = chars_per_s > 0 ? (p.total_chars - chars) / chars_per_s : -1.0;
+
+    char line[256];
+    std::snprintf(line, sizeof(line),
+        "%s %zu/%zu (%.1f%%) 失败 %zu | %.1f 字/s | %.2f 音频s/s | 已用 %s | 剩余 %s",
+        final_report ? "[完成]" : "[进度]",
+        done + failed, p.total_items,
+        p.total_items > 0 ? 100.0 * (done + failed) / p.total_items : 100.0,
+        failed, chars_per_s, audio_per_s,
+        formatDuration(elapsed).c_str(),
+        final_report ? "00:00:00" : formatDuration(eta).c_str());
+    std::cout << line << std::endl;
+}
+
+// =============================================================================
+// 工作线程
+// =============================================================================
+
+enum class OutputFormat { WAV, PCM };
+
+struct BatchOptions {
+    Evo::TtsConfig engine_config;
+    std::string output_dir = "batch_out";
+    OutputFormat format = OutputFormat::WAV;
+};
+
+/// 把一条合成结果写入 .part 文件, 成功后重命名为最终文件
+static bool saveResult(const BatchOptions& options, const BatchItem& item,
+                       const Evo::TtsEngineResult& result, std::string& error) {
+    if (!result.IsSuccess()) {
+        error = result.GetMessage();
+        return false;
+    }
+
+    const std::string ext = options.format == OutputFormat::WAV ? ".wav" : ".pcm";
+    const std::string final_path = options.output_dir + "/" + safeFileName(item.id) + ext;
+    const std::string part_path = final_path + ".part";
+
+    std::unique_ptr<Evo::AudioSink> sink;
+    if (options.format == OutputFormat::WAV) {
+        sink = std::make_unique<Evo::WavFileSink>(part_path);
+    } else {
+        sink = std::make_unique<Evo::PcmFileSink>(part_path);
+    }
+    const auto& audio = result.GetAudioFloatRef();
+    bool ok = sink->Open(result.GetSampleRate()) &&
+              sink->Write(audio.data(), audio.size());
+    ok = sink->Close() && ok;
+    sink.reset();
+
+    if (!ok || std::rename(part_path.c_str(), final_path.c_str()) != 0) {
+        std::remove(part_path.c_str());
+        error = "无法保存";
+        return false;
+    }
+    return true;
+}
+
+static void runWorker(int worker_index,
+                      const BatchOptions& options,
+                      const std::vector<BatchItem>& items,
+                      const std::vector<std::pair<size_t, size_t>>& batches,
+                      std::atomic<size_t>& next_batch,
+                      CheckpointWriter& checkpoint,
+                      Progress& progress) {
+    Evo::TtsEngine engine(options.engine_config);
+    if (!engine.IsInitialized()) {
+        std::cerr << "[worker " << worker_index << "] 引擎初始化失败" << std::endl;
+        return;
+    }
+
+    const float default_speed = options.engine_config.speech_rate;
+    const int default_speaker = options.engine_config.speaker_id;
+    float current_speed = default_speed;
+    int current_speaker = default_speaker;
+
+    while (true) {
+        size_t batch_index = next_batch.fetch_add(1);
+        if (batch_index >= batches.size()) {
+            break;
+        }
+
+        // 组内语速/说话人相同的连续条目一次 CallMany, 由引擎做批量推理
+        size_t begin = batches[batch_index].first;
+        const size_t end = batches[batch_index].second;
+        while (begin < end) {
+            const float speed = items[begin].speed > 0.0f ? items[begin].speed : default_speed;
+            const int speaker = items[begin].speaker >= 0 ? items[begin].speaker : default_speaker;
+            size_t run_end = begin;
+            std::vector<std::string> texts;
+            while (run_end < end &&
+                   (items[run_end].speed > 0.0f ? items[run_end].speed : default_speed) == speed &&
+                   (items[run_end].speaker >= 0 ? items[run_end].speaker : default_speaker) == speaker) {
+                texts.push_back(items[run_end++].text);
+            }
+
+            if (speed != current_speed) {
+                engine.SetSpeed(speed);
+                current_speed = speed;
+            }
+            if (speaker != current_speaker) {
+                engine.SetSpeaker(speaker);
+                current_speaker = speaker;
+            }
+
+            engine.CallMany(texts, [&](size_t index, std::shared_ptr<Evo::TtsEngineResult> result) {
+                const BatchItem& item = items[begin + index];
+                std::string error;
+                if (saveResult(options, item, *result, error)) {
+                    checkpoint.markDone(item.id);
+                    progress.done_items.fetch_add(1);
+                    progress.audio_ms.fetch_add(result->GetDurationMs());
+                } else {
+                    progress.failed_items.fetch_add(1);
+                    std::cerr << "[worker " << worker_index << "] " << item.id << " 失败: "
+                              << error << std::endl;
+                }
+                progress.done_chars.fetch_add(item.num_chars);
+            }, 1);
+            begin = run_end;
+        }
+    }
+}
+
+// =============================================================================
+// 命令行
+// =============================================================================
+
+void printUsage(const char* program) {
+    std::cout << "用法: " << program << " -i <清单> [选项]\n"
+        << "\n"
+        << "选项:\n"
+        << "  -i <file>      清单文件 (.tsv: id<TAB>text[<TAB>speed=..,speaker=..]; .jsonl)\n"
+        << "  -o <dir>       输出目录 (默认: batch_out, 需已存在)\n"
+        << "  -l <engine>    引擎 (matcha:zh, matcha:en, matcha:zh-en, kokoro[:voice], 默认: matcha:zh)\n"
+        << "  -j <engines>   并行引擎实例数 (默认: 1)\n"
+        << "  -t <threads>   每个实例的推理线程数 (默认: CPU 核数 / 实例数)\n"
+        << "  -b <size>      每组条目数, 工作线程按组领取任务, 每组一次批量推理 (默认: 16)\n"
+        << "  -f <format>    输出格式 wav|pcm (默认: wav)\n"
+        << "  -s <speed>     默认语速 (默认: 1.0)\n"
+        << "  -c <file>      检查点文件 (默认: <输出目录>/.tts_batch.done)\n"
+        << "  --restart      忽略检查点, 全部重新合成\n"
+        << "  -h             显示帮助\n"
+        << "\n"
+        << "示例:\n"
+        << "  " << program << " -i prompts.tsv -o out -j 4\n"
+        << "  " << program << " -i chapters.jsonl -o book -l kokoro:zf_xiaobei -j 2 -t 2\n"
+        << std::endl;
+}
+
+Evo::TtsConfig parseEngine(const std::string& spec) {
+    if (spec == "matcha:en") return Evo::TtsConfig::MatchaEN();
+    if (spec == "matcha:zh-en" || spec == "matcha:zhen") return Evo::TtsConfig::MatchaZHEN();
+    if (spec.rfind("kokoro", 0) == 0) {
+        auto config = Evo::TtsConfig::Kokoro();
+        auto colon = spec.find(':');
+        if (colon != std::string::npos) {
+            config.voice = spec.substr(colon + 1);
+        }
+        return config;
+    }
+    return Evo::TtsConfig::MatchaZH();
+}
+
+int main(int argc, char* argv[]) {
+    std::string manifest_path;
+    std::string engine_spec = "matcha:zh";
+    std::string checkpoint_path;
+    int num_engines = 1;
+    int threads_per_engine = 0;
+    size_t batch_size = 16;
+    float speed = 1.0f;
+    bool restart = false;
+    BatchOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        } else if (strcmp(argv[i], "--restart") == 0) {
+            restart = true;
+        } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+            manifest_path = argv[++i];
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            options.output_dir = argv[++i];
+        } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            engine_spec = argv[++i];
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            num_engines = std::max(1, std::stoi(argv[++i]));
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            threads_per_engine = std::stoi(argv[++i]);
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            batch_size = static_cast<size_t>(std::max(1, std::stoi(argv[++i])));
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            std::string format = argv[++i];
+            options.format = format == "pcm" ? OutputFormat::PCM : OutputFormat::WAV;
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            speed = std::stof(argv[++i]);
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            checkpoint_path = argv[++i];
+        }
+    }
+
+    if (manifest_path.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (checkpoint_path.empty()) {
+        checkpoint_path = options.output_dir + "/.tts_batch.done";
+    }
+    if (threads_per_engine <= 0) {
+        int cores = static_cast<int>(std::thread::hardware_concurrency());
+        threads_per_engine = std::max(1, (cores > 0 ? cores : 2) / num_engines);
+    }
+
+    options.engine_config = parseEngine(engine_spec);
+    options.engine_config.speech_rate = speed;
+    options.engine_config.num_threads = threads_per_engine;
+    options.engine_config.max_batch_size = static_cast<int>(batch_size);
+
+    // 读取清单并跳过已完成条目
+    std::vector<BatchItem> all_items;
+    if (!loadManifest(manifest_path, all_items)) {
+        return 1;
+    }
+    if (restart) {
+        std::remove(checkpoint_path.c_str());
+    }
+    auto done_ids = loadCheckpoint(checkpoint_path);
+
+    std::vector<BatchItem> items;
+    for (auto& item : all_items) {
+        if (!done_ids.count(item.id)) {
+            items.push_back(std::move(item));
+        }
+    }
+    std::cout << "清单: " << all_items.size() << " 条, 已完成: "
+              << (all_items.size() - items.size()) << " 条, 待合成: " << items.size() << " 条"
+              << std::endl;
+    if (items.empty()) {
+        return 0;
+    }
+
+    CheckpointWriter checkpoint;
+    if (!checkpoint.open(checkpoint_path)) {
+        std::cerr << "无法写入检查点 (输出目录是否存在?): " << checkpoint_path << std::endl;
+        return 1;
+    }
+
+    // 按长度降序排序后分组: 相近长度的条目在一起, 长文本优先调度避免尾部拖延
+    std::stable_sort(items.begin(), items.end(), [](const BatchItem& a, const BatchItem& b) {
+        return a.num_chars > b.num_chars;
+    });
+    std::vector<std::pair<size_t, size_t>> batches;
+    for (size_t begin = 0; begin < items.size(); begin += batch_size) {
+        batches.emplace_back(begin, std::min(begin + batch_size, items.size()));
+    }
+
+    Progress progress;
+    progress.total_items = items.size();
+    for (const auto& item : items) {
+        progress.total_chars += item.num_chars;
+    }
+    progress.start_time = std::chrono::steady_clock::now();
+
+    std::cout << "引擎: " << engine_spec << " x " << num_engines
+              << ", 每实例线程: " << threads_per_engine
+              << ", 分组: " << batches.size() << " x " << batch_size << std::endl;
+
+    std::atomic<size_t> next_batch{0};
+    std::atomic<int> running{num_engines};
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < num_engines; ++w) {
+        workers.emplace_back([&, w]() {
+            runWorker(w, options, items, batches, next_batch, checkpoint, progress);
+            {
+                std::lock_guard<std::mutex> lock(done_mutex);
+                running.fetch_sub(1);
+            }
+            done_cv.notify_all();
+        });
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        while (!done_cv.wait_for(lock, std::chrono::seconds(5),
+                                 [&]() { return running.load() == 0; })) {
+            printProgress(progress, false);
+        }
+    }
+    for (auto& t : workers) {
+        t.join();
+    }
+
+    printProgress(progress, true);
+
+    size_t unfinished = progress.total_items - progress.done_items.load();
+    if (unfinished > 0) {
+        std::cerr << unfinished << " 条未完成, 重新运行同一命令可继续" << std::endl;
+        return 1;
+    }
+    return 0;
+}
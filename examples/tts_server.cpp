@@ -0,0 +1,179 @@
+#include <signal.h>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "tts_api.hpp"
+#include "tts_server.hpp"
+
+static Evo::TtsWorkerPool* g_pool = nullptr;
+
+static void handleSignal(int) {
+    if (g_pool) {
+        g_pool->Stop();
+    }
+}
+
+void printUsage(const char* program) {
+    std::cout << "用法: " << program << " [选项]\n"
+        << "\n"
+        << "服务端选项:\n"
+        << "  -l <engine>    引擎 (matcha:zh, matcha:en, matcha:zh-en, kokoro, 默认: matcha:zh)\n"
+        << "  -n <workers>   工作进程数 (默认: CPU 核数)\n"
+        << "  -S <socket>    Unix 套接字路径 (默认: /tmp/evo_tts.sock)\n"
+        << "\n"
+        << "客户端选项:\n"
+        << "  -p <text>      连接已运行的服务并合成文本\n"
+        << "  -o <file>      输出文件 (默认: output.wav)\n"
+        << "  -s <speed>     语速倍率 (默认: 服务端配置)\n"
+        << "  --shm          通过共享内存流接收音频 (仅 Linux)\n"
+        << "  --stats        打印各工作进程统计\n"
+        << "  -h             显示帮助\n"
+        << "\n"
+        << "示例:\n"
+        << "  " << program << " -l matcha:zh -n 4            # 启动服务\n"
+        << "  " << program << " -p \"你好世界\" -o hello.wav    # 客户端合成\n"
+        << "  " << program << " --stats                      # 查看统计\n"
+        << std::endl;
+}
+
+Evo::TtsConfig parseEngine(const std::string& spec) {
+    if (spec == "matcha:en") return Evo::TtsConfig::MatchaEN();
+    if (spec == "matcha:zh-en" || spec == "matcha:zhen") return Evo::TtsConfig::MatchaZHEN();
+    if (spec.rfind("kokoro", 0) == 0) {
+        auto config = Evo::TtsConfig::Kokoro();
+        auto colon = spec.find(':');
+        if (colon != std::string::npos) {
+            config.voice = spec.substr(colon + 1);
+        }
+        return config;
+    }
+    return Evo::TtsConfig::MatchaZH();
+}
+
+int runClient(const std::string& socket_path, const std::string& text,
+              const std::string& output_file, float speed) {
+    Evo::TtsClient client(socket_path);
+    auto result = client.Call(text, speed);
+    if (!result || !result->IsSuccess()) {
+        std::cerr << "合成失败: " << (result ? result->GetMessage() : "") << std::endl;
+        return 1;
+    }
+
+    std::cout << "采样率: " << result->GetSampleRate() << " Hz" << std::endl;
+    std::cout << "时长: " << result->GetDurationMs() << " ms" << std::endl;
+    std::cout << "服务端处理时间: " << result->GetProcessingTimeMs() << " ms" << std::endl;
+
+    if (!result->SaveToFile(output_file)) {
+        std::cerr << "保存失败: " << output_file << std::endl;
+        return 1;
+    }
+    std::cout << "已保存: " << output_file << std::endl;
+    return 0;
+}
+
+int runStreamClient(const std::string& socket_path, const std::string& text, float speed) {
+    Evo::TtsClient client(socket_path);
+    auto stream = client.CallStream(text, speed);
+    if (!stream) {
+        std::cerr << "无法建立共享内存流: " << socket_path << std::endl;
+        return 1;
+    }
+
+    // 逐块读取, 模拟播放端零拷贝消费
+    const float* samples = nullptr;
+    size_t n;
+    size_t chunks = 0;
+    size_t total = 0;
+    while ((n = stream->Read(&samples)) > 0) {
+        chunks++;
+        total += n;
+        stream->Consume(n);
+    }
+    if (!stream->IsSuccess()) {
+        std::cerr << "合成失败: " << stream->GetMessage() << std::endl;
+        return 1;
+    }
+
+    std::cout << "采样率: " << stream->GetSampleRate() << " Hz" << std::endl;
+    std::cout << "音频块: " << chunks << ", 样本数: " << total << std::endl;
+    return 0;
+}
+
+int runStats(const std::string& socket_path) {
+    Evo::TtsClient client(socket_path);
+    auto stats = client.GetWorkerStats();
+    if (stats.empty()) {
+        std::cerr << "无法获取统计: " << socket_path << std::endl;
+        return 1;
+    }
+
+    std::cout << "worker  pid      alive  restarts  requests  failures  audio_ms  busy_ms  text_bytes" << std::endl;
+    for (const auto& s : stats) {
+        std::cout << s.index << "\t" << s.pid << "\t " << (s.alive ? "yes" : "no")
+                  << "\t" << s.restarts << "\t  " << s.requests << "\t    " << s.failures
+                  << "\t      " << s.audio_ms << "\t" << s.busy_ms << "\t " << s.text_bytes
+                  << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    std::string engine_spec = "matcha:zh";
+    std::string text;
+    std::string output_file = "output.wav";
+    float speed = 0.0f;
+    bool show_stats = false;
+    bool use_shm = false;
+    Evo::WorkerPoolConfig pool_config;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            show_stats = true;
+        } else if (strcmp(argv[i], "--shm") == 0) {
+            use_shm = true;
+        } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            engine_spec = argv[++i];
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            pool_config.num_workers = std::stoi(argv[++i]);
+        } else if (strcmp(argv[i], "-S") == 0 && i + 1 < argc) {
+            pool_config.socket_path = argv[++i];
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            text = argv[++i];
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output_file = argv[++i];
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            speed = std::stof(argv[++i]);
+        }
+    }
+
+    if (show_stats) {
+        return runStats(pool_config.socket_path);
+    }
+    if (!text.empty() && use_shm) {
+        return runStreamClient(pool_config.socket_path, text, speed);
+    }
+    if (!text.empty()) {
+        return runClient(pool_config.socket_path, text, output_file, speed);
+    }
+
+    // 服务端模式
+    Evo::TtsWorkerPool pool(parseEngine(engine_spec), pool_config);
+    g_pool = &pool;
+    signal(SIGINT, handleSignal);
+    signal(SIGTERM, handleSignal);
+
+    std::cout << "初始化 TTS 服务 (" << engine_spec << ")..." << std::endl;
+    if (!pool.Start()) {
+        std::cerr << "服务启动失败!" << std::endl;
+        return 1;
+    }
+
+    pool.Run();
+    std::cout << "服务已停止" << std::endl;
+    return 0;
+}
@@ -7,6 +7,7 @@
  * 提供音频归一化、动态压缩、去爆音等功能。
  */
 
+#include <cstddef>
 #include <cstdint>
 
 #include <vector>
@@ -30,12 +31,35 @@ struct AudioProcessConfig {
     // 去爆音
     bool remove_clicks = true;          ///< 是否移除爆音
 
+    // 静音裁剪 (基于帧能量)
+    bool trim_silence = true;           ///< 是否裁剪首尾静音
+    float silence_threshold_db = -50.0f;  ///< 静音判定阈值 (帧 RMS, dBFS)
+    int silence_frame_ms = 10;          ///< 能量检测帧长 (毫秒)
+    int silence_keep_ms = 30;           ///< 语音边界外保留的余量 (毫秒), 避免切掉弱辅音
+
+    // 句间间隔
+    int sentence_gap_ms = 150;          ///< 句间插入的静音 (毫秒), 0=不插入
+
+    int sample_rate = 22050;            ///< 采样率 (用于毫秒换算)
+
     // 默认配置
     static AudioProcessConfig Default() {
         return AudioProcessConfig();
     }
 };
 
+/**
+ * @brief 音频块在整段合成中的位置
+ *
+ * 流式 / 分句合成时，同一句可能分多块输出: 仅在句首块裁剪前导静音、句尾块裁剪
+ * 尾部静音，并只在非最后一句的句尾追加句间间隔。默认值表示整句一次性处理。
+ */
+struct ChunkPosition {
+    bool segment_start = true;          ///< 句子的第一块: 裁剪前导静音
+    bool segment_end = true;            ///< 句子的最后一块: 裁剪尾部静音
+    bool last_segment = true;           ///< 最后一句: 不追加句间间隔
+};
+
 // =============================================================================
 // 音频处理函数
 // =============================================================================
@@ -93,17 +117,85 @@ std::vector<float> resampleAudio(
         int src_rate,
         int dst_rate);
 
+/**
+ * @brief 查找语音起点 (第一个能量超过阈值的帧, 减去保留余量)
+ * @param audio 音频样本
+ * @param num_samples 样本数
+ * @param config 处理配置
+ * @return 起点样本下标; 全部为静音时返回 num_samples
+ */
+size_t findSpeechStart(const float* audio, size_t num_samples,
+                       const AudioProcessConfig& config);
+
+/**
+ * @brief 查找语音终点 (最后一个能量超过阈值的帧, 加上保留余量)
+ * @param audio 音频样本
+ * @param num_samples 样本数
+ * @param config 处理配置
+ * @return 终点样本下标 (不含); 全部为静音时返回 0
+ */
+size_t findSpeechEnd(const float* audio, size_t num_samples,
+                     const AudioProcessConfig& config);
+
+/**
+ * @brief 裁剪首尾静音
+ * @param audio 输入音频
+ * @param config 处理配置
+ * @param trim_leading 是否裁剪前导静音
+ * @param trim_trailing 是否裁剪尾部静音
+ * @return 裁剪后的音频
+ */
+std::vector<float> trimSilence(const std::vector<float>& audio,
+                               const AudioProcessConfig& config,
+                               bool trim_leading = true,
+                               bool trim_trailing = true);
+
 /**
  * @brief 完整的音频后处理流程
  *
- * 依次执行：归一化 -> 去爆音 (可选)
+ * 依次执行：静音裁剪 (可选) -> 归一化 -> 去爆音 (可选) -> 句间间隔 (可选)
+ *
+ * 裁剪只确定语音区间，归一化直接在该区间上进行，RMS 不会被静音段拉低。
  *
  * @param audio 输入音频
  * @param config 处理配置
+ * @param position 音频块位置 (决定裁剪哪一端、是否追加间隔)
  * @return 处理后的音频
  */
 std::vector<float> processAudio(const std::vector<float>& audio,
-                                const AudioProcessConfig& config);
+                                const AudioProcessConfig& config,
+                                const ChunkPosition& position = ChunkPosition());
+
+// =============================================================================
+// 流式后处理
+// =============================================================================
+
+/**
+ * @brief 逐块后处理同一句的音频 (流式合成)
+ *
+ * 与 processAudio 相同的处理步骤，但各块之间保持连续:
+ * - 归一化增益由句首块确定，后续块沿用，避免块间音量跳变
+ * - 高通滤波器状态跨块保持；淡入只作用于句首块，淡出只作用于句尾块
+ * - 前导静音只在句首块裁剪，尾部静音只在句尾块裁剪
+ */
+class StreamingAudioProcessor {
+public:
+    explicit StreamingAudioProcessor(const AudioProcessConfig& config);
+
+    /// @brief 处理一块音频
+    /// @param audio 输入音频块
+    /// @param position 块位置 (segment_start 时重置句内状态)
+    /// @return 处理后的音频块
+    std::vector<float> process(const std::vector<float>& audio, const ChunkPosition& position);
+
+private:
+    AudioProcessConfig config_;
+    float gain_ = 1.0f;
+    bool gain_fixed_ = false;
+    bool speech_started_ = false;
+    float hp_prev_input_ = 0.0f;
+    float hp_prev_output_ = 0.0f;
+};
 
 // =============================================================================
 // 格式转换
@@ -9,9 +9,11 @@
 #include <string>
 #include <vector>
 
+#include "internal/audio/audio_processor.hpp"
 #include "internal/backends/kokoro/kokoro_phonemizer.hpp"
 #include "internal/backends/kokoro/kokoro_voice_manager.hpp"
 #include "internal/backends/tts_backend.hpp"
+#include "internal/tts_ort_env.hpp"
 
 namespace tts {
 
@@ -51,27 +53,44 @@ public:
 
     ErrorInfo synthesize(const std::string& text, SynthesisResult& result) override;
 
+    /// @brief Synthesize sentence by sentence, emitting each as soon as it is ready
+    /// @note Upcoming sentences are phonemized ahead of inference (frontend_lookahead)
+    ErrorInfo synthesizeStreaming(const std::string& text, ITtsCallback& callback) override;
+
     ErrorInfo setSpeed(float speed) override;
 
+    ErrorInfo trimMemory() override;
+    std::vector<std::string> getModelFiles() const override;
+    ModelMemoryStats getMemoryStats() const override;
+
 private:
+    /// @brief Post-processing settings from the backend config
+    audio::AudioProcessConfig makeAudioProcessConfig() const;
+
     /// @brief Get model directory (expand ~)
     std::string getModelDir() const;
 
     /// @brief Run ONNX inference
+    /// @param shrink_arena Return free CPU arena chunks to the system after the run
     std::vector<float> runInference(const std::vector<int64_t>& token_ids,
                                     const std::vector<float>& style_vector,
-                                    float speed);
+                                    float speed,
+                                    bool shrink_arena = false);
 
     // Components
     KokoroPhonemizer phonemizer_;
     KokoroVoiceManager voice_manager_;
 
     // ONNX Runtime
-    std::unique_ptr<Ort::Env> env_;
+    std::shared_ptr<OrtEnvironment> env_;   // Process-wide shared environment
     std::unique_ptr<Ort::Session> session_;
 
+    // Weight and arena residency (prefetch, huge pages, mlock)
+    ModelMemory model_memory_;
+
     // State
     TtsConfig config_;
+    std::string model_path_;
     bool initialized_ = false;
     float current_speed_ = 1.0f;
 
@@ -79,7 +79,7 @@ private:
     std::unordered_map<std::string, int64_t> vocab_;
 
     // cpp-pinyin converter
-    std::unique_ptr<Pinyin::Pinyin> pinyin_converter_;
+    std::shared_ptr<const Pinyin::Pinyin> pinyin_converter_;
 
     // Whether espeak-ng is available for English processing
     bool espeak_available_ = false;
@@ -4,14 +4,17 @@
 #include <onnxruntime_cxx_api.h>
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "internal/audio/audio_processor.hpp"
 #include "internal/backends/matcha/tts_config.hpp"
 #include "internal/backends/tts_backend.hpp"
+#include "internal/tts_ort_env.hpp"
 
 namespace tts {
 
@@ -30,6 +33,13 @@ namespace tts {
 //               ├── MatchaEnBackend    (英文)
 //               └── MatchaZhEnBackend  (中英混合)
 //
+// 流式合成 (synthesizeStreaming):
+//   模型目录中存在拆分导出的 encoder.onnx / decoder.onnx 时, 编码器与时长预测
+//   只运行一次, 流匹配解码器按带重叠的时间窗逐块解码, 每块解码完成即送入声码器
+//   输出, 首包延迟与句子长度无关。否则整句运行声学模型后分块声码输出。
+//   多句文本逐句合成, 前端在独立线程中提前准备后续句子的 token
+//   (frontend_lookahead 句), 推理阶段无需等待前端。
+//
 
 class MatchaBackend : public ITtsBackend {
 public:
@@ -56,10 +66,27 @@ public:
 
     ErrorInfo synthesize(const std::string& text, SynthesisResult& result) override;
     ErrorInfo synthesizeToFile(const std::string& text, const std::string& file_path) override;
+    ErrorInfo synthesizeBatch(const std::vector<std::string>& texts,
+                              std::vector<SynthesisResult>& results) override;
+    ErrorInfo synthesizeStreaming(const std::string& text, ITtsCallback& callback) override;
+    bool supportsBatching() const override;
+
+    /// @brief 以指定说话人合成 (多说话人模型共用一个会话, 只需一份权重)
+    ErrorInfo synthesizeWithSpeaker(const std::string& text, int speaker_id,
+                                    SynthesisResult& result) override;
+    /// @brief 批量合成, 每个条目的说话人作为 sid [B] 输入同一次推理
+    ErrorInfo synthesizeBatch(const std::vector<std::string>& texts,
+                              const std::vector<int>& speaker_ids,
+                              std::vector<SynthesisResult>& results) override;
+    bool supportsPerRequestSpeaker() const override;
 
     ErrorInfo setSpeed(float speed) override;
     ErrorInfo setSpeaker(int speaker_id) override;
 
+    ErrorInfo trimMemory() override;
+    std::vector<std::string> getModelFiles() const override;
+    ModelMemoryStats getMemoryStats() const override;
+
 protected:
     // -------------------------------------------------------------------------
     // 派生类必须实现的方法
@@ -118,16 +145,92 @@ private:
     // ONNX 推理
     // -------------------------------------------------------------------------
 
+    /// @brief 按 token_buckets 把 token 序列填充到分桶长度 (未配置分桶时原样返回)
+    std::vector<int64_t> padTokensToBucket(const std::vector<int64_t>& tokens) const;
+
     /// @brief 运行声学模型
-    std::vector<float> runAcousticModel(const std::vector<int64_t>& tokens, int speaker_id, float speed);
+    /// @param shrink_arena 推理结束后收缩 CPU arena
+    std::vector<float> runAcousticModel(const std::vector<int64_t>& tokens, int speaker_id, float speed,
+                                        bool shrink_arena = false);
 
     /// @brief 运行声码器
-    std::vector<float> runVocoder(const std::vector<float>& mel, int mel_dim);
+    /// @param shrink_arena 推理结束后收缩 CPU arena
+    std::vector<float> runVocoder(const std::vector<float>& mel, int mel_dim, bool shrink_arena = false);
+
+    /// @brief 运行拆分模型的编码器 (文本编码 + 时长预测 + 对齐)
+    /// @param num_frames [out] mel 帧数
+    /// @return 对齐后的均值 mu, 布局 [mel_dim, num_frames]
+    std::vector<float> runEncoder(const std::vector<int64_t>& tokens, int speaker_id, float speed,
+                                  int32_t& num_frames);
+
+    /// @brief 对 mu 的 [begin, end) 帧运行流匹配解码器
+    /// @return mel, 布局 [mel_dim, end - begin]
+    std::vector<float> runDecoderWindow(const std::vector<float>& mu, const std::vector<float>& noise,
+                                        int32_t total_frames, int32_t begin, int32_t end,
+                                        int speaker_id);
+
+    /// @brief 声码 mel 的 [begin, end) 帧 (两侧附加上下文帧), 返回对应区间的波形
+    /// @param last 最后一块: 输出到波形末尾 (含最后一帧的窗口尾部)
+    std::vector<float> vocodeFrames(const std::vector<float>& mel, int32_t total_frames,
+                                    int32_t begin, int32_t end, bool last);
+
+    /// @brief 整批运行声学模型 (各序列以 pad_id 填充到相同长度, 需要 mel 长度输出)
+    /// @param valid_frames [out] 各条目的有效 mel 帧数 (取自模型的长度输出)
+    /// @return 填充后的 mel [B, mel_dim, T_max]
+    Ort::Value runAcousticBatch(const std::vector<std::vector<int64_t>>& batch_tokens,
+                                const std::vector<int64_t>& speaker_ids, float speed,
+                                std::vector<int32_t>& valid_frames);
+
+    /// @brief 批量运行声学模型与声码器
+    /// @param batch_tokens 各条目的 token 序列 (已添加 blank)
+    /// @param speaker_ids 各条目的说话人 (模型无说话人输入时忽略)
+    /// @return 各条目的音频 (已后处理, 未重采样)
+    /// @note 声学模型没有 mel 长度输出时逐条运行, 只有声码器批量推理
+    std::vector<std::vector<float>> runBatch(const std::vector<std::vector<int64_t>>& batch_tokens,
+                                             const std::vector<int64_t>& speaker_ids, float speed);
+
+    /// @brief 文本规范化 + 转 token IDs + 添加 blank
+    std::vector<int64_t> prepareTokens(const std::string& text);
+
+    /// 流式输出一块音频: (波形, 是否为本句最后一块)
+    using ChunkEmitter = std::function<void(std::vector<float>, bool)>;
+
+    /// @brief 分块解码并输出一句 (token 已由前端准备好)
+    /// @return 错误信息, 取消时返回 CANCELLED
+    ErrorInfo streamSentence(const std::vector<int64_t>& tokens, ITtsCallback& callback,
+                             const ChunkEmitter& emit);
+
+    /// @brief 检查说话人ID是否在 [0, num_speakers_) 内
+    ErrorInfo validateSpeaker(int speaker_id) const;
+
+    /// @brief 运行声码器并做 ISTFT, 不做后处理
+    std::vector<float> runVocoderWaveform(const std::vector<float>& mel, int mel_dim,
+                                          bool shrink_arena = false);
+
+    /// @brief num_frames 帧 ISTFT 输出的样本数
+    size_t istftLength(int32_t num_frames) const;
+
+    /// @brief 按 vocoder_istft 在原声码器与图内 ISTFT 声码器之间选择 (auto 时各测一次)
+    void selectVocoderIstft();
+
+    /// @brief 声码器输出 (幅度/相位) -> ISTFT
+    /// @param frame_stride 输出张量中每个频点的帧数 (批量时为填充后的帧数)
+    /// @param num_frames 实际使用的帧数
+    std::vector<float> vocoderOutputToWaveform(const float* mag, const float* x, const float* y,
+                                               int32_t n_fft_bins, int32_t frame_stride,
+                                               int32_t num_frames);
+
+    /// @brief 由配置生成音频后处理参数
+    audio::AudioProcessConfig makeAudioProcessConfig() const;
+
+    /// @brief 重采样并填充合成结果
+    void fillResult(const std::string& text, std::vector<float> audio_samples,
+                    int64_t processing_time_ms, SynthesisResult& result);
 
     /// @brief 创建内部配置
     void createInternalConfig();
 
-    /// @brief 提取模型元数据
+    /// @brief 提取模型元数据 (含 n_speakers 与各会话的说话人输入名)
     void extractModelMetadata();
 
     /// @brief 预热模型
@@ -152,9 +255,15 @@ protected:
 
 private:
     // ONNX Runtime
-    std::unique_ptr<Ort::Env> env_;
+    std::shared_ptr<OrtEnvironment> env_;   // 进程级共享环境
     std::unique_ptr<Ort::Session> acoustic_model_;
     std::unique_ptr<Ort::Session> vocoder_model_;
+    std::unique_ptr<Ort::Session> vocoder_istft_model_;   // 可选: 图内 ISTFT 的声码器, 选择后释放
+    std::unique_ptr<Ort::Session> encoder_model_;   // 可选: 拆分导出的编码器
+    std::unique_ptr<Ort::Session> decoder_model_;   // 可选: 拆分导出的解码器
+
+    // 权重与推理缓存的驻留控制
+    ModelMemory model_memory_;
 
     // 状态
     bool initialized_ = false;
@@ -170,6 +279,15 @@ private:
     int32_t istft_n_fft_ = 1024;
     int32_t istft_hop_length_ = 256;
     int32_t istft_win_length_ = 1024;
+    bool vocoder_istft_in_graph_ = false;   // vocoder_model_ 直接输出波形
+
+    // 说话人输入名 ("sid" 或 Matcha 导出的 "spks"), 为空表示该会话没有说话人输入
+    std::string acoustic_sid_input_;
+    std::string encoder_sid_input_;
+    std::string decoder_sid_input_;
+
+    // 声学模型的 mel 长度输出名 ("mel_lengths" 等), 为空表示批量推理时声学模型逐条运行
+    std::string acoustic_length_output_;
 };
 
 // =============================================================================
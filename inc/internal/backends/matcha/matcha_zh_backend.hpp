@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "internal/backends/matcha/matcha_backend.hpp"
+#include "internal/text/frontend_context.hpp"
 
 // Forward declaration for Jieba
 namespace cppjieba {
@@ -28,9 +29,14 @@ namespace tts {
 // 采样率: 22050 Hz
 // 特点: 使用 blank tokens
 //
+// 并发: Jieba 分词器与词典为只读资源，按路径在进程内共享；
+//       每次调用的临时缓冲区从上下文池借出，textToTokenIds 可并发调用。
+//
 
 class MatchaZhBackend : public MatchaBackend {
 public:
+    using Lexicon = std::unordered_map<std::string, std::string>;
+
     MatchaZhBackend();
     ~MatchaZhBackend() override;
 
@@ -54,7 +60,7 @@ private:
     void initializeJieba();
 
     /// @brief 加载词典
-    void loadLexicon(const std::string& path);
+    static std::shared_ptr<const Lexicon> loadLexicon(const std::string& path);
 
     /// @brief 将分词后的词转换为 token IDs
     std::vector<int64_t> convertWordToIds(const std::string& word);
@@ -72,8 +78,16 @@ private:
     // 成员变量
     // -------------------------------------------------------------------------
 
-    std::unique_ptr<cppjieba::Jieba> jieba_;
-    std::unordered_map<std::string, std::string> lexicon_;
+    /// 每次调用的可写状态 (缓冲区容量在调用间复用)
+    struct FrontendContext {
+        std::string processed_text;
+        std::vector<std::string> words;
+        std::vector<std::string> cleaned_words;
+    };
+
+    std::shared_ptr<const cppjieba::Jieba> jieba_;
+    std::shared_ptr<const Lexicon> lexicon_;
+    text::ContextPool<FrontendContext> context_pool_;
 };
 
 }  // namespace tts
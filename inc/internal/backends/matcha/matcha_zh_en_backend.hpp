@@ -74,7 +74,7 @@ private:
     // 成员变量
     // -------------------------------------------------------------------------
 
-    std::unique_ptr<Pinyin::Pinyin> pinyin_converter_;
+    std::shared_ptr<const Pinyin::Pinyin> pinyin_converter_;
     bool espeak_initialized_ = false;
 };
 
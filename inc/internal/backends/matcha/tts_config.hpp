@@ -9,6 +9,9 @@ struct TTSConfig {
     // Model paths
     std::string acoustic_model_path;  // Matcha acoustic model
     std::string vocoder_path;         // Vocoder model (HiFiGAN/Vocos)
+    std::string vocoder_istft_path;   // Optional vocoder with the ISTFT appended (-istft.onnx)
+    std::string encoder_model_path;   // Optional split encoder (chunked decoding)
+    std::string decoder_model_path;   // Optional split flow-matching decoder
     std::string lexicon_path;         // Lexicon file for pronunciation
     std::string tokens_path;          // Token vocabulary
     std::string dict_dir;             // Model dictionary directory (for lexicon)
@@ -40,6 +43,12 @@ struct TTSConfig {
 
     // Audio quality
     bool remove_clicks = true;          // Apply click/pop removal post-processing
+    bool trim_silence = true;           // Trim leading/trailing silence
+    float silence_threshold_db = -50.0f;  // Silence threshold (frame RMS, dBFS)
+    int sentence_gap_ms = 150;          // Silence inserted between sentences
+
+    // Streaming
+    int stream_chunk_frames = 64;       // Mel frames per streamed chunk
 
     TTSConfig() = default;
 };
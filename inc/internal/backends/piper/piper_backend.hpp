@@ -0,0 +1,123 @@
+#ifndef PIPER_BACKEND_HPP
+#define PIPER_BACKEND_HPP
+
+#include <onnxruntime_cxx_api.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "internal/audio/audio_processor.hpp"
+#include "internal/backends/piper/piper_config.hpp"
+#include "internal/backends/piper/piper_phonemizer.hpp"
+#include "internal/backends/tts_backend.hpp"
+#include "internal/tts_ort_env.hpp"
+
+namespace tts {
+
+// =============================================================================
+// PiperBackend - Piper / VITS end-to-end backend
+// =============================================================================
+//
+// Single-stage VITS model in the Piper export format:
+//   input [1, N] int64, input_lengths [1] int64,
+//   scales [3] float (noise_scale, length_scale, noise_w), optional sid [1] int64
+//   -> output [1, 1, T] float waveform
+//
+// Files: <model_dir>/<voice>.onnx and <model_dir>/<voice>.onnx.json. The JSON
+// selects the front end (espeak-ng or cpp-pinyin, see PiperPhonemizer), the
+// sample rate and the number of speakers. Serves both BackendType::PIPER and
+// BackendType::VITS (VITS models exported with the Piper toolchain).
+//
+// No vocoder stage, so on low-end CPUs it is several times faster than
+// Matcha + Vocos. Streaming emits sentence by sentence with the front end
+// running ahead (frontend_lookahead).
+//
+
+class PiperBackend : public ITtsBackend {
+public:
+    /// @param type BackendType::PIPER or BackendType::VITS
+    explicit PiperBackend(BackendType type = BackendType::PIPER);
+    ~PiperBackend() override;
+
+    // -------------------------------------------------------------------------
+    // ITtsBackend interface
+    // -------------------------------------------------------------------------
+
+    ErrorInfo initialize(const TtsConfig& config) override;
+    void shutdown() override;
+    bool isInitialized() const override;
+
+    BackendType getType() const override;
+    std::string getName() const override;
+    std::string getVersion() const override;
+    bool supportsStreaming() const override;
+    int getNumSpeakers() const override;
+    int getSampleRate() const override;
+
+    ErrorInfo synthesize(const std::string& text, SynthesisResult& result) override;
+
+    /// @brief Synthesize with a per-request speaker (multi-speaker voices only)
+    ErrorInfo synthesizeWithSpeaker(const std::string& text, int speaker_id,
+                                    SynthesisResult& result) override;
+    bool supportsPerRequestSpeaker() const override;
+
+    /// @brief Synthesize sentence by sentence, emitting each as soon as it is ready
+    ErrorInfo synthesizeStreaming(const std::string& text, ITtsCallback& callback) override;
+
+    ErrorInfo setSpeed(float speed) override;
+    ErrorInfo setSpeaker(int speaker_id) override;
+
+    ErrorInfo trimMemory() override;
+    std::vector<std::string> getModelFiles() const override;
+    ModelMemoryStats getMemoryStats() const override;
+
+private:
+    /// @brief Get model directory (expand ~)
+    std::string getModelDir() const;
+
+    /// @brief Resolve the voice model path ("default" = first voice in model_dir)
+    ErrorInfo resolveModelPath(const std::string& model_dir, const std::string& voice,
+                               std::string& model_path) const;
+
+    /// @brief Post-processing settings from the backend config
+    audio::AudioProcessConfig makeAudioProcessConfig() const;
+
+    /// @brief Resample to output_sample_rate if configured
+    std::vector<float> resampleOutput(std::vector<float> samples) const;
+
+    /// @brief Run ONNX inference
+    /// @param shrink_arena Return free CPU arena chunks to the system after the run
+    std::vector<float> runInference(const std::vector<int64_t>& ids, int speaker_id, float speed,
+                                    bool shrink_arena = false);
+
+    BackendType type_;
+
+    // Voice
+    PiperConfig voice_config_;
+    PiperPhonemizer phonemizer_;
+
+    // ONNX Runtime
+    std::shared_ptr<OrtEnvironment> env_;   // Process-wide shared environment
+    std::unique_ptr<Ort::Session> session_;
+    bool has_sid_input_ = false;            // Multi-speaker model (sid input)
+
+    // Weight and arena residency (prefetch, huge pages, mlock)
+    ModelMemory model_memory_;
+
+    // State
+    TtsConfig config_;
+    std::string model_path_;
+    bool initialized_ = false;
+    float current_speed_ = 1.0f;
+    int current_speaker_ = 0;
+
+    // Thread safety
+    mutable std::mutex inference_mutex_;
+};
+
+}  // namespace tts
+
+#endif  // PIPER_BACKEND_HPP
@@ -0,0 +1,49 @@
+#ifndef PIPER_CONFIG_HPP
+#define PIPER_CONFIG_HPP
+
+#include <cstdint>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "internal/tts_types.hpp"
+
+namespace tts {
+
+// =============================================================================
+// PiperConfig - voice configuration (<voice>.onnx.json)
+// =============================================================================
+//
+// Every Piper voice ships its model together with a JSON file describing the
+// front end (phoneme type, espeak-ng voice, phoneme -> ID table), the output
+// sample rate, the default inference scales and the number of speakers.
+// VITS models exported with the Piper toolchain use the same layout.
+//
+
+struct PiperConfig {
+    int sample_rate = 22050;
+    std::string phoneme_type = "espeak";    // "espeak", "pinyin" or "text"
+    std::string espeak_voice = "en-us";
+
+    // Inference scales (inputs of the "scales" tensor)
+    float noise_scale = 0.667f;
+    float length_scale = 1.0f;
+    float noise_w = 0.8f;
+
+    int num_speakers = 1;
+    std::unordered_map<std::string, int64_t> speaker_id_map;
+
+    // Phoneme (UTF-8 codepoint or pinyin unit) -> model IDs
+    std::unordered_map<std::string, std::vector<int64_t>> phoneme_id_map;
+};
+
+/// @brief Load a Piper voice configuration
+/// @param path Path to <voice>.onnx.json
+/// @param config [out] Parsed configuration
+/// @return MODEL_NOT_FOUND if the file is missing, INVALID_CONFIG if it cannot be parsed
+ErrorInfo loadPiperConfig(const std::string& path, PiperConfig& config);
+
+}  // namespace tts
+
+#endif  // PIPER_CONFIG_HPP
@@ -0,0 +1,65 @@
+#ifndef PIPER_PHONEMIZER_HPP
+#define PIPER_PHONEMIZER_HPP
+
+#include <cstdint>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "internal/backends/piper/piper_config.hpp"
+
+// Forward declaration for cpp-pinyin
+namespace Pinyin {
+class Pinyin;
+}  // namespace Pinyin
+
+namespace tts {
+
+// =============================================================================
+// PiperPhonemizer - text -> Piper phoneme IDs
+// =============================================================================
+//
+// Front end selected by the voice config's phoneme_type:
+//   espeak: espeak-ng IPA (the same G2P as the Matcha English backend), one
+//           phoneme per UTF-8 codepoint; clause punctuation is kept
+//   pinyin: cpp-pinyin TONE3 syllables (shared converter), looked up whole or
+//           split into initial + final-with-tone; English runs go through espeak-ng
+//   text:   normalized characters are the phonemes
+//
+// IDs follow Piper's layout: ^ _ p1 _ p2 _ ... pn _ $ (pad after every phoneme).
+// After init() the phonemizer is read-only; textToIds may be called concurrently.
+//
+
+class PiperPhonemizer {
+public:
+    PiperPhonemizer() = default;
+
+    /// @brief Bind to a voice config (and load cpp-pinyin for pinyin voices)
+    /// @throws std::runtime_error if the pinyin dictionary cannot be loaded
+    void init(const PiperConfig& config);
+
+    /// @brief Convert text to model input IDs (empty if no phoneme is known)
+    std::vector<int64_t> textToIds(const std::string& text) const;
+
+    /// @brief Convert phonemes to IDs with BOS/EOS and interspersed pad
+    std::vector<int64_t> phonemesToIds(const std::vector<std::string>& phonemes) const;
+
+private:
+    std::vector<std::string> phonemizeEspeak(const std::string& text, const std::string& voice) const;
+    std::vector<std::string> phonemizePinyin(const std::string& text) const;
+    std::vector<std::string> phonemizeText(const std::string& text) const;
+
+    /// @brief Append the units of one TONE3 pinyin syllable
+    void appendPinyinSyllable(const std::string& syllable, std::vector<std::string>& phonemes) const;
+
+    bool hasPhoneme(const std::string& phoneme) const;
+
+    const PiperConfig* config_ = nullptr;
+    std::shared_ptr<const Pinyin::Pinyin> pinyin_converter_;
+    bool espeak_available_ = false;
+};
+
+}  // namespace tts
+
+#endif  // PIPER_PHONEMIZER_HPP
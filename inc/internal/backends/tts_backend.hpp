@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "internal/tts_config.hpp"
+#include "internal/tts_model_memory.hpp"
 #include "internal/tts_types.hpp"
 
 namespace tts {
@@ -29,6 +30,8 @@ namespace tts {
 // - MatchaZHBackend:   中文 (matcha-icefall-zh-baker)
 // - MatchaENBackend:   英文 (matcha-icefall-en_US-ljspeech)
 // - MatchaZHENBackend: 中英混合 (matcha-icefall-zh-en)
+// - KokoroBackend:     中英混合 (kokoro-v1.0)
+// - PiperBackend:      Piper / VITS 单阶段模型 (VITS、PIPER)
 //
 
 class ITtsBackend {
@@ -101,6 +104,94 @@ public:
         return saveToFile(result.audio, file_path);
     }
 
+    /// @brief 批量合成多段独立文本
+    /// @param texts 要合成的文本列表
+    /// @param results [out] 与 texts 一一对应的结果, 各条目的 success/error 独立设置
+    /// @return 错误信息 (仅表示整批失败, 如后端未初始化)
+    /// @note 默认实现逐条调用 synthesize; 支持批量推理的后端覆盖此方法,
+    ///       用一次填充后的 batch 推理代替多次 batch=1 推理
+    virtual ErrorInfo synthesizeBatch(const std::vector<std::string>& texts,
+                                      std::vector<SynthesisResult>& results) {
+        results.clear();
+        results.resize(texts.size());
+        for (size_t i = 0; i < texts.size(); ++i) {
+            auto err = synthesize(texts[i], results[i]);
+            if (!err.isOk()) {
+                results[i].success = false;
+                results[i].error = err;
+            }
+        }
+        return ErrorInfo::ok();
+    }
+
+    /// @brief 是否支持真正的批量推理 (synthesizeBatch 不只是逐条循环)
+    virtual bool supportsBatching() const { return false; }
+
+    /// @brief 以指定说话人合成, 不改变 setSpeaker 设置的默认说话人
+    /// @param text 要合成的文本
+    /// @param speaker_id 本次请求的说话人ID
+    /// @param result [out] 合成结果
+    /// @return 错误信息
+    /// @note 默认不支持; 单个会话即可切换说话人的多说话人后端覆盖此方法
+    ///       与 supportsPerRequestSpeaker
+    virtual ErrorInfo synthesizeWithSpeaker(const std::string& text, int speaker_id,
+                                            SynthesisResult& result) {
+        (void)text;
+        (void)speaker_id;
+        (void)result;
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG,
+            "Per-request speaker not supported by this backend");
+    }
+
+    /// @brief 批量合成, 每条文本使用各自的说话人
+    /// @param texts 要合成的文本列表
+    /// @param speaker_ids 与 texts 一一对应的说话人ID
+    /// @param results [out] 与 texts 一一对应的结果
+    /// @return 错误信息 (仅表示整批失败)
+    /// @note 默认实现逐条调用 synthesizeWithSpeaker; 支持批量推理的后端覆盖此方法,
+    ///       在同一批中为每个条目输入不同的说话人
+    virtual ErrorInfo synthesizeBatch(const std::vector<std::string>& texts,
+                                      const std::vector<int>& speaker_ids,
+                                      std::vector<SynthesisResult>& results) {
+        if (speaker_ids.size() != texts.size()) {
+            return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "speaker_ids size mismatch");
+        }
+        results.clear();
+        results.resize(texts.size());
+        for (size_t i = 0; i < texts.size(); ++i) {
+            auto err = synthesizeWithSpeaker(texts[i], speaker_ids[i], results[i]);
+            if (!err.isOk()) {
+                results[i].success = false;
+                results[i].error = err;
+            }
+        }
+        return ErrorInfo::ok();
+    }
+
+    /// @brief 是否支持按请求指定说话人 (synthesizeWithSpeaker 可用, 无需独占切换)
+    virtual bool supportsPerRequestSpeaker() const { return false; }
+
+    /// @brief 合成文本, 音频块一旦就绪即通过 callback.onAudioChunk 输出
+    /// @param text 要合成的文本
+    /// @param callback 本次调用的回调 (只调用 onAudioChunk, 最后一块 is_final=true;
+    ///                 每块之前查询 isCancelled, 取消时返回 CANCELLED)
+    /// @return 错误信息
+    /// @note 默认实现整段合成后输出一块; 支持分块解码的后端覆盖此方法以降低首包延迟。
+    ///       callback 按调用传入, 与 setCallback 设置的会话回调无关, 可并发调用
+    virtual ErrorInfo synthesizeStreaming(const std::string& text, ITtsCallback& callback) {
+        if (callback.isCancelled()) {
+            return ErrorInfo::error(ErrorCode::CANCELLED, "Cancelled");
+        }
+        SynthesisResult result;
+        auto err = synthesize(text, result);
+        if (!err.isOk()) {
+            return err;
+        }
+        result.audio.is_final = true;
+        callback.onAudioChunk(result.audio);
+        return ErrorInfo::ok();
+    }
+
     // -------------------------------------------------------------------------
     // 流式合成 (可选)
     // -------------------------------------------------------------------------
@@ -185,6 +276,26 @@ public:
         return ErrorInfo::error(ErrorCode::INTERNAL_ERROR, "Pitch update not supported");
     }
 
+    // -------------------------------------------------------------------------
+    // 内存管理 (可选)
+    // -------------------------------------------------------------------------
+
+    /// @brief 释放推理缓存 (如 ORT arena 中的空闲块), 模型保持加载
+    /// @return 错误信息
+    virtual ErrorInfo trimMemory() {
+        return ErrorInfo::error(ErrorCode::INTERNAL_ERROR, "Memory trim not supported");
+    }
+
+    /// @brief 获取已加载的模型文件路径 (卸载后用于释放页缓存)
+    virtual std::vector<std::string> getModelFiles() const {
+        return {};
+    }
+
+    /// @brief 获取模型权重与推理缓存的驻留统计
+    virtual ModelMemoryStats getMemoryStats() const {
+        return ModelMemoryStats();
+    }
+
 protected:
     ITtsCallback* callback_ = nullptr;
 
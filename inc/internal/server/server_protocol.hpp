@@ -0,0 +1,126 @@
+#ifndef SERVER_PROTOCOL_HPP
+#define SERVER_PROTOCOL_HPP
+
+/**
+ * ServerProtocol - 本地套接字通信协议
+ *
+ * TtsWorkerPool (服务端) 与 TtsClient (客户端) 之间的二进制协议。
+ * 所有字段均为本机字节序 (仅用于同一主机上的 Unix 域套接字)。
+ *
+ * 请求:  RequestHeader + payload (UTF-8 文本)
+ * 响应:  ResponseHeader + payload
+ *        - 成功: int16 PCM 样本
+ *        - 失败: 错误信息 (UTF-8)
+ *        - STATS: WireWorkerStats 数组
+ *        - SYNTHESIZE_SHM: 无 payload, 通过 SCM_RIGHTS 附带共享内存流句柄
+ *          (memfd, data eventfd, space eventfd), 音频随后写入共享内存环形缓冲区
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+
+namespace tts {
+namespace server {
+
+// =============================================================================
+// 协议常量
+// =============================================================================
+
+constexpr uint32_t kProtocolMagic = 0x544F5645;     ///< "EVOT"
+constexpr uint16_t kProtocolVersion = 1;
+constexpr uint32_t kMaxTextPayload = 1024 * 1024;   ///< 单次请求最大文本 (1MB)
+
+enum class MessageType : uint16_t {
+    SYNTHESIZE = 1,     ///< 合成文本, 返回 PCM
+    STATS = 2,          ///< 查询各工作进程统计
+    PING = 3,           ///< 存活检查
+    SYNTHESIZE_SHM = 4, ///< 合成文本, 通过共享内存流返回 float PCM
+};
+
+enum class ResponseStatus : int32_t {
+    OK = 0,
+    BAD_REQUEST = 1,
+    SYNTHESIS_FAILED = 2,
+    UNSUPPORTED = 3,
+};
+
+// =============================================================================
+// 报文头
+// =============================================================================
+
+struct RequestHeader {
+    uint32_t magic = kProtocolMagic;
+    uint16_t version = kProtocolVersion;
+    uint16_t type = 0;                  ///< MessageType
+    uint32_t payload_size = 0;          ///< 文本字节数
+    float speech_rate = 0.0f;           ///< 语速覆盖 (0=使用默认)
+};
+
+struct ResponseHeader {
+    uint32_t magic = kProtocolMagic;
+    int32_t status = 0;                 ///< ResponseStatus
+    uint32_t sample_rate = 0;           ///< 采样率 (Hz)
+    uint32_t payload_size = 0;          ///< payload 字节数
+    uint32_t processing_time_ms = 0;    ///< 服务端处理耗时
+    int32_t worker_index = -1;          ///< 处理该请求的工作进程编号
+};
+
+/// 工作进程统计 (线上格式)
+struct WireWorkerStats {
+    int32_t index;
+    int32_t pid;
+    int32_t alive;
+    int32_t restarts;
+    uint64_t requests;
+    uint64_t failures;
+    uint64_t audio_ms;
+    uint64_t busy_ms;
+    uint64_t text_bytes;
+    int64_t last_active_ms;             ///< 最近一次请求完成时间 (Unix 毫秒)
+};
+
+// =============================================================================
+// 套接字读写辅助函数
+// =============================================================================
+
+/**
+ * @brief 完整写入 (处理 EINTR 与部分写入)
+ * @return 全部写入返回 true
+ */
+bool writeFully(int fd, const void* data, size_t size);
+
+/**
+ * @brief 完整读取 (处理 EINTR 与部分读取)
+ * @return 读满 size 字节返回 true, 对端关闭或出错返回 false
+ */
+bool readFully(int fd, void* data, size_t size);
+
+/**
+ * @brief 发送响应 (头 + payload)
+ */
+bool sendResponse(int fd, ResponseHeader header, const void* payload, size_t size);
+
+/**
+ * @brief 发送错误响应
+ */
+bool sendError(int fd, ResponseStatus status, const std::string& message);
+
+/**
+ * @brief 发送无 payload 的响应头, 并通过 SCM_RIGHTS 附带文件描述符
+ */
+bool sendResponseWithFds(int fd, ResponseHeader header, const int* fds, int num_fds);
+
+/**
+ * @brief 读取响应头及附带的文件描述符
+ * @param fds 输出, 接收到的描述符 (调用方负责关闭)
+ * @param max_fds fds 容量
+ * @param num_fds 输出, 实际接收数量
+ */
+bool readResponseWithFds(int fd, ResponseHeader& header, int* fds, int max_fds, int& num_fds);
+
+}  // namespace server
+}  // namespace tts
+
+#endif  // SERVER_PROTOCOL_HPP
@@ -0,0 +1,123 @@
+#ifndef SHM_RING_HPP
+#define SHM_RING_HPP
+
+/**
+ * ShmRing - 共享内存音频环形缓冲区 (单生产者 / 单消费者)
+ *
+ * 基于 memfd 的环形缓冲区，用于同一主机上的进程间零拷贝传输音频:
+ * - 数据区被映射两次 (镜像映射)，任意位置开始的可读区间在地址空间中都是连续的，
+ *   读端可直接把指针交给调用方 (numpy 视图等)，无需处理回绕
+ * - 读写位置为单调递增的 64 位计数，存放于共享头部 (原子变量)
+ * - 两个 eventfd 用于通知: data_fd (写端 -> 读端), space_fd (读端 -> 写端)
+ *
+ * 三个文件描述符 (memfd, data_fd, space_fd) 即流的句柄，通过 SCM_RIGHTS 传给客户端。
+ *
+ * 仅 Linux 可用 (memfd_create / eventfd)，其他平台 create()/attach() 返回 false。
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+
+namespace tts {
+namespace server {
+
+/// 流状态 (写端关闭时设置)
+enum class ShmStreamStatus : int32_t {
+    RUNNING = 0,
+    COMPLETED = 1,
+    FAILED = 2,
+};
+
+class ShmRing {
+public:
+    ShmRing() = default;
+    ~ShmRing();
+
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    // -------------------------------------------------------------------------
+    // 创建 / 附加
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief 创建新的环形缓冲区 (写端)
+     * @param min_capacity 最小容量 (字节)，向上取整到页大小
+     * @param sample_rate 音频采样率，写入共享头部
+     */
+    bool create(size_t min_capacity, int sample_rate);
+
+    /**
+     * @brief 通过句柄附加到已有缓冲区 (读端)，接管三个 fd 的所有权
+     */
+    bool attach(int memfd, int data_fd, int space_fd);
+
+    void release();
+
+    bool valid() const { return base_ != nullptr; }
+    int memfd() const { return memfd_; }
+    int dataFd() const { return data_fd_; }
+    int spaceFd() const { return space_fd_; }
+    size_t capacity() const { return capacity_; }
+    int sampleRate() const;
+
+    // -------------------------------------------------------------------------
+    // 写端
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief 写入数据，缓冲区满时阻塞等待读端消费
+     * @param abort_fd 读端所在连接，挂断时放弃写入 (-1 表示不检查)
+     * @return 全部写入返回 true
+     */
+    bool write(const void* data, size_t size, int abort_fd);
+
+    /// @brief 关闭写端并通知读端
+    void close(ShmStreamStatus status, const std::string& message = "");
+
+    // -------------------------------------------------------------------------
+    // 读端
+    // -------------------------------------------------------------------------
+
+    /// @brief 当前可读字节数
+    size_t readable() const;
+
+    /// @brief 可读区间起始地址 (连续 readable() 字节)
+    const uint8_t* readPtr() const;
+
+    /// @brief 释放已读数据并通知写端
+    void consume(size_t size);
+
+    /**
+     * @brief 等待数据到达或写端关闭
+     * @param timeout_ms 超时 (-1 无限等待)
+     * @return 有可读数据或已关闭返回 true，超时返回 false
+     */
+    bool waitReadable(int timeout_ms);
+
+    /// @brief 写端是否已关闭
+    bool closed() const;
+
+    ShmStreamStatus status() const;
+    std::string message() const;
+
+private:
+    struct Header;
+
+    bool mapRegion(bool initialize);
+
+    int memfd_ = -1;
+    int data_fd_ = -1;
+    int space_fd_ = -1;
+    size_t capacity_ = 0;
+    size_t header_size_ = 0;
+    uint8_t* base_ = nullptr;       ///< 头部 + 数据 + 镜像
+    size_t mapped_size_ = 0;
+};
+
+}  // namespace server
+}  // namespace tts
+
+#endif  // SHM_RING_HPP
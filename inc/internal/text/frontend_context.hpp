@@ -0,0 +1,123 @@
+#ifndef FRONTEND_CONTEXT_HPP
+#define FRONTEND_CONTEXT_HPP
+
+/**
+ * 文本前端并发支持
+ *
+ * 前端 (规范化、分词、G2P) 按以下约定支持多线程并发调用:
+ * - 词典、分词器、拼音表等在初始化后只读，以 const 对象在线程间共享
+ * - 每次调用需要的可写状态 (临时缓冲区等) 放在轻量的上下文对象中，
+ *   从 ContextPool 借出、用完归还，缓冲区容量在请求间复用
+ *
+ * SharedResourceCache 按键 (通常为词典路径) 缓存只读资源，同一进程内
+ * 多个后端实例共享同一份数据；最后一个使用者释放后资源随之销毁。
+ */
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tts {
+namespace text {
+
+// =============================================================================
+// ContextPool - 每线程上下文池
+// =============================================================================
+
+template <typename T>
+class ContextPool {
+public:
+    /// 借出的上下文，析构时归还
+    class Lease {
+    public:
+        Lease(ContextPool* pool, std::unique_ptr<T> context)
+            : pool_(pool), context_(std::move(context)) {}
+        ~Lease() {
+            if (context_) {
+                pool_->release(std::move(context_));
+            }
+        }
+
+        Lease(Lease&& other) noexcept = default;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease& operator=(Lease&&) = delete;
+
+        T& operator*() const { return *context_; }
+        T* operator->() const { return context_.get(); }
+
+    private:
+        ContextPool* pool_;
+        std::unique_ptr<T> context_;
+    };
+
+    /// @brief 借出一个上下文，池为空时新建
+    Lease acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!free_.empty()) {
+                std::unique_ptr<T> context = std::move(free_.back());
+                free_.pop_back();
+                return Lease(this, std::move(context));
+            }
+        }
+        return Lease(this, std::make_unique<T>());
+    }
+
+    /// @brief 释放所有空闲上下文
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.clear();
+    }
+
+private:
+    void release(std::unique_ptr<T> context) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(std::move(context));
+    }
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<T>> free_;
+};
+
+// =============================================================================
+// SharedResourceCache - 进程级只读资源缓存
+// =============================================================================
+
+template <typename T>
+class SharedResourceCache {
+public:
+    using Loader = std::function<std::shared_ptr<const T>()>;
+
+    /**
+     * @brief 获取资源，未缓存或已释放时调用 loader 加载
+     * @note 加载在锁内进行，并发请求同一资源时只加载一次
+     */
+    std::shared_ptr<const T> get(const std::string& key, const Loader& loader) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            if (auto resource = it->second.lock()) {
+                return resource;
+            }
+        }
+        std::shared_ptr<const T> resource = loader();
+        if (resource) {
+            entries_[key] = resource;
+        }
+        return resource;
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::weak_ptr<const T>> entries_;
+};
+
+}  // namespace text
+}  // namespace tts
+
+#endif  // FRONTEND_CONTEXT_HPP
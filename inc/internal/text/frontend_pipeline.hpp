@@ -0,0 +1,148 @@
+#ifndef FRONTEND_PIPELINE_HPP
+#define FRONTEND_PIPELINE_HPP
+
+/**
+ * FrontendPipeline - 前端预取流水线
+ *
+ * 逐句流式合成时，前端 (规范化、分词、G2P) 与推理交替执行会让两边轮流空闲。
+ * 本流水线在独立线程中按顺序把后续句子转换为模型输入 (token IDs 等)，放入
+ * 有界队列；推理阶段取下一句时输入通常已经就绪。
+ *
+ * - 队列容量即最多提前处理的句数，前端不会无限超前占用内存
+ * - 结果严格按输入顺序返回；前端抛出的异常在取到对应句子时重新抛出
+ * - 只有一句或容量为 0 时不创建线程，直接在调用线程中处理
+ * - 析构时停止前端线程 (当前句处理完后退出)
+ *
+ * prepare 会与推理并发执行，要求前端满足 frontend_context.hpp 中的并发约定。
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace tts {
+namespace text {
+
+template <typename T>
+class FrontendPipeline {
+public:
+    using Prepare = std::function<T(const std::string&)>;
+
+    /**
+     * @param inputs 按顺序处理的句子
+     * @param prepare 前端转换函数
+     * @param capacity 最多提前处理的句数 (0 表示不预取)
+     */
+    FrontendPipeline(std::vector<std::string> inputs, Prepare prepare, size_t capacity)
+        : inputs_(std::move(inputs))
+        , prepare_(std::move(prepare))
+        , capacity_(capacity) {
+        if (capacity_ > 0 && inputs_.size() > 1) {
+            thread_ = std::thread(&FrontendPipeline::produce, this);
+        }
+    }
+
+    ~FrontendPipeline() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    FrontendPipeline(const FrontendPipeline&) = delete;
+    FrontendPipeline& operator=(const FrontendPipeline&) = delete;
+
+    /// @brief 句子总数
+    size_t size() const { return inputs_.size(); }
+
+    /**
+     * @brief 按顺序取下一句的前端结果
+     * @param item [out] 前端结果
+     * @return 全部取完返回 false
+     */
+    bool next(T& item) {
+        if (consumed_ >= inputs_.size()) {
+            return false;
+        }
+
+        if (!thread_.joinable()) {
+            item = prepare_(inputs_[consumed_++]);
+            return true;
+        }
+
+        Slot slot;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return !ready_.empty(); });
+            slot = std::move(ready_.front());
+            ready_.pop_front();
+        }
+        cv_.notify_all();
+        ++consumed_;
+
+        if (slot.error) {
+            std::rethrow_exception(slot.error);
+        }
+        item = std::move(slot.value);
+        return true;
+    }
+
+private:
+    struct Slot {
+        T value{};
+        std::exception_ptr error;
+    };
+
+    void produce() {
+        for (const auto& input : inputs_) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return stop_ || ready_.size() < capacity_; });
+                if (stop_) {
+                    return;
+                }
+            }
+
+            Slot slot;
+            try {
+                slot.value = prepare_(input);
+            } catch (...) {
+                slot.error = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ready_.push_back(std::move(slot));
+            }
+            cv_.notify_all();
+        }
+    }
+
+    std::vector<std::string> inputs_;
+    Prepare prepare_;
+    size_t capacity_;
+    size_t consumed_ = 0;               // 只在调用线程中访问
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Slot> ready_;
+    bool stop_ = false;
+
+    std::thread thread_;
+};
+
+}  // namespace text
+}  // namespace tts
+
+#endif  // FRONTEND_PIPELINE_HPP
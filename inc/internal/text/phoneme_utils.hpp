@@ -4,7 +4,7 @@
 /**
  * PhonemeUtils - 音素处理工具模块
  *
- * 提供 IPA 音素转换等功能。
+ * 提供 espeak-ng G2P 调用与 IPA 音素转换等功能。
  */
 
 #include <string>
@@ -30,6 +30,24 @@ namespace text {
  */
 std::string convertToGruutEnUs(const std::string& ipa);
 
+// =============================================================================
+// espeak-ng G2P
+// =============================================================================
+
+/**
+ * @brief 检查 espeak-ng 命令行是否可用
+ */
+bool isEspeakNgAvailable();
+
+/**
+ * @brief 调用 espeak-ng 把文本转换为 IPA 音素
+ * @param text 输入文本
+ * @param voice espeak-ng 语音 (如 "en-us", "cmn", "de")
+ * @param ipa_mode --ipa 参数: 0 为默认 (音素间无分隔), 1 连字符, 2 零宽连接符, 3 以 _ 分隔
+ * @return IPA 字符串 (去掉换行、合并连续空白、去除首尾空白), 失败返回空串
+ */
+std::string espeakToIpa(const std::string& text, const std::string& voice = "en-us", int ipa_mode = 3);
+
 }  // namespace text
 }  // namespace tts
 
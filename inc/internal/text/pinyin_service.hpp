@@ -0,0 +1,35 @@
+#ifndef PINYIN_SERVICE_HPP
+#define PINYIN_SERVICE_HPP
+
+/**
+ * 进程级共享的 cpp-pinyin 转换器
+ *
+ * cpp-pinyin 构造转换器时会解析整套文本词典 (词组表、单字表、繁简表)。
+ * 多个后端 (Matcha 中英、Kokoro) 以及同一后端的多个引擎实例按词典目录
+ * 共享同一个转换器：首次获取时加载，之后直接复用；最后一个持有者释放后销毁。
+ *
+ * 转换器加载后只读，hanziToPinyin 可从多个线程同时调用。
+ */
+
+#include <memory>
+#include <string>
+
+// Forward declaration for cpp-pinyin
+namespace Pinyin {
+class Pinyin;
+}  // namespace Pinyin
+
+namespace tts {
+namespace text {
+
+/**
+ * @brief 获取词典目录对应的共享拼音转换器，未加载时加载
+ * @param dict_dir cpp-pinyin 词典目录 (res/dict)
+ * @return 转换器 (加载失败时抛出 std::runtime_error)
+ */
+std::shared_ptr<const Pinyin::Pinyin> acquirePinyinConverter(const std::string& dict_dir);
+
+}  // namespace text
+}  // namespace tts
+
+#endif  // PINYIN_SERVICE_HPP
@@ -65,6 +65,10 @@ struct NormalizerMatch {
 // =============================================================================
 // TextNormalizer (文本规范化器)
 // =============================================================================
+//
+// normalize() 为 const 且不修改任何共享状态 (正则表达式编译一次后只读)，
+// 同一实例可被多个线程同时调用。setDefaultLanguage() 不可与 normalize() 并发。
+//
 
 class TextNormalizer {
 public:
@@ -77,7 +81,7 @@ public:
      * @param lang 目标语言 (ZH/EN/AUTO)
      * @return 规范化后的文本
      */
-    std::string normalize(const std::string& text, Language lang = Language::AUTO);
+    std::string normalize(const std::string& text, Language lang = Language::AUTO) const;
 
     /**
      * @brief 设置默认语言
@@ -94,13 +98,13 @@ private:
     Language default_lang_ = Language::AUTO;
 
     // 规范化处理
-    std::string normalizeFormulas(const std::string& text, Language lang);
-    std::string normalizeNumbers(const std::string& text, Language lang);
-    std::string normalizeCurrency(const std::string& text, Language lang);
-    std::string normalizeDateTime(const std::string& text, Language lang);
-    std::string normalizeUnits(const std::string& text, Language lang);
-    std::string normalizePhoneNumbers(const std::string& text, Language lang);
-    std::string normalizePercentages(const std::string& text, Language lang);
+    std::string normalizeFormulas(const std::string& text, Language lang) const;
+    std::string normalizeNumbers(const std::string& text, Language lang) const;
+    std::string normalizeCurrency(const std::string& text, Language lang) const;
+    std::string normalizeDateTime(const std::string& text, Language lang) const;
+    std::string normalizeUnits(const std::string& text, Language lang) const;
+    std::string normalizePhoneNumbers(const std::string& text, Language lang) const;
+    std::string normalizePercentages(const std::string& text, Language lang) const;
 
     // 上下文检测
     Language detectLanguage(const std::string& text, size_t pos) const;
@@ -125,6 +129,66 @@ private:
     bool isRange(const std::string& text, size_t pos) const;
 };
 
+// =============================================================================
+// StreamingTextNormalizer (增量文本规范化器)
+// =============================================================================
+
+/**
+ * 逐片段输入的文本规范化 (用于 LLM 流式输出等场景)
+ *
+ * 片段可能在任意位置断开，例如 "价格是3" "." "14元"。每次 push() 只输出
+ * 后续输入不可能再改变的前缀的规范化结果，尾部可能继续的数字、日期、单位、
+ * 货币符号 (以及不完整的 UTF-8 字符) 暂存到下一次输入:
+ *
+ *   push("价格是3")  -> "价格是"      ("3" 暂存)
+ *   push(".")        -> ""            ("3." 暂存)
+ *   push("14元")     -> "三点一四元"
+ *   flush()          -> 暂存内容的规范化结果
+ *
+ * 每次只扫描暂存区和新片段，已输出部分不会重新规范化，开销与新输入成正比。
+ * 规范化新提交的文本时带上已输出文本的末尾 kContextChars 个字符作为左侧上下文
+ * (AUTO 语言判断、负号与减号的区分依赖左侧字符)，结果与整段规范化一致；
+ * 右侧上下文只包含同一次提交的文本。
+ * 非线程安全，每个流使用独立实例。
+ */
+class StreamingTextNormalizer {
+public:
+    explicit StreamingTextNormalizer(Language lang = Language::AUTO);
+
+    /**
+     * @brief 输入一个文本片段
+     * @param fragment 文本片段 (可在 UTF-8 字符中间断开)
+     * @return 已稳定部分的规范化文本 (可能为空)
+     */
+    std::string push(const std::string& fragment);
+
+    /**
+     * @brief 输入结束，规范化并输出全部暂存内容
+     */
+    std::string flush();
+
+    /// @brief 丢弃暂存内容与左侧上下文
+    void reset();
+
+    /// @brief 当前暂存 (尚未输出) 的原始文本
+    const std::string& pending() const { return pending_; }
+
+private:
+    /// 返回可安全输出的字符数 (chars 为暂存区的完整 UTF-8 字符)
+    size_t stablePrefixLength(const std::vector<std::string>& chars) const;
+
+    /// 带左侧上下文规范化新提交的文本
+    std::string normalizeCommitted(const std::string& text);
+
+    // 左侧上下文字符数, 与 TextNormalizer::detectLanguage 的窗口一致
+    static constexpr size_t kContextChars = 10;
+
+    TextNormalizer normalizer_;
+    Language lang_;
+    std::string pending_;
+    std::string context_;       // 已输出原文的末尾 (未规范化)
+};
+
 // =============================================================================
 // 便捷函数
 // =============================================================================
@@ -27,6 +27,20 @@ namespace text {
  */
 std::vector<std::string> splitUtf8(const std::string& str);
 
+/**
+ * @brief 统计 UTF-8 字符数 (不分配内存, 用于批处理与调度的长度估计)
+ * @param str UTF-8 编码的字符串
+ * @return 字符数
+ */
+size_t utf8Length(const std::string& str);
+
+/**
+ * @brief 完整 UTF-8 字符的字节数 (去掉末尾被截断的多字节序列, 用于分块输入)
+ * @param str UTF-8 编码的字符串, 末尾可能是不完整的字符
+ * @return 不含截断尾部的字节数
+ */
+size_t completeUtf8Length(const std::string& str);
+
 // =============================================================================
 // 字符类型判断
 // =============================================================================
@@ -94,6 +108,29 @@ std::string mapPunctuation(
  */
 std::string mapChinesePunctToAscii(const std::string& punct);
 
+// =============================================================================
+// 分句
+// =============================================================================
+
+/**
+ * @brief 按句末标点把文本切分为句子 (用于逐句流式合成)
+ * @param text UTF-8 文本
+ * @return 句子列表, 句末标点与紧随其后的引号/括号保留在句内;
+ *         只含标点的片段并入前一句
+ * @note 句末标点: 。！？；…!?; 与换行; 英文句点仅在其后为空白或结尾时断句 (不拆分小数)
+ */
+std::vector<std::string> splitSentences(const std::string& text);
+
+/**
+ * @brief 增量分句: 找出文本中各完整句子的结束字节位置 (用于分块读入的长文档)
+ * @param text UTF-8 文本 (可以在句中或多字节字符中间截断)
+ * @param at_eof 文本已到结尾: 末尾的句末标点与剩余文本都视为完整
+ * @return 升序的结束位置 (句末标点与紧随的引号/括号之后); 最后一个位置之后是未完成的句子
+ * @note 断句规则与 splitSentences 相同; 位于文本末尾的句末标点要等下一块 (可能还有右引号或
+ *       小数部分) 才确定, 除非 at_eof
+ */
+std::vector<size_t> findSentenceEnds(const std::string& text, bool at_eof);
+
 }  // namespace text
 }  // namespace tts
 
@@ -0,0 +1,121 @@
+#ifndef TTS_AUDIO_CACHE_HPP
+#define TTS_AUDIO_CACHE_HPP
+
+/**
+ * AudioCache - 合成结果缓存
+ *
+ * 两级缓存:
+ * - 内存层: 按字节预算的 LRU，命中时直接返回音频
+ * - 磁盘层 (可选): 每条结果一个文件，进程重启后仍然有效；内存未命中时
+ *   从磁盘读取并提升到内存层
+ *
+ * 键由调用方构造，需包含影响音频的全部参数 (模型、音色、说话人、语速、文本)。
+ * 所有方法可从多个线程同时调用。
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "internal/tts_types.hpp"
+
+namespace tts {
+
+// =============================================================================
+// AudioCacheConfig (缓存配置)
+// =============================================================================
+
+struct AudioCacheConfig {
+    size_t max_bytes = 64 * 1024 * 1024;    // 内存层容量上限 (字节)
+    std::string disk_dir;                   // 磁盘层目录, 空则不启用
+};
+
+// =============================================================================
+// AudioCache (合成结果缓存)
+// =============================================================================
+
+class AudioCache {
+public:
+    /// 命中来源
+    enum class Source {
+        MISS,
+        MEMORY,
+        DISK,
+    };
+
+    explicit AudioCache(const AudioCacheConfig& config);
+
+    AudioCache(const AudioCache&) = delete;
+    AudioCache& operator=(const AudioCache&) = delete;
+
+    /// @brief 查找音频, 先查内存再查磁盘 (磁盘命中会提升到内存)
+    /// @param key 缓存键
+    /// @param audio [out] 命中时填充 samples 与 sample_rate
+    /// @return 命中来源, 未命中返回 MISS
+    Source lookup(const std::string& key, AudioChunk& audio);
+
+    /// @brief 写入内存层, 启用磁盘层时同时持久化
+    void insert(const std::string& key, const AudioChunk& audio);
+
+    /// @brief 内存层当前占用 (字节)
+    size_t memoryBytes() const;
+
+    /// @brief 内存层条目数
+    size_t size() const;
+
+private:
+    struct Entry {
+        std::string key;
+        std::vector<float> samples;
+        int sample_rate = 0;
+
+        size_t bytes() const { return key.size() + samples.size() * sizeof(float); }
+    };
+
+    /// 插入内存层并按预算淘汰 (调用方持有锁)
+    void insertLocked(Entry entry);
+
+    std::string diskPath(const std::string& key) const;
+    bool readFromDisk(const std::string& key, Entry& entry) const;
+    void writeToDisk(const Entry& entry) const;
+
+    AudioCacheConfig config_;
+
+    mutable std::mutex mutex_;
+    std::list<Entry> lru_;                  // 头部为最近使用
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    size_t bytes_ = 0;
+};
+
+// =============================================================================
+// 预加载清单
+// =============================================================================
+
+/**
+ * 预加载清单条目
+ *
+ * 清单为 UTF-8 文本文件，每行一条:
+ *   文本[<TAB>选项=值]...
+ * 支持的选项: speed (语速), speaker (说话人ID)。未指定的选项使用引擎当前配置。
+ * 空行和以 # 开头的行忽略。
+ */
+struct PromptEntry {
+    std::string text;
+    float speed = 0.0f;     // <= 0 表示使用引擎配置
+    int speaker_id = -1;    // < 0 表示使用引擎配置
+};
+
+/// @brief 读取预加载清单
+/// @param path 清单文件路径
+/// @param entries [out] 解析出的条目
+/// @return 错误信息 (文件无法打开或选项无法解析)
+ErrorInfo loadPromptManifest(const std::string& path, std::vector<PromptEntry>& entries);
+
+}  // namespace tts
+
+#endif  // TTS_AUDIO_CACHE_HPP
@@ -0,0 +1,102 @@
+#ifndef TTS_BATCHER_HPP
+#define TTS_BATCHER_HPP
+
+/**
+ * DynamicBatcher - 跨请求动态批处理
+ *
+ * 并发到达的短请求在一个很短的窗口内合并为一批，用一次填充后的 batch
+ * 推理代替多次 batch=1 推理，结果按请求分发回各调用方。
+ *
+ * 窗口随负载自适应:
+ * - 空闲时 (没有正在执行的批次、队列为空、最近一个窗口内无其他请求)
+ *   请求立即执行，不增加延迟
+ * - 有批次正在执行时，新请求在队列中累积，上一批结束后立即成批执行
+ * - 其余情况最多等待 window_ms，或在达到批大小/字符预算时提前执行
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "internal/tts_types.hpp"
+
+namespace tts {
+
+// =============================================================================
+// BatcherConfig (批处理配置)
+// =============================================================================
+
+struct BatcherConfig {
+    int window_ms = 5;              // 最长等待窗口 (毫秒)
+    int max_batch_size = 8;         // 单批最大请求数
+    int max_batch_chars = 1024;     // 单批填充后字符数上限 (最长文本字符数 × 条数)
+};
+
+// =============================================================================
+// DynamicBatcher (动态批处理器)
+// =============================================================================
+
+class DynamicBatcher {
+public:
+    /// 执行一批请求: speaker_ids 与 results 需与 texts 一一对应, 整批语速相同
+    using BatchRunner = std::function<void(const std::vector<std::string>& texts,
+                                           const std::vector<int>& speaker_ids, float speed,
+                                           std::vector<SynthesisResult>& results)>;
+
+    DynamicBatcher(const BatcherConfig& config, BatchRunner runner);
+    ~DynamicBatcher();
+
+    DynamicBatcher(const DynamicBatcher&) = delete;
+    DynamicBatcher& operator=(const DynamicBatcher&) = delete;
+
+    /// @brief 提交请求并阻塞等待结果 (可从多个线程同时调用)
+    /// @param speaker_id 本请求的说话人 (同一批中可以各不相同)
+    /// @param speed 本请求的语速 (只与语速相同的请求合并)
+    SynthesisResult submit(const std::string& text, int speaker_id, float speed);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request {
+        std::string text;
+        int speaker_id = 0;
+        float speed = 1.0f;
+        size_t length = 0;              // UTF-8 字符数
+        Clock::time_point arrival;
+        bool immediate = false;         // 到达时系统空闲, 不等待窗口
+        std::promise<SynthesisResult> promise;
+    };
+
+    void dispatchLoop();
+
+    /// @brief 队列已满足批大小或字符预算 (调用方持有锁)
+    bool batchReady() const;
+
+    /// @brief 以队首请求为基准, 取出长度相近的一批 (调用方持有锁)
+    std::vector<std::shared_ptr<Request>> takeBatch();
+
+    void runBatch(const std::vector<std::shared_ptr<Request>>& batch);
+
+    BatcherConfig config_;
+    BatchRunner runner_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::shared_ptr<Request>> queue_;
+    Clock::time_point last_arrival_;
+    bool busy_ = false;
+    bool stop_ = false;
+
+    std::thread thread_;
+};
+
+}  // namespace tts
+
+#endif  // TTS_BATCHER_HPP
@@ -1,8 +1,11 @@
 #ifndef TTS_CONFIG_HPP
 #define TTS_CONFIG_HPP
 
+#include <map>
 #include <string>
+#include <vector>
 
+#include "tts_model_memory.hpp"
 #include "tts_types.hpp"
 
 namespace tts {
@@ -60,13 +63,48 @@ struct TtsConfig {
     float compression_ratio = 2.0f;     ///< 压缩比
     bool use_rms_norm = true;           ///< 使用RMS归一化
     bool remove_clicks = true;          ///< 移除爆音
+    bool trim_silence = true;           ///< 裁剪首尾静音 (降低首包延迟)
+    float silence_threshold_db = -50.0f;  ///< 静音判定阈值 (帧 RMS, dBFS)
+    int sentence_gap_ms = 150;          ///< 句间静音间隔 (毫秒, 仅逐句合成时插入)
+
+    // -------------------------------------------------------------------------
+    // 流式合成
+    // -------------------------------------------------------------------------
+
+    int stream_chunk_frames = 64;       ///< 流式合成每块 mel 帧数
+    int frontend_lookahead = 2;         ///< 逐句流式合成时前端提前处理的句数, 0=不预取
+
+    // -------------------------------------------------------------------------
+    // 形状分桶
+    // -------------------------------------------------------------------------
+
+    std::vector<int> token_buckets;     ///< 声学模型 token 长度分桶边界, 空则不分桶
+    std::vector<int> mel_frame_buckets; ///< 声码器 mel 帧数分桶边界, 空则不分桶
+    std::string vocoder_istft = "auto"; ///< 声码器 ISTFT 位置: "auto" / "graph" / "cpp"
 
     // -------------------------------------------------------------------------
     // 性能配置
     // -------------------------------------------------------------------------
 
     int num_threads = 2;                ///< 推理线程数
+    std::vector<std::string> execution_providers;   ///< 按优先级排列的执行提供器, 空则只用 CPU
+    std::map<std::string, std::map<std::string, std::string>> provider_options;  ///< 各执行提供器的选项
     bool enable_warmup = true;          ///< 启动时预热
+    bool model_prefetch = true;         ///< 初始化时后台预读模型文件
+    bool model_mlock = false;           ///< 锁定权重与推理缓存, 不被换出
+    bool model_huge_pages = false;      ///< 权重与推理缓存使用透明大页
+    bool shared_allocator = true;       ///< 使用进程级共享的 ORT CPU 分配器
+    int arena_max_mb = 0;               ///< 共享 arena 容量上限 (MB), 0=不限制
+    std::string engine_tag = "engine";  ///< 引擎标识 (ORT 会话日志标识前缀)
+
+    /// @brief 模型内存驻留配置
+    ModelMemoryConfig memoryConfig() const {
+        ModelMemoryConfig memory_config;
+        memory_config.prefetch = model_prefetch;
+        memory_config.lock = model_mlock;
+        memory_config.huge_pages = model_huge_pages;
+        return memory_config;
+    }
 
     // -------------------------------------------------------------------------
     // 便捷构建方法
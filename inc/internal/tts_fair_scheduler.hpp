@@ -0,0 +1,171 @@
+#ifndef TTS_FAIR_SCHEDULER_HPP
+#define TTS_FAIR_SCHEDULER_HPP
+
+/**
+ * FairScheduler - 按租户加权公平调度
+ *
+ * 多租户共用一个引擎时, 请求按句切成片段, 每个片段在执行前向调度器申请
+ * 执行槽。调度采用起始时间公平排队 (start-time fair queuing):
+ * - 片段入队时打上起始标签 S = max(V, 该租户上一片段的结束标签),
+ *   结束标签 F = S + 代价 / 权重 (代价为字符数); V 为最近开始执行的片段的起始标签
+ * - 有空闲槽时执行起始标签最小的片段, 同一租户的片段先到先服务
+ * - 空闲后重新到达的租户从 V 开始排队, 不能用空闲期积累的份额插队
+ *
+ * 因此批量任务再长, 其他租户的一个片段最多等待约 "槽数 × 各租户一个片段" 的时间。
+ *
+ * 配额:
+ * - max_in_flight: 租户同时处理的请求数上限, 超出的请求在进入时等待
+ * - audio_seconds_per_second: 令牌桶, 片段完成后按实际音频时长扣除;
+ *   余额为负的租户暂不参与调度, 直到按速率补回
+ *
+ * 未设置配额的租户空闲 (无在途请求、无排队片段) 超过 idle_ttl 后被移除, 统计随之清零;
+ * 租户 ID 来自请求方时, 租户表不会随历史租户数无限增长。此类租户重新到达时从 V 开始排队,
+ * 与保留条目时的调度结果相同。设置过配额的租户一直保留。
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tts {
+
+// =============================================================================
+// TenantLimits (租户配额)
+// =============================================================================
+
+struct TenantLimits {
+    double weight = 1.0;                    // 调度权重, 按比例分享执行时间
+    int max_in_flight = 0;                  // 同时处理的请求数上限, 0=不限
+    double audio_seconds_per_second = 0.0;  // 每秒可合成的音频秒数, 0=不限
+    double audio_burst_seconds = 5.0;       // 令牌桶容量 (音频秒数)
+};
+
+// =============================================================================
+// TenantCounters (租户统计)
+// =============================================================================
+
+struct TenantCounters {
+    std::string tenant;
+    double weight = 1.0;
+    int in_flight = 0;                      // 正在处理的请求数
+    int waiting_requests = 0;               // 因 max_in_flight 等待进入的请求数
+    int queued_segments = 0;                // 等待执行槽的片段数
+    bool throttled = false;                 // 音频配额用尽, 暂不参与调度
+    uint64_t requests = 0;                  // 已完成的请求数
+    uint64_t segments = 0;                  // 已执行的片段数
+    uint64_t audio_ms = 0;                  // 累计合成音频 (毫秒)
+    uint64_t busy_ms = 0;                   // 累计执行耗时 (毫秒)
+    uint64_t wait_ms = 0;                   // 片段累计排队耗时 (毫秒)
+    uint64_t max_wait_ms = 0;               // 单个片段最长排队耗时 (毫秒)
+};
+
+// =============================================================================
+// FairScheduler (公平调度器)
+// =============================================================================
+
+class FairScheduler {
+public:
+    /// @param max_concurrent 同时执行的片段数 (动态批处理时为批大小)
+    /// @param idle_ttl 未设置配额的租户空闲多久后移除
+    explicit FairScheduler(int max_concurrent,
+                           std::chrono::milliseconds idle_ttl = std::chrono::minutes(10));
+
+    FairScheduler(const FairScheduler&) = delete;
+    FairScheduler& operator=(const FairScheduler&) = delete;
+
+    /// @brief 设置租户配额 (未设置的租户权重为 1, 不限流)
+    void setLimits(const std::string& tenant, const TenantLimits& limits);
+
+    /// @brief 各租户统计快照 (按租户名排序)
+    std::vector<TenantCounters> stats() const;
+
+    /// 请求作用域: 构造时等待租户在途请求数低于 max_in_flight
+    class RequestScope {
+    public:
+        RequestScope(FairScheduler& scheduler, const std::string& tenant);
+        ~RequestScope();
+
+        RequestScope(const RequestScope&) = delete;
+        RequestScope& operator=(const RequestScope&) = delete;
+
+    private:
+        FairScheduler& scheduler_;
+        std::string tenant_;
+    };
+
+    /// 片段作用域: 构造时等待调度到该片段, 析构时归还执行槽并扣除音频配额
+    class SegmentScope {
+    public:
+        /// @param cost 计算量估计 (字符数)
+        SegmentScope(FairScheduler& scheduler, const std::string& tenant, double cost);
+        ~SegmentScope();
+
+        SegmentScope(const SegmentScope&) = delete;
+        SegmentScope& operator=(const SegmentScope&) = delete;
+
+        /// @brief 记录片段合成的音频时长, 析构时扣除配额
+        void setAudioMs(int64_t audio_ms) { audio_ms_ = audio_ms; }
+
+    private:
+        FairScheduler& scheduler_;
+        std::string tenant_;
+        std::chrono::steady_clock::time_point start_;
+        int64_t audio_ms_ = 0;
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Waiter {
+        uint64_t seq = 0;                   // 入队顺序 (标签相同时先到先服务)
+        double start_tag = 0.0;
+    };
+
+    struct Tenant {
+        TenantLimits limits;
+        bool configured = false;            // 调用过 setLimits, 不会被移除
+        double finish_tag = 0.0;
+        double tokens = 0.0;                // 音频配额余额 (秒)
+        Clock::time_point refilled;
+        Clock::time_point last_active;      // 最近一次请求或片段结束的时间
+        int running = 0;                    // 正在执行的片段数
+        std::deque<Waiter*> queue;
+        TenantCounters counters;
+    };
+
+    Tenant& tenantLocked(const std::string& name);
+
+    /// @brief 移除空闲超过 idle_ttl 的未配置租户, 每 idle_ttl / 4 最多扫描一次 (调用方持有锁)
+    void evictIdleLocked(Clock::time_point now);
+
+    /// @brief 按速率补充音频配额 (调用方持有锁)
+    void refillLocked(Tenant& tenant, Clock::time_point now);
+
+    /// @brief 选出下一个执行的片段; 都被限流时返回 nullptr 并给出最早可恢复的时间 (调用方持有锁)
+    Waiter* pickLocked(Clock::time_point now, Clock::time_point& retry_at);
+
+    void enterRequest(const std::string& tenant);
+    void leaveRequest(const std::string& tenant);
+    void acquireSegment(const std::string& tenant, double cost);
+    void releaseSegment(const std::string& tenant, int64_t audio_ms, int64_t busy_ms);
+
+    const int max_concurrent_;
+    const Clock::duration idle_ttl_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<std::string, Tenant> tenants_;   // 未配置的空闲租户按 idle_ttl 移除
+    Clock::time_point last_eviction_;
+    double virtual_time_ = 0.0;
+    uint64_t next_seq_ = 0;
+    int running_ = 0;
+};
+
+}  // namespace tts
+
+#endif  // TTS_FAIR_SCHEDULER_HPP
@@ -0,0 +1,107 @@
+#ifndef TTS_MODEL_MEMORY_HPP
+#define TTS_MODEL_MEMORY_HPP
+
+/**
+ * ModelMemory - 模型权重的内存驻留控制
+ *
+ * 冷启动或内存紧张之后，首个请求会在数百 MB 权重上逐页缺页，表现为数秒的
+ * 延迟尖峰。本类为后端提供三种驻留手段:
+ * - 预读: 初始化开始时对全部模型文件发出 POSIX_FADV_WILLNEED，内核在后台
+ *   读入页缓存，与 ORT 环境创建、词典加载等并行
+ * - 大页: 对加载期间新增的大块匿名内存 (ORT 初始化器、arena) 设置
+ *   MADV_HUGEPAGE，减少 TLB 未命中
+ * - 锁定: 对同一批区域 mlock，权重不会被换出 (受 RLIMIT_MEMLOCK 限制，
+ *   失败时打印警告并继续)
+ *
+ * ORT 从 .onnx 加载时把权重复制到自己分配的内存中，因此大页与锁定作用于
+ * 加载期间新出现的匿名映射 (通过比较加载前后的 /proc/self/maps 识别)，
+ * 而不是模型文件本身的映射。识别范围的约束:
+ * - 进程内的加载过程互斥执行，各引擎只得到自己加载期间新增的区域
+ * - 与保护页相邻的映射 (线程栈、glibc 线程 malloc 堆) 与 2 MB 以下的映射不计入
+ * - 使用进程共享分配器时，arena 属于所有引擎: 只跟踪会话创建
+ *   (初始化器由会话自己的设备分配器分配，不进入共享 arena)，预热等推理不跟踪
+ * - 调用方需保证加载期间本引擎没有推理在进行 (初始化与 Reload 时成立)；
+ *   其他线程在此期间新映射的大块内存无法与本会话的分配区分，仍可能被计入，
+ *   例如 Reload 时其他引擎推理使共享 arena 增长。lock 开启时这部分内存也会被锁定
+ *
+ * 非 Linux 平台上各操作为空操作，统计全部为 0。
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tts {
+
+// =============================================================================
+// ModelMemoryConfig (驻留配置)
+// =============================================================================
+
+struct ModelMemoryConfig {
+    bool prefetch = true;               // 初始化时后台预读模型文件
+    bool lock = false;                  // mlock 权重与 arena 区域
+    bool huge_pages = false;            // 对权重与 arena 区域启用透明大页
+};
+
+// =============================================================================
+// ModelMemoryStats (驻留统计)
+// =============================================================================
+
+struct ModelMemoryStats {
+    size_t mapped_bytes = 0;            // 跟踪区域映射的总字节数
+    size_t resident_bytes = 0;          // 其中当前驻留物理内存的字节数
+    size_t locked_bytes = 0;            // 其中已 mlock 的字节数
+};
+
+// =============================================================================
+// ModelMemory
+// =============================================================================
+
+class ModelMemory {
+public:
+    explicit ModelMemory(const ModelMemoryConfig& config = ModelMemoryConfig());
+
+    ModelMemory(const ModelMemory&) = delete;
+    ModelMemory& operator=(const ModelMemory&) = delete;
+
+    /// @brief 重新配置并清空跟踪区域 (后端重新初始化时调用)
+    void reset(const ModelMemoryConfig& config);
+
+    /// @brief 对模型文件发出后台预读 (立即返回)
+    void prefetch(const std::vector<std::string>& files) const;
+
+    /**
+     * @brief 执行加载过程 (创建会话、预热)，并跟踪期间新增的大块匿名内存
+     * @note 进程内所有 ModelMemory 的 track 互斥执行, 加载过程中不要再调用 track
+     */
+    void track(const std::function<void()>& load);
+
+    /**
+     * @brief 执行加载阶段的推理 (预热等)，arena 为本会话所有时跟踪其增长
+     * @param shared_arena 会话使用进程共享分配器: 直接执行, 共享 arena 不归入本引擎的区域
+     */
+    void trackInference(bool shared_arena, const std::function<void()>& run);
+
+    /// @brief 统计跟踪区域的映射、驻留与锁定字节数 (已释放的区域自动剔除)
+    ModelMemoryStats stats() const;
+
+private:
+    struct Region {
+        uintptr_t begin = 0;
+        uintptr_t end = 0;
+        bool locked = false;
+    };
+
+    ModelMemoryConfig config_;
+
+    mutable std::mutex mutex_;
+    mutable std::vector<Region> regions_;
+};
+
+}  // namespace tts
+
+#endif  // TTS_MODEL_MEMORY_HPP
@@ -0,0 +1,93 @@
+#ifndef TTS_ORT_ENV_HPP
+#define TTS_ORT_ENV_HPP
+
+/**
+ * OrtEnvironment - 进程级共享的 ONNX Runtime 环境
+ *
+ * 每个 Ort::Session 默认持有独立的 CPU arena，多个引擎并存时空闲引擎的 arena
+ * 占着内存，繁忙引擎却用不上。进程内所有后端共用一个 Ort::Env，并在其上注册
+ * 一个共享的 CPU 分配器 (session.use_env_allocators)，进程内存随并发推理的
+ * 峰值增长，而不是随引擎数量增长。
+ *
+ * - 首个获取者创建环境并按其配置注册分配器，之后的获取者复用 (配置不同时打印提示)
+ * - 最后一个持有者释放后环境与共享 arena 一并销毁 (例如所有引擎都已空闲卸载)
+ * - 每个会话设置日志标识 "<engine_tag>:<会话名>"，ORT 日志与性能分析可按引擎区分
+ *
+ * 执行提供器 (EP) 按配置顺序注册，CPU 总是隐式兜底。每个会话单独回退:
+ * EP 无法加载时跳过；带 EP 创建会话失败 (如拒绝模型中的算子) 时去掉首选 EP 重试。
+ */
+
+#include <onnxruntime_cxx_api.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tts {
+
+// =============================================================================
+// OrtEnvConfig (共享环境配置)
+// =============================================================================
+
+struct OrtEnvConfig {
+    bool shared_allocator = true;       // 注册共享 CPU 分配器, false 时各会话使用自己的 arena
+    size_t arena_max_bytes = 0;         // 共享 arena 容量上限, 0 表示不限制
+};
+
+// =============================================================================
+// ExecutionProviderConfig (执行提供器配置)
+// =============================================================================
+
+struct ExecutionProviderConfig {
+    /// 按优先级排列的 EP 名称 (如 "spacemit", "xnnpack", "cpu")，不区分大小写
+    std::vector<std::string> providers;
+    /// 各 EP 的选项, 键为 EP 名称 (小写)
+    std::map<std::string, std::map<std::string, std::string>> options;
+};
+
+// =============================================================================
+// OrtEnvironment
+// =============================================================================
+
+class OrtEnvironment {
+public:
+    /**
+     * @brief 获取进程级共享环境，不存在时创建
+     * @param config 仅在创建时生效
+     */
+    static std::shared_ptr<OrtEnvironment> acquire(const OrtEnvConfig& config);
+
+    OrtEnvironment(const OrtEnvironment&) = delete;
+    OrtEnvironment& operator=(const OrtEnvironment&) = delete;
+
+    /// @brief 是否已注册共享分配器
+    bool sharedAllocator() const { return config_.shared_allocator; }
+
+    /**
+     * @brief 按执行提供器优先级创建会话, 失败时逐级回退, 最终回退到 CPU
+     * @param model_path 模型路径
+     * @param base_options 基础会话选项 (线程数、优化级别等, 不修改)
+     * @param providers 执行提供器配置
+     * @param log_id 日志标识
+     * @return 会话 (CPU 也无法创建时抛出 Ort::Exception)
+     */
+    std::unique_ptr<Ort::Session> createSession(const std::string& model_path,
+                                                const Ort::SessionOptions& base_options,
+                                                const ExecutionProviderConfig& providers,
+                                                const std::string& log_id) const;
+
+private:
+    explicit OrtEnvironment(const OrtEnvConfig& config);
+
+    /// 使用共享分配器并设置日志标识 (通常为 "<engine_tag>:<会话名>")
+    void configureSession(Ort::SessionOptions& options, const std::string& log_id) const;
+
+    Ort::Env env_;
+    OrtEnvConfig config_;
+};
+
+}  // namespace tts
+
+#endif  // TTS_ORT_ENV_HPP
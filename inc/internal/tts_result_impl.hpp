@@ -0,0 +1,30 @@
+#ifndef TTS_RESULT_IMPL_HPP
+#define TTS_RESULT_IMPL_HPP
+
+/**
+ * TtsEngineResult::Impl - 合成结果内部数据
+ *
+ * 引擎与客户端 (TtsClient) 共用，用于直接填充结果对象。
+ */
+
+#include <string>
+#include <vector>
+
+#include "tts_api.hpp"
+
+namespace Evo {
+
+struct TtsEngineResult::Impl {
+    std::vector<float> audio_float;
+    int sample_rate = 22050;
+    int duration_ms = 0;
+    int processing_time_ms = 0;
+    bool success = false;
+    bool is_sentence_end = false;
+    std::string message;
+    std::string request_id;
+};
+
+}  // namespace Evo
+
+#endif  // TTS_RESULT_IMPL_HPP
@@ -0,0 +1,75 @@
+#ifndef TTS_SINGLE_FLIGHT_HPP
+#define TTS_SINGLE_FLIGHT_HPP
+
+/**
+ * SingleFlight - 相同请求合并执行
+ *
+ * 同一缓存键的并发请求只执行一次合成: 第一个到达的请求 (leader) 在自己的
+ * 线程中执行合成，后到的请求 (follower) 挂到这次在途合成上，按顺序收到全部
+ * 音频块 (加入前已产生的块会先补发)，最后得到相同的结果。
+ *
+ * 取消: 订阅者通过 ITtsCallback::isCancelled() 报告取消，取消后不再收到音频。
+ * 只有当所有订阅者都已取消时，共享的合成才会中止；leader 自己取消时，
+ * 它的线程继续为其余订阅者执行合成。
+ */
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "internal/tts_types.hpp"
+
+namespace tts {
+
+class SingleFlight {
+public:
+    /// 执行合成: 音频块写入 sink (sink.isCancelled() 为 true 时应尽快返回)
+    using Work = std::function<ErrorInfo(ITtsCallback& sink)>;
+
+    SingleFlight() = default;
+    SingleFlight(const SingleFlight&) = delete;
+    SingleFlight& operator=(const SingleFlight&) = delete;
+
+    /**
+     * @brief 执行或加入 key 对应的在途合成
+     * @param key 合并键 (与音频缓存键相同)
+     * @param subscriber 接收音频块 (onAudioChunk) 并报告取消 (isCancelled)
+     * @param work 没有在途合成时由当前线程执行
+     * @return 合成结果; 当前订阅者取消时返回 CANCELLED
+     */
+    ErrorInfo run(const std::string& key, ITtsCallback& subscriber, const Work& work);
+
+    /// @brief 当前在途合成数
+    size_t inflight() const;
+
+private:
+    struct Flight {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<std::shared_ptr<const AudioChunk>> chunks;   // 已产生的块, 供后加入者补发
+        int active = 1;                 // 未取消的订阅者数 (含 leader)
+        bool abandoned = false;         // 所有订阅者均已取消, 合成应中止
+        bool done = false;
+        ErrorInfo error = ErrorInfo::ok();
+    };
+
+    class LeaderSink;
+
+    ErrorInfo lead(const std::string& key, const std::shared_ptr<Flight>& flight,
+                   ITtsCallback& subscriber, const Work& work);
+    ErrorInfo follow(const std::shared_ptr<Flight>& flight, ITtsCallback& subscriber);
+
+    /// 订阅者取消: 减少活跃计数, 归零时标记整个合成放弃 (调用方持有 flight 锁)
+    static void detachLocked(Flight& flight);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<Flight>> flights_;
+};
+
+}  // namespace tts
+
+#endif  // TTS_SINGLE_FLIGHT_HPP
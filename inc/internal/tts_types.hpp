@@ -55,7 +55,7 @@ enum class BackendType {
 
     // 预留扩展
     COSYVOICE,          // CosyVoice
-    VITS,               // VITS
+    VITS,               // VITS (Piper 格式导出)
     PIPER,              // Piper TTS
     KOKORO,             // Kokoro TTS
     CUSTOM,             // 自定义后端
@@ -109,6 +109,7 @@ enum class ErrorCode {
     SYNTHESIS_FAILED = 203,
     TIMEOUT = 204,
     TEXT_TOO_LONG = 205,
+    CANCELLED = 206,
 
     // 网络错误 (3xx) - 用于云端模式
     NETWORK_ERROR = 300,
@@ -135,6 +136,7 @@ inline const char* errorCodeToString(ErrorCode code) {
         case ErrorCode::SYNTHESIS_FAILED:   return "SYNTHESIS_FAILED";
         case ErrorCode::TIMEOUT:            return "TIMEOUT";
         case ErrorCode::TEXT_TOO_LONG:      return "TEXT_TOO_LONG";
+        case ErrorCode::CANCELLED:          return "CANCELLED";
         case ErrorCode::NETWORK_ERROR:      return "NETWORK_ERROR";
         case ErrorCode::CONNECTION_FAILED:  return "CONNECTION_FAILED";
         case ErrorCode::AUTH_FAILED:        return "AUTH_FAILED";
@@ -341,6 +343,9 @@ public:
 
     /// @brief 会话关闭
     virtual void onClose() {}
+
+    /// @brief 调用方是否已取消 (流式合成在每块之间查询, 返回 true 时尽快结束)
+    virtual bool isCancelled() const { return false; }
 };
 
 }  // namespace tts
@@ -34,9 +34,12 @@
  *   stream->Complete();
  */
 
+#include <cstddef>
 #include <cstdint>
 
 #include <functional>
+#include <iosfwd>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -73,12 +76,118 @@ enum class BackendType {
 
     // 预留扩展
     COSYVOICE,          ///< CosyVoice
-    VITS,               ///< VITS
-    PIPER,              ///< Piper TTS
+    VITS,               ///< VITS (Piper 格式导出, 与 PIPER 使用同一后端)
+    PIPER,              ///< Piper TTS (<voice>.onnx + <voice>.onnx.json)
     KOKORO,             ///< Kokoro TTS
     CUSTOM,             ///< 自定义后端
 };
 
+// =============================================================================
+// ResidencyState - 模型驻留状态
+// =============================================================================
+
+enum class ResidencyState {
+    RESIDENT,           ///< 模型已加载, 推理缓存保留
+    TRIMMED,            ///< 模型已加载, 推理缓存已释放
+    UNLOADED,           ///< 模型与词典已卸载, 下次请求时重新加载
+};
+
+// =============================================================================
+// PreloadProgress - 缓存预加载进度
+// =============================================================================
+
+struct PreloadProgress {
+    int total = 0;          ///< 清单条目数
+    int completed = 0;      ///< 已处理条目数 (含失败)
+    int synthesized = 0;    ///< 新合成的条目数
+    int from_cache = 0;     ///< 已在缓存中 (内存或磁盘) 的条目数
+    int failed = 0;         ///< 合成失败的条目数
+    bool finished = false;  ///< 预加载已结束 (未配置清单时也为 true)
+};
+
+// =============================================================================
+// ModelMemoryStats - 模型内存驻留统计
+// =============================================================================
+
+struct ModelMemoryStats {
+    size_t mapped_bytes = 0;    ///< 权重与推理缓存占用的映射字节数
+    size_t resident_bytes = 0;  ///< 其中当前驻留物理内存的字节数
+    size_t locked_bytes = 0;    ///< 其中已锁定 (mlock) 的字节数
+};
+
+// =============================================================================
+// DocumentProgress - 长文档合成进度
+// =============================================================================
+
+/**
+ * @brief 长文档合成进度, 同时是续合成位置
+ *
+ * byte_offset 与 audio_samples 总在句子边界上一一对应: 输入的前 byte_offset 字节
+ * 合成的音频恰好是 sink 中的前 audio_samples 个样本。
+ */
+struct DocumentProgress {
+    uint64_t byte_offset = 0;       ///< 已写出的文本结束位置 (从首次调用时的输入位置计)
+    uint64_t audio_samples = 0;     ///< 对应的累计样本数 (含续合成前已有的部分)
+    int sample_rate = 0;            ///< 采样率 (Hz)
+    size_t sentences = 0;           ///< 本次调用已合成的句数
+    bool finished = false;          ///< 已读到输入结尾并全部写出
+    bool success = true;            ///< 读取、合成或写入是否出错
+    std::string message;            ///< 错误信息
+
+    /// @brief byte_offset 对应的音频时间 (毫秒)
+    int64_t AudioMs() const {
+        return sample_rate > 0 ? static_cast<int64_t>(audio_samples * 1000 / sample_rate) : 0;
+    }
+};
+
+// =============================================================================
+// DocumentOptions - 长文档合成选项
+// =============================================================================
+
+struct DocumentOptions {
+    uint64_t start_offset = 0;          ///< 从该字节位置续合成 (上次进度的 byte_offset), 0=从头
+    uint64_t start_audio_samples = 0;   ///< sink 中已有的样本数 (上次进度的 audio_samples)
+    size_t read_chunk_bytes = 64 * 1024;  ///< 每次读取的字节数
+    int max_pending_sentences = 16;     ///< 已分句、等待合成的句数上限 (限制内存)
+    size_t max_sentence_bytes = 2048;   ///< 没有句末标点时在此长度内按逗号/空白强制切分
+    std::string tenant_id;              ///< 租户 (启用 tenant_scheduling 时每批句子参与公平调度)
+
+    /// 每写出一批句子后调用; 返回 false 停止合成 (进度可用于续合成)
+    std::function<bool(const DocumentProgress&)> on_progress;
+};
+
+// =============================================================================
+// TenantQuota - 租户配额
+// =============================================================================
+
+struct TenantQuota {
+    double weight = 1.0;                    ///< 调度权重, 按比例分享合成时间
+    int max_in_flight = 0;                  ///< 同时处理的请求数上限, 0=不限; 超出的请求排队等待
+    double audio_seconds_per_second = 0.0;  ///< 每秒可合成的音频秒数上限, 0=不限
+    double audio_burst_seconds = 5.0;       ///< 音频配额的突发额度 (秒)
+};
+
+// =============================================================================
+// TenantStats - 租户统计
+// =============================================================================
+
+struct TenantStats {
+    std::string tenant_id;                  ///< 租户 (空字符串为未指定租户的请求)
+    double weight = 1.0;                    ///< 当前调度权重
+    int in_flight = 0;                      ///< 正在处理的请求数
+    int waiting_requests = 0;               ///< 因 max_in_flight 排队的请求数
+    int queued_segments = 0;                ///< 等待调度的句子数
+    bool throttled = false;                 ///< 音频配额已用尽, 暂停调度
+    uint64_t requests = 0;                  ///< 已完成请求数
+    uint64_t segments = 0;                  ///< 已合成句子数
+    uint64_t audio_ms = 0;                  ///< 累计合成音频时长 (毫秒)
+    uint64_t busy_ms = 0;                   ///< 累计合成耗时 (毫秒)
+    uint64_t wait_ms = 0;                   ///< 句子累计排队耗时 (毫秒)
+    uint64_t max_wait_ms = 0;               ///< 单句最长排队耗时 (毫秒)
+};
+
+class AudioSink;
+
 // =============================================================================
 // TtsConfig - TTS 配置
 // =============================================================================
@@ -125,13 +234,84 @@ struct TtsConfig {
     float compression_ratio = 2.0f;     ///< 压缩比
     bool use_rms_norm = true;           ///< 使用RMS归一化
     bool remove_clicks = true;          ///< 移除爆音
+    bool trim_silence = true;           ///< 裁剪首尾静音 (降低首包延迟)
+    float silence_threshold_db = -50.0f;  ///< 静音判定阈值 (帧 RMS, dBFS)
+    /// 句间静音间隔 (毫秒); 只在逐句合成时插入: 流式合成、长文档合成、租户调度。
+    /// 非流式 Call/CallMany 整段合成, 不插入
+    int sentence_gap_ms = 150;
+
+    // -------------------------------------------------------------------------
+    // 流式合成
+    // -------------------------------------------------------------------------
+
+    int stream_chunk_frames = 64;       ///< 流式合成每块 mel 帧数 (Matcha 22050Hz 下约 0.74 秒)
+    int frontend_lookahead = 2;         ///< 逐句流式合成时前端提前处理的句数, 0=不预取
+
+    // -------------------------------------------------------------------------
+    // 形状分桶 (Matcha)
+    // -------------------------------------------------------------------------
+
+    /// 声学模型输入按 token 数填充到不小于它的最小边界 (如 {32, 64, 128, 256}),
+    /// x_length 保持实际长度; 超过最大边界时不填充。空则不分桶
+    std::vector<int> token_buckets;
+    /// 声码器输入按 mel 帧数填充到分桶边界 (如 {128, 256, 512, 1024}), 输出裁回实际长度。空则不分桶
+    std::vector<int> mel_frame_buckets;
+
+    /// 声码器 ISTFT 的执行位置 (Matcha): "cpp" 在 C++ 中逐帧计算; "graph" 使用模型目录中
+    /// 追加了 ISTFT 的 vocos-*-istft.onnx (由 python/tools/add_vocos_istft.py 生成);
+    /// "auto" 两者都存在时初始化时各测一次, 保留较快的一个
+    std::string vocoder_istft = "auto";
 
     // -------------------------------------------------------------------------
     // 性能配置
     // -------------------------------------------------------------------------
 
     int num_threads = 2;                ///< 推理线程数
+    /// 按优先级排列的执行提供器 (如 {"spacemit", "xnnpack", "cpu"}), 空则只用 CPU;
+    /// 每个会话单独回退: 无法加载或拒绝模型时使用下一个, CPU 总是兜底
+    std::vector<std::string> execution_providers;
+    /// 各执行提供器的选项, 如 provider_options["xnnpack"]["intra_op_num_threads"] = "4"
+    std::map<std::string, std::map<std::string, std::string>> provider_options;
     bool enable_warmup = true;          ///< 启动时预热
+    bool model_prefetch = true;         ///< 初始化时后台预读模型文件 (posix_fadvise WILLNEED)
+    /// 锁定权重与推理缓存 (mlock), 不被换出; 受 RLIMIT_MEMLOCK 限制。
+    /// 加载期间其他线程新映射的大块内存无法区分, 也可能被锁定 (见 API.md "模型内存驻留")
+    bool model_mlock = false;
+    bool model_huge_pages = false;      ///< 权重与推理缓存使用透明大页 (MADV_HUGEPAGE)
+    bool shared_allocator = true;       ///< 进程内所有引擎的 ORT 会话共用一个 CPU 分配器 (arena)
+    int arena_max_mb = 0;               ///< 共享 arena 容量上限 (MB), 0=不限制; 由进程内首个引擎决定
+    std::string engine_tag;             ///< 引擎标识, 用于 ORT 日志与统计归属; 空则自动生成 "engine-N"
+
+    // -------------------------------------------------------------------------
+    // 空闲策略
+    // -------------------------------------------------------------------------
+
+    int idle_trim_ms = 0;               ///< 空闲多久后释放推理缓存 (ORT arena), 0=不启用
+    int idle_unload_ms = 0;             ///< 空闲多久后卸载模型与词典, 0=不启用; 下次请求自动重新加载
+
+    // -------------------------------------------------------------------------
+    // 动态批处理
+    // -------------------------------------------------------------------------
+
+    int batch_window_ms = 0;            ///< 并发请求合并等待窗口 (毫秒), 0=不启用; 空闲时请求不等待
+    int max_batch_size = 8;             ///< 单批最大请求数
+    int max_batch_chars = 1024;         ///< 单批填充后字符数上限 (最长文本字符数 × 条数)
+
+    // -------------------------------------------------------------------------
+    // 音频缓存与预加载
+    // -------------------------------------------------------------------------
+
+    int cache_max_mb = 0;               ///< 合成结果内存缓存容量 (MB), 0=不启用
+    std::string cache_dir;              ///< 缓存持久化目录, 空则只缓存在内存中
+    std::string preload_manifest;       ///< 预加载清单 (每行一条提示音), 需启用缓存
+    bool preload_async = true;          ///< 后台预加载, 让位于实时请求; false 则在构造时同步完成
+    bool coalesce_requests = true;      ///< 相同文本的并发请求只合成一次, 结果分发给所有请求方
+
+    // -------------------------------------------------------------------------
+    // 多租户调度
+    // -------------------------------------------------------------------------
+
+    bool tenant_scheduling = false;     ///< 按租户加权公平调度: 请求按句切分, 各租户按权重轮流执行 (见 CallAs)
 
     // -------------------------------------------------------------------------
     // 便捷构建方法
@@ -189,6 +369,20 @@ struct TtsConfig {
         return config;
     }
 
+    /// @brief 创建 Piper 配置
+    /// @param model_dir 模型目录路径 (存放 <voice>.onnx 与 <voice>.onnx.json)
+    /// @param voice 音色名称 ("default" 为目录中按名称排序的第一个)
+    static TtsConfig Piper(const std::string& model_dir = "~/.cache/piper-tts",
+                           const std::string& voice = "default") {
+        TtsConfig config;
+        config.backend = BackendType::PIPER;
+        config.model = "piper";
+        config.model_dir = model_dir;
+        config.voice = voice;
+        config.sample_rate = 22050;  // 实际采样率由音色配置决定
+        return config;
+    }
+
     // 链式配置
     TtsConfig withSpeed(float speed) const {
         auto c = *this;
@@ -240,6 +434,10 @@ public:
     /// @return 音频数据
     std::vector<int16_t> GetAudioInt16() const;
 
+    /// @brief 获取音频数据（float格式, 不拷贝）
+    /// @return 结果对象内部的样本, 在结果对象销毁前有效
+    const std::vector<float>& GetAudioFloatRef() const;
+
     // -------------------------------------------------------------------------
     // 元信息
     // -------------------------------------------------------------------------
@@ -311,6 +509,8 @@ public:
 
 private:
     friend class TtsEngine;
+    friend class TtsClient;
+    friend class TtsAudioStream;
     friend class CallbackAdapter;
 
     struct Impl;
@@ -354,6 +554,11 @@ private:
  *   OnOpen() → ... → OnError() → OnClose()
  * ```
  *
+ * ## 取消
+ *
+ * 重写 IsCancelled() 并在需要时返回 true (例如通话已挂断)，引擎在下一块音频前停止，
+ * 以 OnError("Cancelled") → OnClose() 结束。
+ *
  * ## 线程安全
  *
  * - 回调可能在引擎内部线程中被调用，实现时需注意线程安全
@@ -410,6 +615,12 @@ public:
     /// @brief 会话关闭
     /// @note 无论正常结束还是错误，最后都会调用此方法
     virtual void OnClose() {}
+
+    /// @brief 是否已取消本次合成
+    /// @return true 表示调用方不再需要后续音频
+    /// @note 流式合成在每块音频之间查询; 取消后以 OnError("Cancelled") → OnClose() 结束。
+    ///       与其他请求合并执行时，只有所有请求方都取消后才中止合成
+    virtual bool IsCancelled() const { return false; }
 };
 
 // =============================================================================
@@ -485,6 +696,40 @@ public:
         const std::string& text,
         const TtsConfig& config = TtsConfig());
 
+    /// @brief 以指定说话人合成文本（阻塞直到完成），不改变 SetSpeaker 设置的默认说话人
+    /// @param text 要合成的文本
+    /// @param speaker_id 说话人ID [0, GetNumSpeakers())
+    /// @return 合成结果，失败返回 nullptr
+    /// @note 多说话人模型在同一会话内按请求切换说话人, 不同说话人的并发请求可合并为同一批;
+    ///       其他后端临时切换说话人 (独占执行)
+    std::shared_ptr<TtsEngineResult> Call(const std::string& text, int speaker_id);
+
+    /// @brief 合成多段文本（阻塞直到全部完成）
+    /// @param texts 文本列表
+    /// @param max_workers 并发数, 0 表示自动 (启用动态批处理时为 max_batch_size, 否则为 1)
+    /// @return 与 texts 一一对应的结果
+    /// @note 未启用动态批处理与租户调度时, 按长度相近分组, 每组一次批量推理;
+    ///       否则由 max_workers 个工作线程并发提交, 经批处理器合并
+    std::vector<std::shared_ptr<TtsEngineResult>> CallMany(const std::vector<std::string>& texts,
+                                                           int max_workers = 0);
+
+    /// @brief 同上, 每完成一条即回调 on_result(index, result)
+    /// @note 按完成顺序调用, 调用之间互斥 (来自工作线程);
+    ///       回调或合成抛出异常时, 其余线程不再领取新的分组, 全部结束后重新抛出第一个异常
+    void CallMany(const std::vector<std::string>& texts,
+                  const std::function<void(size_t, std::shared_ptr<TtsEngineResult>)>& on_result,
+                  int max_workers = 0);
+
+    /// @brief 以租户身份合成文本（阻塞直到完成）
+    /// @param tenant_id 租户, 用于公平调度与配额 (未启用 tenant_scheduling 时等同于 Call)
+    /// @param text 要合成的文本
+    /// @param speaker_id 说话人ID, -1 表示使用当前默认说话人
+    /// @return 合成结果
+    /// @note 启用 tenant_scheduling 时文本按句切分, 每句按租户权重排队执行,
+    ///       其他租户的大批量任务只增加有限的等待时间
+    std::shared_ptr<TtsEngineResult> CallAs(const std::string& tenant_id, const std::string& text,
+                                            int speaker_id = -1);
+
     /// @brief 合成文本并保存到文件
     /// @param text 要合成的文本
     /// @param file_path 输出文件路径
@@ -512,12 +757,33 @@ public:
         std::shared_ptr<TtsResultCallback> callback,
         const TtsConfig& config = TtsConfig());
 
+    // =========================================================================
+    // 长文档合成
+    // =========================================================================
+
+    /// @brief 分块读取文本流, 跨块分句后按批合成并依次写入 sink
+    /// @param input UTF-8 文本输入流 (如整本书的 std::ifstream)
+    /// @param sink 音频输出, 由本方法 Open / Close
+    /// @param options 续合成位置、读取块大小、进度回调
+    /// @return 最终进度; 出错或回调停止时为最后写出的位置, 可用于续合成
+    /// @note 读取与分句在后台线程中领先合成进行; 内存占用只与读取块大小和
+    ///       max_pending_sentences 有关, 与文档长度无关。续合成时 sink 需保留前
+    ///       start_audio_samples 个样本并在其后追加 (见 WavFileSink 的续写构造函数)
+    DocumentProgress SynthesizeStream(std::istream& input, AudioSink& sink,
+                                      const DocumentOptions& options = DocumentOptions());
+
+    /// @brief 同上, 从文件描述符读取 (文件、管道或套接字)
+    DocumentProgress SynthesizeStream(int fd, AudioSink& sink,
+                                      const DocumentOptions& options = DocumentOptions());
+
     // =========================================================================
     // 动态配置
     // =========================================================================
+    // 设置对之后开始的请求生效; 调用会等待正在执行的请求结束
 
     /// @brief 设置语速
     /// @param speed 语速倍率 (>1.0快, <1.0慢)
+    /// @note 等待在途请求结束后生效; 已开始的请求按开始时的语速/说话人完成
     void SetSpeed(float speed);
 
     /// @brief 设置说话人
@@ -532,6 +798,53 @@ public:
     /// @return 配置对象
     TtsConfig GetConfig() const;
 
+    // =========================================================================
+    // 资源管理
+    // =========================================================================
+
+    /// @brief 获取当前模型驻留状态
+    /// @return 驻留状态
+    ResidencyState GetResidencyState() const;
+
+    /// @brief 预唤醒: 预计即将有请求时提前在后台重新加载模型
+    /// @note 非阻塞; 已驻留时仅刷新空闲计时
+    void Prewake();
+
+    /// @brief 立即释放资源到指定级别 (TRIMMED 或 UNLOADED)
+    /// @param level 目标驻留状态
+    void ReleaseResources(ResidencyState level);
+
+    /// @brief 热重载模型: 在调用线程上加载并预热新配置的模型, 完成后原子换入
+    /// @param config 新配置 (批处理、缓存、空闲策略等引擎级参数保持构造时的值)
+    /// @return 是否成功; 失败时继续使用当前模型
+    /// @note 新请求立即使用新模型, 在途请求在旧模型上完成后旧模型释放;
+    ///       切换期间两份模型同时驻留
+    bool Reload(const TtsConfig& config);
+
+    /// @brief 模型文件 (大小、修改时间或首尾内容哈希) 变化时以当前配置热重载
+    /// @return 是否执行了重载 (文件未变化或重载失败时返回 false)
+    bool TryReloadIfChanged();
+
+    /// @brief 获取缓存预加载进度
+    /// @return 进度快照
+    PreloadProgress GetPreloadProgress() const;
+
+    /// @brief 获取模型权重与推理缓存的驻留统计
+    /// @return 映射、驻留与锁定字节数; 模型已卸载时全部为 0
+    ModelMemoryStats GetModelMemoryStats() const;
+
+    // =========================================================================
+    // 多租户调度
+    // =========================================================================
+
+    /// @brief 设置租户配额 (立即生效; 空字符串为未指定租户的请求)
+    /// @note 需启用 tenant_scheduling; 未设置的租户权重为 1 且不限流
+    void SetTenantQuota(const std::string& tenant_id, const TenantQuota& quota);
+
+    /// @brief 获取各租户统计 (未启用 tenant_scheduling 时为空)
+    /// @note 未设置配额的租户空闲 10 分钟后移除, 不再出现在统计中
+    std::vector<TenantStats> GetTenantStats() const;
+
     // =========================================================================
     // 辅助方法
     // =========================================================================
@@ -0,0 +1,234 @@
+#ifndef TTS_SERVER_HPP
+#define TTS_SERVER_HPP
+
+/**
+ * EvoTtsSDK - 多进程服务模式
+ *
+ * TtsWorkerPool 在主进程中初始化一次引擎 (模型、词典、词表)，
+ * 然后 fork 出 N 个工作进程。工作进程以写时复制方式共享主进程中
+ * 已加载的只读内存，从而以接近单进程的内存开销获得多进程隔离与多核扩展。
+ *
+ * 请求通过 Unix 域套接字分发: 所有工作进程在同一个监听套接字上 accept，
+ * 由内核负责在空闲进程之间分配连接。主进程 (supervisor) 只负责监控，
+ * 工作进程崩溃后自动重启。
+ *
+ * 注意:
+ * - fork 之后 ONNX Runtime 的线程池不可用，因此服务模式下每个工作进程
+ *   强制使用单线程推理 (num_threads = 1)，并行度由工作进程数提供。
+ * - 主进程在 Start() 之后不再执行推理，以免破坏共享页。
+ * - fork 前主进程不能有后台线程，因此服务模式下不启用空闲释放策略。
+ *
+ * 使用示例 (服务端):
+ *
+ *   Evo::WorkerPoolConfig pool_config;
+ *   pool_config.num_workers = 4;
+ *   Evo::TtsWorkerPool pool(Evo::TtsConfig::MatchaZH(), pool_config);
+ *   if (pool.Start()) {
+ *       pool.Run();  // 阻塞直到 Stop()
+ *   }
+ *
+ * 使用示例 (客户端):
+ *
+ *   Evo::TtsClient client("/tmp/evo_tts.sock");
+ *   auto result = client.Call("你好世界");
+ *   if (result && result->IsSuccess()) {
+ *       result->SaveToFile("output.wav");
+ *   }
+ *
+ * 使用示例 (共享内存流, 仅 Linux):
+ *
+ *   auto stream = client.CallStream("你好世界");
+ *   const float* samples = nullptr;
+ *   size_t n;
+ *   while ((n = stream->Read(&samples)) > 0) {
+ *       play(samples, n);          // 直接读取共享内存, 无拷贝
+ *       stream->Consume(n);
+ *   }
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tts_api.hpp"
+
+namespace Evo {
+
+// =============================================================================
+// WorkerPoolConfig - 工作进程池配置
+// =============================================================================
+
+struct WorkerPoolConfig {
+    std::string socket_path = "/tmp/evo_tts.sock";  ///< Unix 域套接字路径
+    int num_workers = 0;                ///< 工作进程数, 0 表示 CPU 核数
+    int restart_delay_ms = 200;         ///< 工作进程退出后重启前的等待时间, 重启 fork 失败时按此间隔重试
+    int listen_backlog = 64;            ///< 监听队列长度
+    size_t stream_buffer_bytes = 1 << 20;  ///< 共享内存流环形缓冲区大小
+};
+
+// =============================================================================
+// WorkerStats - 工作进程统计
+// =============================================================================
+
+struct WorkerStats {
+    int index = 0;                      ///< 工作进程编号 [0, num_workers)
+    int pid = 0;                        ///< 当前进程 ID
+    bool alive = false;                 ///< 是否存活
+    int restarts = 0;                   ///< 重启次数
+    uint64_t requests = 0;              ///< 已处理请求数
+    uint64_t failures = 0;              ///< 失败请求数
+    uint64_t audio_ms = 0;              ///< 累计合成音频时长 (毫秒)
+    uint64_t busy_ms = 0;               ///< 累计处理耗时 (毫秒)
+    uint64_t text_bytes = 0;            ///< 累计输入文本字节数
+    int64_t last_active_ms = 0;         ///< 最近一次请求完成时间 (Unix 毫秒)
+};
+
+// =============================================================================
+// TtsAudioStream - 共享内存音频流 (读端)
+// =============================================================================
+
+/**
+ * 共享内存音频流句柄: memfd 及两个 eventfd
+ *
+ * 可通过 SCM_RIGHTS 转交给同机的其他进程 (例如混音器)，再用 Attach() 附加。
+ */
+struct AudioStreamHandle {
+    int memfd = -1;                     ///< 环形缓冲区 memfd
+    int data_fd = -1;                   ///< 数据到达通知 (eventfd)
+    int space_fd = -1;                  ///< 空间释放通知 (eventfd)
+};
+
+class TtsAudioStream {
+public:
+    /// @brief 通过句柄附加到流, 接管句柄中 fd 的所有权
+    /// @return 失败返回 nullptr (并关闭 fd)
+    static std::shared_ptr<TtsAudioStream> Attach(const AudioStreamHandle& handle);
+
+    ~TtsAudioStream();
+
+    TtsAudioStream(const TtsAudioStream&) = delete;
+    TtsAudioStream& operator=(const TtsAudioStream&) = delete;
+
+    /// @brief 获取采样率
+    int GetSampleRate() const;
+
+    /// @brief 等待并返回可读音频 (float, [-1.0, 1.0])，不拷贝
+    /// @param samples 输出, 指向共享内存, 在 Consume() 之前有效
+    /// @param timeout_ms 超时 (-1 无限等待)
+    /// @return 可读样本数, 0 表示流结束或超时
+    size_t Read(const float** samples, int timeout_ms = -1);
+
+    /// @brief 释放已处理的样本, 让写端继续写入
+    void Consume(size_t num_samples);
+
+    /// @brief 读取剩余全部音频 (拷贝到结果对象)
+    std::shared_ptr<TtsEngineResult> ReadAll();
+
+    /// @brief 写端已结束且数据已读完
+    bool IsFinished() const;
+
+    /// @brief 写端是否以成功状态结束 (流结束前为 true)
+    bool IsSuccess() const;
+
+    /// @brief 失败时的错误信息
+    std::string GetMessage() const;
+
+private:
+    TtsAudioStream();
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// =============================================================================
+// TtsWorkerPool - 预 fork 工作进程池 (supervisor)
+// =============================================================================
+
+class TtsWorkerPool {
+public:
+    /// @brief 构造工作进程池
+    /// @param config 引擎配置 (num_threads 会被强制为 1, 空闲策略被关闭)
+    /// @param pool_config 进程池配置
+    explicit TtsWorkerPool(const TtsConfig& config,
+                           const WorkerPoolConfig& pool_config = WorkerPoolConfig());
+
+    ~TtsWorkerPool();
+
+    TtsWorkerPool(const TtsWorkerPool&) = delete;
+    TtsWorkerPool& operator=(const TtsWorkerPool&) = delete;
+
+    /// @brief 初始化引擎、绑定套接字并 fork 工作进程
+    /// @return 是否成功
+    bool Start();
+
+    /// @brief supervisor 主循环: 回收并重启退出的工作进程, 直到 Stop()
+    void Run();
+
+    /// @brief 请求停止 (可在信号处理函数中调用)
+    void Stop();
+
+    /// @brief 是否正在运行
+    bool IsRunning() const;
+
+    /// @brief 获取工作进程数
+    int GetNumWorkers() const;
+
+    /// @brief 获取各工作进程统计
+    std::vector<WorkerStats> GetStats() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// =============================================================================
+// TtsClient - 本地服务客户端
+// =============================================================================
+
+class TtsClient {
+public:
+    /// @brief 构造客户端
+    /// @param socket_path 服务端套接字路径
+    explicit TtsClient(const std::string& socket_path = "/tmp/evo_tts.sock");
+
+    ~TtsClient();
+
+    TtsClient(const TtsClient&) = delete;
+    TtsClient& operator=(const TtsClient&) = delete;
+
+    /// @brief 连接服务端 (Call 时会自动连接)
+    /// @return 是否成功
+    bool Connect();
+
+    /// @brief 断开连接
+    void Close();
+
+    /// @brief 是否已连接
+    bool IsConnected() const;
+
+    /// @brief 合成文本 (阻塞)
+    /// @param text 要合成的文本
+    /// @param speech_rate 语速覆盖, 0 表示使用服务端默认值
+    /// @return 合成结果, 连接失败时 IsSuccess() 为 false
+    std::shared_ptr<TtsEngineResult> Call(const std::string& text, float speech_rate = 0.0f);
+
+    /// @brief 合成文本, 音频通过共享内存流返回 (仅 Linux)
+    /// @note 流读完之前该连接被占用, 不要在同一客户端上发起其他请求
+    /// @return 音频流, 失败返回 nullptr
+    std::shared_ptr<TtsAudioStream> CallStream(const std::string& text, float speech_rate = 0.0f);
+
+    /// @brief 查询服务端各工作进程统计
+    /// @return 统计列表, 失败返回空
+    std::vector<WorkerStats> GetWorkerStats();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace Evo
+
+#endif  // TTS_SERVER_HPP
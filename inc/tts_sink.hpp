@@ -0,0 +1,116 @@
+#ifndef TTS_SINK_HPP
+#define TTS_SINK_HPP
+
+/**
+ * EvoTtsSDK - 音频输出 (Sink)
+ *
+ * 把合成音频逐块写出，无需在内存中拼接整段音频，适用于长文本和批量合成。
+ *
+ * 使用示例:
+ *
+ *   Evo::WavFileSink sink("output.wav");
+ *   sink.Open(engine.GetSampleRate());
+ *   auto result = engine.Call("你好世界");
+ *   auto audio = result->GetAudioFloat();
+ *   sink.Write(audio.data(), audio.size());
+ *   sink.Close();                          // 回填 WAV 头部长度字段
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <memory>
+#include <string>
+
+namespace Evo {
+
+// =============================================================================
+// AudioSink - 音频输出接口
+// =============================================================================
+
+/**
+ * @brief 音频输出接口 (单声道 float, [-1.0, 1.0])
+ *
+ * 调用顺序: Open() -> Write()* -> Close()
+ */
+class AudioSink {
+public:
+    virtual ~AudioSink() = default;
+
+    /// @brief 开始输出
+    /// @param sample_rate 采样率 (Hz)
+    /// @return 是否成功
+    virtual bool Open(int sample_rate) = 0;
+
+    /// @brief 写入一块音频
+    /// @param samples 样本
+    /// @param num_samples 样本数
+    /// @return 是否成功
+    virtual bool Write(const float* samples, size_t num_samples) = 0;
+
+    /// @brief 结束输出 (刷新缓冲, 完成文件头)
+    /// @return 是否成功
+    virtual bool Close() = 0;
+};
+
+// =============================================================================
+// WavFileSink - WAV 文件 (16-bit PCM)
+// =============================================================================
+
+class WavFileSink : public AudioSink {
+public:
+    /// @param file_path 输出文件路径
+    explicit WavFileSink(const std::string& file_path);
+
+    /// @brief 续写: Open() 时保留已有文件的前 resume_samples 个样本, 之后的内容截掉并在其后追加
+    /// @param file_path 已有的输出文件 (不存在时等同于新建)
+    /// @param resume_samples 保留的样本数 (通常为 DocumentProgress::audio_samples)
+    WavFileSink(const std::string& file_path, uint64_t resume_samples);
+    ~WavFileSink() override;
+
+    WavFileSink(const WavFileSink&) = delete;
+    WavFileSink& operator=(const WavFileSink&) = delete;
+
+    bool Open(int sample_rate) override;
+    bool Write(const float* samples, size_t num_samples) override;
+    bool Close() override;
+
+    /// @brief 已写入样本数
+    size_t GetNumSamples() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// =============================================================================
+// PcmFileSink - 原始 PCM 文件 (s16le, 无文件头)
+// =============================================================================
+
+class PcmFileSink : public AudioSink {
+public:
+    /// @param file_path 输出文件路径
+    explicit PcmFileSink(const std::string& file_path);
+
+    /// @brief 续写: Open() 时保留已有文件的前 resume_samples 个样本并在其后追加
+    PcmFileSink(const std::string& file_path, uint64_t resume_samples);
+    ~PcmFileSink() override;
+
+    PcmFileSink(const PcmFileSink&) = delete;
+    PcmFileSink& operator=(const PcmFileSink&) = delete;
+
+    bool Open(int sample_rate) override;
+    bool Write(const float* samples, size_t num_samples) override;
+    bool Close() override;
+
+    /// @brief 已写入样本数
+    size_t GetNumSamples() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace Evo
+
+#endif  // TTS_SINK_HPP
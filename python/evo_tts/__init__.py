@@ -30,7 +30,8 @@ Advanced Features:
     - Real-time factor (RTF) monitoring
 """
 
-from .engine import Engine, Config, Result, BackendType, AudioFormat
+from .engine import Engine, Config, Result, BackendType, AudioFormat, ResidencyState
+from .client import Client, AudioStream
 from .callback import TtsCallback, PrintCallback, SaveCallback, CollectCallback
 from .utils import synthesize, synthesize_to_file
 
@@ -42,6 +43,9 @@ __all__ = [
     "Result",
     "BackendType",
     "AudioFormat",
+    "ResidencyState",
+    "Client",
+    "AudioStream",
     "TtsCallback",
     "PrintCallback",
     "SaveCallback",
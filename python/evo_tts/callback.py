@@ -4,6 +4,7 @@ TTS Callback - Base class for streaming callbacks
 Provides callback interface for streaming TTS synthesis.
 """
 
+import threading
 from abc import ABC
 from pathlib import Path
 from typing import Any
@@ -39,6 +40,10 @@ class TtsCallback(ABC):
         >>> engine.synthesize_streaming("你好世界", callback)
     """
 
+    # Guards lazy creation of the native callback; a class attribute so that
+    # subclasses which skip super().__init__() are covered too
+    _native_lock = threading.Lock()
+
     def __init__(self):
         self._native_callback = None
 
@@ -91,6 +96,22 @@ class TtsCallback(ABC):
         """
         pass
 
+    def cancel(self) -> None:
+        """
+        Cancel the synthesis this callback is attached to
+
+        Safe to call from any thread. Synthesis stops before the next audio
+        chunk and ends with on_error("Cancelled") followed by on_close().
+        When identical requests are coalesced, the shared synthesis only stops
+        once every subscriber has cancelled.
+        """
+        self._get_native_callback().cancel()
+
+    @property
+    def cancelled(self) -> bool:
+        """Whether cancel() has been called"""
+        return self._native_callback is not None and self._native_callback.is_cancelled()
+
     def _get_native_callback(self):
         """
         Get native C++ callback wrapper (internal use)
@@ -101,13 +122,17 @@ class TtsCallback(ABC):
         if _tts is None:
             raise ImportError("_evo_tts module not found")
 
-        if self._native_callback is None:
-            self._native_callback = _tts.TtsCallback()
-            self._native_callback.on_open(self.on_open)
-            self._native_callback.on_event(self.on_event)
-            self._native_callback.on_complete(self.on_complete)
-            self._native_callback.on_error(self.on_error)
-            self._native_callback.on_close(self.on_close)
+        # Without the GIL (free-threaded CPython) two threads could otherwise
+        # each create a native callback, and cancel() would hit the wrong one
+        with self._native_lock:
+            if getattr(self, "_native_callback", None) is None:
+                native = _tts.TtsCallback()
+                native.on_open(self.on_open)
+                native.on_event(self.on_event)
+                native.on_complete(self.on_complete)
+                native.on_error(self.on_error)
+                native.on_close(self.on_close)
+                self._native_callback = native
 
         return self._native_callback
 
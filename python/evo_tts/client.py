@@ -0,0 +1,145 @@
+"""
+TTS Client - Access a local TTS worker pool
+
+Talks to a running `tts_server` over its Unix domain socket. Audio can be
+returned over the socket, or through a shared-memory stream that is read
+zero-copy (Linux only).
+"""
+
+from typing import Iterator, List, Optional
+
+import numpy as np
+
+from .engine import Result, _tts
+
+
+class AudioStream:
+    """
+    Shared-memory audio stream
+
+    Arrays returned by `read()` are read-only views into shared memory and
+    stay valid until `consume()` is called. Copy them if you need to keep them.
+
+    Example:
+        >>> stream = client.synthesize_stream("你好世界")
+        >>> while True:
+        ...     chunk = stream.read()
+        ...     if chunk.size == 0:
+        ...         break
+        ...     player.write(chunk)
+        ...     stream.consume(chunk.size)
+    """
+
+    def __init__(self, native_stream):
+        self._stream = native_stream
+
+    @classmethod
+    def attach(cls, memfd: int, data_fd: int, space_fd: int) -> Optional["AudioStream"]:
+        """
+        Attach to a stream by handle (takes ownership of the fds)
+
+        Returns:
+            AudioStream, or None if the handle is invalid
+        """
+        native = _tts.TtsAudioStream.attach(memfd, data_fd, space_fd)
+        return cls(native) if native is not None else None
+
+    def read(self, timeout_ms: int = -1) -> np.ndarray:
+        """
+        Wait for audio and return a zero-copy float32 view
+
+        Returns:
+            Read-only array; empty at end of stream or on timeout
+        """
+        return self._stream.read(timeout_ms)
+
+    def consume(self, num_samples: int):
+        """Release samples returned by read()"""
+        self._stream.consume(num_samples)
+
+    def chunks(self) -> Iterator[np.ndarray]:
+        """
+        Iterate over audio chunks (copies, safe to keep)
+        """
+        while True:
+            view = self._stream.read(-1)
+            if view.size == 0:
+                return
+            chunk = view.copy()
+            self._stream.consume(view.size)
+            yield chunk
+
+    def read_all(self) -> Result:
+        """Read the remaining audio into a Result"""
+        return Result(self._stream.read_all())
+
+    @property
+    def sample_rate(self) -> int:
+        """Sample rate (Hz)"""
+        return self._stream.get_sample_rate()
+
+    @property
+    def is_finished(self) -> bool:
+        """Writer closed and all audio consumed"""
+        return self._stream.is_finished()
+
+    @property
+    def is_success(self) -> bool:
+        """Stream has not failed"""
+        return self._stream.is_success()
+
+    @property
+    def message(self) -> str:
+        """Error message"""
+        return self._stream.get_message()
+
+
+class Client:
+    """
+    Client for a local TTS worker pool
+
+    Example:
+        >>> client = Client("/tmp/evo_tts.sock")
+        >>> result = client.synthesize("你好世界")
+        >>> result.save("output.wav")
+    """
+
+    def __init__(self, socket_path: str = "/tmp/evo_tts.sock"):
+        self._client = _tts.TtsClient(socket_path)
+
+    def synthesize(self, text: str, speech_rate: float = 0.0) -> Result:
+        """
+        Synthesize text over the socket (blocking, releases GIL)
+
+        Args:
+            text: Text to synthesize
+            speech_rate: Speed override, 0 keeps the server default
+        """
+        return Result(self._client.call(text, speech_rate))
+
+    def synthesize_stream(self, text: str, speech_rate: float = 0.0) -> Optional[AudioStream]:
+        """
+        Synthesize text into a shared-memory stream (Linux only)
+
+        Do not issue other requests on this client until the stream is drained.
+
+        Returns:
+            AudioStream, or None on failure
+        """
+        native = self._client.call_stream(text, speech_rate)
+        return AudioStream(native) if native is not None else None
+
+    def worker_stats(self) -> List[dict]:
+        """Per-worker statistics"""
+        return self._client.get_worker_stats()
+
+    def close(self):
+        """Close connection"""
+        self._client.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.close()
+        return False
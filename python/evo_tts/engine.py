@@ -5,8 +5,10 @@ Provides Pythonic wrappers for the C++ TTS engine.
 """
 
 from enum import Enum
-from typing import Optional, Union
+from typing import Dict, Iterator, List, Optional, Sequence, Tuple, Union
 from pathlib import Path
+import queue
+import threading
 import numpy as np
 
 try:
@@ -37,10 +39,10 @@ class BackendType(Enum):
     """CosyVoice (reserved)"""
 
     VITS = _tts.BackendType.VITS
-    """VITS (reserved)"""
+    """VITS in Piper export format"""
 
     PIPER = _tts.BackendType.PIPER
-    """Piper TTS (reserved)"""
+    """Piper TTS (sample rate from the voice config)"""
 
     KOKORO = _tts.BackendType.KOKORO
     """Kokoro TTS (reserved)"""
@@ -69,6 +71,22 @@ class AudioFormat(Enum):
         return self.value
 
 
+class ResidencyState(Enum):
+    """Model residency state (see idle policy in Config)"""
+    RESIDENT = _tts.ResidencyState.RESIDENT
+    """Models loaded, inference caches kept"""
+
+    TRIMMED = _tts.ResidencyState.TRIMMED
+    """Models loaded, inference caches released"""
+
+    UNLOADED = _tts.ResidencyState.UNLOADED
+    """Models unloaded, reloaded on next request"""
+
+    def to_native(self):
+        """Convert to native C++ enum value"""
+        return self.value
+
+
 # =============================================================================
 # Config - Configuration wrapper
 # =============================================================================
@@ -141,6 +159,22 @@ class Config:
         config._config = _tts.TtsConfig.MatchaZHEN(str(Path(model_dir).expanduser()))
         return config
 
+    @staticmethod
+    def piper(model_dir: str = "~/.cache/piper-tts", voice: str = "default") -> "Config":
+        """
+        Create Piper configuration
+
+        Args:
+            model_dir: Directory with <voice>.onnx and <voice>.onnx.json
+            voice: Voice name ("default" = first voice in model_dir)
+
+        Returns:
+            Config object for Piper synthesis (sample rate from the voice config)
+        """
+        config = Config.__new__(Config)
+        config._config = _tts.TtsConfig.Piper(str(Path(model_dir).expanduser()), voice)
+        return config
+
     # Properties for convenient access
     @property
     def speech_rate(self) -> float:
@@ -187,6 +221,229 @@ class Config:
     def pitch(self, value: float):
         self._config.pitch = value
 
+    @property
+    def trim_silence(self) -> bool:
+        """Trim leading/trailing silence"""
+        return self._config.trim_silence
+
+    @trim_silence.setter
+    def trim_silence(self, value: bool):
+        self._config.trim_silence = value
+
+    @property
+    def sentence_gap_ms(self) -> int:
+        """
+        Silence inserted between sentences (ms)
+
+        Only applies where text is synthesized sentence by sentence (streaming,
+        document synthesis, tenant scheduling). synthesize() runs the whole text
+        as one segment and inserts no gaps.
+        """
+        return self._config.sentence_gap_ms
+
+    @sentence_gap_ms.setter
+    def sentence_gap_ms(self, value: int):
+        self._config.sentence_gap_ms = value
+
+    @property
+    def idle_trim_ms(self) -> int:
+        """Release inference caches after this idle time (0 = off)"""
+        return self._config.idle_trim_ms
+
+    @idle_trim_ms.setter
+    def idle_trim_ms(self, value: int):
+        self._config.idle_trim_ms = value
+
+    @property
+    def idle_unload_ms(self) -> int:
+        """Unload models after this idle time (0 = off)"""
+        return self._config.idle_unload_ms
+
+    @idle_unload_ms.setter
+    def idle_unload_ms(self, value: int):
+        self._config.idle_unload_ms = value
+
+    @property
+    def batch_window_ms(self) -> int:
+        """Window for merging concurrent requests into one batch (ms, 0 = off)"""
+        return self._config.batch_window_ms
+
+    @batch_window_ms.setter
+    def batch_window_ms(self, value: int):
+        self._config.batch_window_ms = value
+
+    @property
+    def max_batch_size(self) -> int:
+        """Maximum requests per batch"""
+        return self._config.max_batch_size
+
+    @max_batch_size.setter
+    def max_batch_size(self, value: int):
+        self._config.max_batch_size = value
+
+    @property
+    def execution_providers(self) -> List[str]:
+        """Execution providers in priority order (e.g. ["xnnpack", "cpu"]), empty = CPU only"""
+        return list(self._config.execution_providers)
+
+    @execution_providers.setter
+    def execution_providers(self, value: List[str]):
+        self._config.execution_providers = list(value)
+
+    @property
+    def provider_options(self) -> Dict[str, Dict[str, str]]:
+        """Per-provider options, e.g. {"xnnpack": {"intra_op_num_threads": "4"}}"""
+        return dict(self._config.provider_options)
+
+    @provider_options.setter
+    def provider_options(self, value: Dict[str, Dict[str, str]]):
+        self._config.provider_options = {name: {str(k): str(v) for k, v in opts.items()}
+                                         for name, opts in value.items()}
+
+    @property
+    def model_prefetch(self) -> bool:
+        """Read model files into the page cache in the background during init"""
+        return self._config.model_prefetch
+
+    @model_prefetch.setter
+    def model_prefetch(self, value: bool):
+        self._config.model_prefetch = value
+
+    @property
+    def model_mlock(self) -> bool:
+        """Lock weights and inference arena in memory (mlock)"""
+        return self._config.model_mlock
+
+    @model_mlock.setter
+    def model_mlock(self, value: bool):
+        self._config.model_mlock = value
+
+    @property
+    def model_huge_pages(self) -> bool:
+        """Use transparent huge pages for weights and inference arena"""
+        return self._config.model_huge_pages
+
+    @model_huge_pages.setter
+    def model_huge_pages(self, value: bool):
+        self._config.model_huge_pages = value
+
+    @property
+    def shared_allocator(self) -> bool:
+        """Share one ORT CPU allocator across all engines in the process"""
+        return self._config.shared_allocator
+
+    @shared_allocator.setter
+    def shared_allocator(self, value: bool):
+        self._config.shared_allocator = value
+
+    @property
+    def arena_max_mb(self) -> int:
+        """Shared arena size limit (MB, 0 = unlimited), set by the first engine"""
+        return self._config.arena_max_mb
+
+    @arena_max_mb.setter
+    def arena_max_mb(self, value: int):
+        self._config.arena_max_mb = value
+
+    @property
+    def engine_tag(self) -> str:
+        """Engine tag for ORT log attribution (empty = auto 'engine-N')"""
+        return self._config.engine_tag
+
+    @engine_tag.setter
+    def engine_tag(self, value: str):
+        self._config.engine_tag = value
+
+    @property
+    def stream_chunk_frames(self) -> int:
+        """Mel frames per chunk in streaming synthesis"""
+        return self._config.stream_chunk_frames
+
+    @stream_chunk_frames.setter
+    def stream_chunk_frames(self, value: int):
+        self._config.stream_chunk_frames = value
+
+    @property
+    def frontend_lookahead(self) -> int:
+        """Sentences prepared ahead of inference in streaming synthesis (0 = off)"""
+        return self._config.frontend_lookahead
+
+    @frontend_lookahead.setter
+    def frontend_lookahead(self, value: int):
+        self._config.frontend_lookahead = value
+
+    @property
+    def token_buckets(self) -> List[int]:
+        """Token length buckets for acoustic model inputs (empty = off)"""
+        return list(self._config.token_buckets)
+
+    @token_buckets.setter
+    def token_buckets(self, value: List[int]):
+        self._config.token_buckets = list(value)
+
+    @property
+    def mel_frame_buckets(self) -> List[int]:
+        """Mel frame buckets for vocoder inputs (empty = off)"""
+        return list(self._config.mel_frame_buckets)
+
+    @mel_frame_buckets.setter
+    def mel_frame_buckets(self, value: List[int]):
+        self._config.mel_frame_buckets = list(value)
+
+    @property
+    def vocoder_istft(self) -> str:
+        """Where the vocoder ISTFT runs: 'auto', 'graph' or 'cpp'"""
+        return self._config.vocoder_istft
+
+    @vocoder_istft.setter
+    def vocoder_istft(self, value: str):
+        self._config.vocoder_istft = value
+
+    @property
+    def cache_max_mb(self) -> int:
+        """In-memory audio cache size (MB, 0 = off)"""
+        return self._config.cache_max_mb
+
+    @cache_max_mb.setter
+    def cache_max_mb(self, value: int):
+        self._config.cache_max_mb = value
+
+    @property
+    def cache_dir(self) -> str:
+        """Directory for the persisted cache tier (empty = memory only)"""
+        return self._config.cache_dir
+
+    @cache_dir.setter
+    def cache_dir(self, value: str):
+        self._config.cache_dir = value
+
+    @property
+    def preload_manifest(self) -> str:
+        """Prompt manifest synthesized into the cache after init"""
+        return self._config.preload_manifest
+
+    @preload_manifest.setter
+    def preload_manifest(self, value: str):
+        self._config.preload_manifest = value
+
+    @property
+    def coalesce_requests(self) -> bool:
+        """Synthesize identical concurrent requests once and share the result"""
+        return self._config.coalesce_requests
+
+    @coalesce_requests.setter
+    def coalesce_requests(self, value: bool):
+        self._config.coalesce_requests = value
+
+    @property
+    def tenant_scheduling(self) -> bool:
+        """Weighted fair scheduling by tenant at sentence granularity"""
+        return self._config.tenant_scheduling
+
+    @tenant_scheduling.setter
+    def tenant_scheduling(self, value: bool):
+        self._config.tenant_scheduling = value
+
     # Builder methods (chainable)
     def with_speed(self, speed: float) -> "Config":
         """
@@ -263,10 +520,12 @@ class Result:
         """
         Audio as float32 numpy array
 
+        Zero-copy, read-only view of the result's buffer (use .copy() to modify).
+
         Returns:
             NumPy array with values in [-1.0, 1.0]
         """
-        return np.array(self._result.get_audio_float(), dtype=np.float32)
+        return self._result.audio_view()
 
     @property
     def audio_int16(self) -> np.ndarray:
@@ -383,7 +642,8 @@ class Engine:
         self._engine = _tts.TtsEngine(config._config)
         self._config = config
 
-    def synthesize(self, text: str) -> Result:
+    def synthesize(self, text: str, speaker_id: Optional[int] = None,
+                   tenant_id: Optional[str] = None) -> Result:
         """
         Synthesize text (blocking)
 
@@ -391,6 +651,10 @@ class Engine:
 
         Args:
             text: Text to synthesize
+            speaker_id: Speaker for this request only (multi-speaker models);
+                None uses the engine's current speaker
+            tenant_id: Tenant for fair scheduling and quotas
+                (requires config.tenant_scheduling)
 
         Returns:
             Synthesis result
@@ -399,9 +663,75 @@ class Engine:
             >>> result = engine.synthesize("你好世界")
             >>> print(f"Generated {result.duration_ms}ms audio")
         """
-        native_result = self._engine.call(text)
+        if tenant_id is not None:
+            native_result = self._engine.call_as(tenant_id, text,
+                                                 -1 if speaker_id is None else speaker_id)
+        elif speaker_id is None:
+            native_result = self._engine.call(text)
+        else:
+            native_result = self._engine.call_with_speaker(text, speaker_id)
         return Result(native_result)
 
+    def synthesize_many(self, texts: Sequence[str], max_workers: Optional[int] = None,
+                        ordered: bool = True) -> Union[List[Result], Iterator[Tuple[int, Result]]]:
+        """
+        Synthesize many texts in one call
+
+        The GIL is released once for the whole job. Without dynamic batching,
+        texts of similar length are grouped and each group runs as one batched
+        inference; with batching (config.batch_window_ms > 0) or tenant
+        scheduling, max_workers C++ threads submit concurrently and the
+        batcher merges them. Audio is exposed as zero-copy NumPy views.
+
+        Args:
+            texts: Texts to synthesize
+            max_workers: Concurrent C++ workers; None picks max_batch_size
+                with dynamic batching, otherwise 1
+            ordered: True returns a list in input order; False returns a
+                generator of (index, Result) in completion order (closing it
+                early still waits for the remaining texts)
+
+        Returns:
+            List of Result, or generator of (index, Result)
+
+        Example:
+            >>> results = engine.synthesize_many(["你好", "再见"])
+            >>> for index, result in engine.synthesize_many(lines, ordered=False):
+            ...     result.save(f"line_{index}.wav")
+        """
+        texts = list(texts)
+        workers = max_workers or 0
+        if ordered:
+            return [Result(r) for r in self._engine.call_many(texts, workers)]
+        return self._iter_completed(texts, workers)
+
+    def _iter_completed(self, texts: List[str], workers: int) -> Iterator[Tuple[int, Result]]:
+        # The job runs on a helper thread (GIL released inside); each finished
+        # result is handed over through a queue as soon as it completes
+        done = queue.Queue()
+        errors = []
+
+        def run():
+            try:
+                self._engine.call_many_each(texts, lambda i, r: done.put((i, r)), workers)
+            except BaseException as e:  # re-raised in the consumer
+                errors.append(e)
+            finally:
+                done.put(None)
+
+        thread = threading.Thread(target=run, name="evo_tts-synthesize_many", daemon=True)
+        thread.start()
+        try:
+            while True:
+                item = done.get()
+                if item is None:
+                    break
+                yield item[0], Result(item[1])
+        finally:
+            thread.join()
+        if errors:
+            raise errors[0]
+
     def synthesize_to_file(self, text: str, file_path: Union[str, Path]) -> bool:
         """
         Synthesize text and save to file
@@ -418,6 +748,41 @@ class Engine:
         """
         return self._engine.call_to_file(text, str(file_path))
 
+    def synthesize_document(self, input_path: Union[str, Path], output_path: Union[str, Path],
+                            resume_from=None, on_progress=None, tenant_id: str = ""):
+        """
+        Synthesize a book-length UTF-8 text file into a WAV file
+
+        Text is read in chunks and split into sentences across chunk
+        boundaries; sentences are synthesized in batches and appended to the
+        output, so memory does not grow with the document. The GIL is released
+        while synthesizing.
+
+        Args:
+            input_path: UTF-8 text file
+            output_path: Output WAV file
+            resume_from: Progress returned by an earlier interrupted call; the
+                output keeps the audio written up to that point and synthesis
+                continues from its byte offset
+            on_progress: Called with the progress after each batch; return
+                False to stop (the returned progress can be resumed later)
+            tenant_id: Tenant for fair scheduling and quotas
+
+        Returns:
+            DocumentProgress (byte_offset, audio_samples, sample_rate,
+            sentences, finished, success, message, audio_ms())
+
+        Example:
+            >>> progress = engine.synthesize_document("book.txt", "book.wav")
+            >>> if not progress.finished:
+            ...     engine.synthesize_document("book.txt", "book.wav", resume_from=progress)
+        """
+        start_offset = resume_from.byte_offset if resume_from is not None else 0
+        start_audio_samples = resume_from.audio_samples if resume_from is not None else 0
+        return self._engine.synthesize_document(str(input_path), str(output_path),
+                                                start_offset, start_audio_samples, on_progress,
+                                                tenant_id)
+
     def synthesize_streaming(self, text: str, callback):
         """
         Streaming synthesis with callback
@@ -470,6 +835,95 @@ class Engine:
         """
         self._engine.set_volume(volume)
 
+    def prewake(self):
+        """
+        Reload models in the background ahead of an expected request
+
+        Non-blocking; only refreshes the idle timer if models are loaded.
+        """
+        self._engine.prewake()
+
+    def release_resources(self, level: ResidencyState = ResidencyState.UNLOADED):
+        """
+        Release resources now
+
+        Args:
+            level: ResidencyState.TRIMMED or ResidencyState.UNLOADED
+        """
+        self._engine.release_resources(level.to_native())
+
+    def reload(self, config: Config) -> bool:
+        """
+        Swap in a new model without downtime
+
+        The new model is loaded and warmed up on the calling thread (GIL released)
+        while requests keep running on the current one. New requests then use the
+        new model; in-flight requests finish on the old one, which is released
+        afterwards. Engine-level settings (batching, cache, idle policy) keep
+        their construction-time values.
+
+        Args:
+            config: New configuration
+
+        Returns:
+            True on success; on failure the current model stays in use
+        """
+        if not self._engine.reload(config._config):
+            return False
+        self._config = config
+        return True
+
+    def try_reload_if_changed(self) -> bool:
+        """
+        Reload with the current configuration if the model files were replaced
+
+        Compares size and modification time of the files loaded by the current
+        model, e.g. after a fleet update rewrote them in place.
+
+        Returns:
+            True if a reload happened
+        """
+        return self._engine.try_reload_if_changed()
+
+    @property
+    def residency_state(self) -> ResidencyState:
+        """Current model residency state"""
+        return ResidencyState(self._engine.get_residency_state())
+
+    @property
+    def preload_progress(self):
+        """Cache preload progress (total, completed, synthesized, from_cache, failed, finished)"""
+        return self._engine.get_preload_progress()
+
+    def set_tenant_quota(self, tenant_id: str, weight: float = 1.0, max_in_flight: int = 0,
+                         audio_seconds_per_second: float = 0.0, audio_burst_seconds: float = 5.0):
+        """
+        Set a tenant's scheduling weight and quotas (requires config.tenant_scheduling)
+
+        Args:
+            tenant_id: Tenant ('' = requests without a tenant)
+            weight: Share of synthesis time relative to other tenants
+            max_in_flight: Max concurrent requests, extra requests wait (0 = unlimited)
+            audio_seconds_per_second: Audio seconds synthesized per second (0 = unlimited)
+            audio_burst_seconds: Burst allowance of the audio quota
+        """
+        quota = _tts.TenantQuota()
+        quota.weight = weight
+        quota.max_in_flight = max_in_flight
+        quota.audio_seconds_per_second = audio_seconds_per_second
+        quota.audio_burst_seconds = audio_burst_seconds
+        self._engine.set_tenant_quota(tenant_id, quota)
+
+    @property
+    def tenant_stats(self):
+        """Per-tenant metrics (in_flight, queued_segments, audio_ms, wait_ms, max_wait_ms, ...)"""
+        return self._engine.get_tenant_stats()
+
+    @property
+    def model_memory_stats(self):
+        """Mapped, resident and locked bytes of model weights and arena"""
+        return self._engine.get_model_memory_stats()
+
     @property
     def config(self) -> Config:
         """Get current configuration"""
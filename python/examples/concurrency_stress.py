@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""
+并发压力测试
+
+多个 Python 线程共享同一个引擎, 同时执行:
+1. synthesize            - 阻塞合成, 检查结果成功且音频非空
+2. synthesize_streaming  - 流式合成, 检查回调顺序
+3. TtsCallback.cancel()  - 另一个线程在随机时刻取消进行中的流式合成
+
+回调检查: on_open 最先, on_close 最后且只调用一次, on_complete 与 on_error 恰好一个;
+取消的请求以 on_error 或 (来不及取消时) on_complete 结束。
+任一检查失败时打印原因并以退出码 1 结束。
+
+可在自由线程 CPython (python3.13t) 下运行, 此时各线程真正并行调用扩展模块:
+  python3.13t concurrency_stress.py
+  PYTHON_GIL=0 python3.13t concurrency_stress.py     # 确保 GIL 保持关闭
+
+用法:
+  python concurrency_stress.py                        # 默认中文模型, 16 线程, 20 秒
+  python concurrency_stress.py -l zh-en -t 32 -d 60   # 指定语言、线程数与时长
+  python concurrency_stress.py -m ~/.cache/matcha-tts  # 指定模型目录
+"""
+
+import argparse
+import random
+import sys
+import threading
+import time
+from typing import List
+
+import evo_tts
+
+
+TEXTS = [
+    "你好世界。",
+    "今天天气很好，我们去公园散步吧。",
+    "会议定于2024年3月15日下午14:30召开。",
+    "这台电脑的价格是8999元，比上个月便宜了12%。",
+    "我正在学习Machine Learning。",
+]
+
+TEXTS_EN = [
+    "Hello world.",
+    "The quick brown fox jumps over the lazy dog.",
+    "We shipped 1,234 units in Q3, up 15% from last year.",
+]
+
+
+# =============================================================================
+# 结果统计
+# =============================================================================
+
+class Stats:
+    """线程安全的计数与失败记录"""
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self.counts = {"synthesize": 0, "streaming": 0, "cancel": 0, "cancelled": 0}
+        self.failures: List[str] = []
+
+    def add(self, key: str):
+        with self._lock:
+            self.counts[key] += 1
+
+    def fail(self, message: str):
+        with self._lock:
+            self.failures.append(message)
+
+
+# =============================================================================
+# 流式回调 - 记录事件顺序
+# =============================================================================
+
+class CheckingCallback(evo_tts.TtsCallback):
+    """记录回调事件, 结束后检查顺序"""
+
+    def __init__(self):
+        super().__init__()
+        self._lock = threading.Lock()
+        self.events: List[str] = []
+        self.chunks = 0
+        self.closed = threading.Event()
+
+    def _record(self, event: str):
+        with self._lock:
+            self.events.append(event)
+
+    def on_open(self):
+        self._record("open")
+
+    def on_event(self, result):
+        with self._lock:
+            self.chunks += 1
+
+    def on_complete(self):
+        self._record("complete")
+
+    def on_error(self, message: str):
+        self._record("error:" + message)
+
+    def on_close(self):
+        self._record("close")
+        self.closed.set()
+
+    def check(self, expect_success: bool) -> str:
+        """返回空字符串表示通过, 否则返回失败原因"""
+        with self._lock:
+            events = list(self.events)
+            chunks = self.chunks
+        if not events or events[0] != "open":
+            return f"first event is not on_open: {events}"
+        if events[-1] != "close" or events.count("close") != 1:
+            return f"on_close not called exactly once at the end: {events}"
+        endings = [e for e in events if e == "complete" or e.startswith("error:")]
+        if len(endings) != 1:
+            return f"expected exactly one of on_complete/on_error: {events}"
+        if expect_success and endings[0] != "complete":
+            return f"streaming failed: {endings[0]}"
+        if endings[0] == "complete" and chunks == 0:
+            return "on_complete without any audio chunk"
+        return ""
+
+
+# =============================================================================
+# 工作线程
+# =============================================================================
+
+def run_synthesize(engine: evo_tts.Engine, text: str, stats: Stats):
+    result = engine.synthesize(text)
+    if not result.is_success:
+        stats.fail(f"synthesize({text!r}) failed: {result.message}")
+    elif len(result.audio_float) == 0:
+        stats.fail(f"synthesize({text!r}) returned empty audio")
+    stats.add("synthesize")
+
+
+def run_streaming(engine: evo_tts.Engine, text: str, stats: Stats):
+    callback = CheckingCallback()
+    engine.synthesize_streaming(text, callback)
+    problem = callback.check(expect_success=True)
+    if problem:
+        stats.fail(f"synthesize_streaming({text!r}): {problem}")
+    stats.add("streaming")
+
+
+def run_cancel(engine: evo_tts.Engine, text: str, stats: Stats, rng: random.Random):
+    callback = CheckingCallback()
+    delay = rng.uniform(0.0, 0.2)
+
+    def canceller():
+        time.sleep(delay)
+        callback.cancel()
+
+    thread = threading.Thread(target=canceller)
+    thread.start()
+    engine.synthesize_streaming(text, callback)
+    thread.join()
+
+    problem = callback.check(expect_success=False)
+    if problem:
+        stats.fail(f"cancelled synthesize_streaming({text!r}): {problem}")
+    if not callback.cancelled:
+        stats.fail("cancel() did not mark the callback as cancelled")
+    if any(e.startswith("error:") for e in callback.events):
+        stats.add("cancelled")
+    stats.add("cancel")
+
+
+def worker(engine: evo_tts.Engine, texts: List[str], deadline: float, seed: int, stats: Stats):
+    rng = random.Random(seed)
+    while time.monotonic() < deadline:
+        text = rng.choice(texts)
+        action = rng.randrange(3)
+        try:
+            if action == 0:
+                run_synthesize(engine, text, stats)
+            elif action == 1:
+                run_streaming(engine, text, stats)
+            else:
+                run_cancel(engine, text, stats, rng)
+        except Exception as e:
+            stats.fail(f"{type(e).__name__}: {e}")
+
+
+# =============================================================================
+# 主程序
+# =============================================================================
+
+def create_config(language: str, model_dir: str) -> evo_tts.Config:
+    if language == "en":
+        return evo_tts.Config.matcha_en(model_dir)
+    if language == "zh-en":
+        return evo_tts.Config.matcha_zh_en(model_dir)
+    return evo_tts.Config.matcha_zh(model_dir)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="evo_tts 并发压力测试")
+    parser.add_argument("-l", "--language", default="zh", choices=["zh", "en", "zh-en"],
+                        help="语言 (默认 zh)")
+    parser.add_argument("-m", "--model-dir", default="~/.cache/matcha-tts",
+                        help="模型目录")
+    parser.add_argument("-t", "--threads", type=int, default=16, help="线程数 (默认 16)")
+    parser.add_argument("-d", "--duration", type=float, default=20.0,
+                        help="运行时长, 秒 (默认 20)")
+    parser.add_argument("--seed", type=int, default=0, help="随机种子")
+    args = parser.parse_args()
+
+    gil_enabled = getattr(sys, "_is_gil_enabled", lambda: True)()
+    print(f"Python {sys.version.split()[0]}, GIL {'enabled' if gil_enabled else 'disabled'}")
+
+    engine = evo_tts.Engine(create_config(args.language, args.model_dir))
+    if not engine.is_initialized:
+        print("✗ 引擎初始化失败")
+        return 1
+    texts = TEXTS_EN if args.language == "en" else TEXTS + (TEXTS_EN if args.language == "zh-en" else [])
+    print(f"Engine: {engine.engine_name}, {args.threads} threads, {args.duration:.0f} s")
+
+    stats = Stats()
+    deadline = time.monotonic() + args.duration
+    threads = [
+        threading.Thread(target=worker, args=(engine, texts, deadline, args.seed + i, stats))
+        for i in range(args.threads)
+    ]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    counts = stats.counts
+    print(f"synthesize: {counts['synthesize']}, streaming: {counts['streaming']}, "
+          f"cancel: {counts['cancel']} ({counts['cancelled']} stopped early)")
+
+    if stats.failures:
+        for message in stats.failures[:10]:
+            print(f"✗ {message}")
+        print(f"✗ {len(stats.failures)} failures")
+        return 1
+    print("✓ All checks passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
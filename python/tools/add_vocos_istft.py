@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""
+Append the ISTFT to a Vocos vocoder ONNX graph
+
+The stock vocos-*.onnx returns three tensors (mag, x, y) of shape
+[B, n_fft / 2 + 1, T]. The C++ backend then rebuilds the complex spectrum,
+runs an inverse FFT per frame and overlap-adds on one thread. This tool appends
+the same reconstruction to the graph so that one Run returns the waveform:
+
+    real, imag = mag * x, mag * y
+    frames     = window * irfft(real + j * imag)        (folded into one kernel)
+    audio      = overlap_add(frames, hop) / overlap_add(window ** 2, hop)
+
+The inverse real DFT, the synthesis window and the overlap-add are a single
+ConvTranspose whose kernel holds the windowed DFT basis, so no per-frame
+intermediate is materialized. The result matches the C++ ISTFT
+(src/vocoder/vocoder.cpp): symmetric Hann window, no center trimming, output
+length n_fft + (T - 1) * hop.
+
+Place the output next to the original vocoder:
+
+    <model_dir>/vocos-22khz-univ-istft.onnx
+    <model_dir>/vocos-16khz-univ-istft.onnx
+
+Interface expected by the backend:
+    mels [B, n_mels, T] float -> waveform [B, n_fft + (T - 1) * hop] float
+
+Requires the onnx and numpy packages.
+
+Usage:
+    python add_vocos_istft.py --input vocos-22khz-univ.onnx --output vocos-22khz-univ-istft.onnx
+"""
+
+import argparse
+
+import numpy as np
+import onnx
+from onnx import TensorProto, helper, numpy_helper
+
+
+def read_metadata(model: onnx.ModelProto, key: str, default: int) -> int:
+    for prop in model.metadata_props:
+        if prop.key == key:
+            return int(prop.value)
+    return default
+
+
+def hann_window(win_length: int, n_fft: int) -> np.ndarray:
+    """Symmetric Hann window, zero-padded to n_fft (same as createHannWindow)"""
+    i = np.arange(win_length, dtype=np.float64)
+    window = 0.5 * (1.0 - np.cos(2.0 * np.pi * i / (win_length - 1)))
+    return np.pad(window, (0, n_fft - win_length))
+
+
+def istft_kernel(n_fft: int, window: np.ndarray) -> np.ndarray:
+    """
+    ConvTranspose kernel [2 * n_bins, 1, n_fft] mapping stacked (real, imag)
+    spectra to windowed time frames, i.e. window * irfft(spectrum, n_fft)
+    """
+    n_bins = n_fft // 2 + 1
+    k = np.arange(n_bins, dtype=np.float64)[:, None]
+    n = np.arange(n_fft, dtype=np.float64)[None, :]
+    angle = 2.0 * np.pi * k * n / n_fft
+
+    # Hermitian symmetry: interior bins appear twice, DC and Nyquist once
+    scale = np.full((n_bins, 1), 2.0)
+    scale[0] = 1.0
+    if n_fft % 2 == 0:
+        scale[-1] = 1.0
+    scale /= n_fft
+
+    real_basis = scale * np.cos(angle) * window[None, :]
+    imag_basis = -scale * np.sin(angle) * window[None, :]
+    kernel = np.concatenate([real_basis, imag_basis], axis=0)
+    return kernel[:, None, :].astype(np.float32)
+
+
+def opset_version(model: onnx.ModelProto) -> int:
+    for opset in model.opset_import:
+        if opset.domain in ("", "ai.onnx"):
+            return opset.version
+    return 0
+
+
+def append_istft(model: onnx.ModelProto) -> onnx.ModelProto:
+    graph = model.graph
+    outputs = {output.name for output in graph.output}
+    for name in ("mag", "x", "y"):
+        if name not in outputs:
+            raise ValueError(f"Vocoder graph has no output '{name}' (outputs: {sorted(outputs)})")
+
+    n_fft = read_metadata(model, "n_fft", 1024)
+    hop = read_metadata(model, "hop_length", 256)
+    win_length = read_metadata(model, "win_length", n_fft)
+    if win_length > n_fft:
+        raise ValueError(f"win_length {win_length} exceeds n_fft {n_fft}")
+
+    window = hann_window(win_length, n_fft)
+    graph.initializer.extend([
+        numpy_helper.from_array(istft_kernel(n_fft, window), "istft_kernel"),
+        numpy_helper.from_array((window ** 2).astype(np.float32)[None, None, :], "istft_window_sq"),
+        numpy_helper.from_array(np.array([1, 1], dtype=np.int64), "istft_ones_prefix"),
+        numpy_helper.from_array(np.array([2], dtype=np.int64), "istft_time_axis"),
+        numpy_helper.from_array(np.array([3], dtype=np.int64), "istft_time_axis_end"),
+        numpy_helper.from_array(np.array(1e-8, dtype=np.float32), "istft_eps"),
+    ])
+
+    nodes = [
+        # Complex spectrum, real and imaginary parts stacked on the channel axis
+        helper.make_node("Mul", ["mag", "x"], ["istft_real"]),
+        helper.make_node("Mul", ["mag", "y"], ["istft_imag"]),
+        helper.make_node("Concat", ["istft_real", "istft_imag"], ["istft_spec"], axis=1),
+        # Inverse DFT + window + overlap-add: [B, 2 * n_bins, T] -> [B, 1, L]
+        helper.make_node("ConvTranspose", ["istft_spec", "istft_kernel"], ["istft_sum"],
+                         kernel_shape=[n_fft], strides=[hop]),
+        # Window envelope for the same number of frames: [1, 1, L]
+        helper.make_node("Shape", ["mag"], ["istft_mag_shape"]),
+        helper.make_node("Slice", ["istft_mag_shape", "istft_time_axis", "istft_time_axis_end"],
+                         ["istft_num_frames"]),
+        helper.make_node("Concat", ["istft_ones_prefix", "istft_num_frames"], ["istft_ones_shape"], axis=0),
+        helper.make_node("ConstantOfShape", ["istft_ones_shape"], ["istft_ones"],
+                         value=helper.make_tensor("one", TensorProto.FLOAT, [1], [1.0])),
+        helper.make_node("ConvTranspose", ["istft_ones", "istft_window_sq"], ["istft_envelope"],
+                         kernel_shape=[n_fft], strides=[hop]),
+        # Normalize where the envelope is non-zero (the C++ ISTFT does the same)
+        helper.make_node("Greater", ["istft_envelope", "istft_eps"], ["istft_valid"]),
+        helper.make_node("Div", ["istft_sum", "istft_envelope"], ["istft_normalized"]),
+        helper.make_node("Where", ["istft_valid", "istft_normalized", "istft_sum"], ["istft_audio"]),
+    ]
+
+    if opset_version(model) >= 13:
+        graph.initializer.append(numpy_helper.from_array(np.array([1], dtype=np.int64), "istft_channel_axis"))
+        nodes.append(helper.make_node("Squeeze", ["istft_audio", "istft_channel_axis"], ["waveform"]))
+    else:
+        nodes.append(helper.make_node("Squeeze", ["istft_audio"], ["waveform"], axes=[1]))
+    graph.node.extend(nodes)
+
+    del graph.output[:]
+    graph.output.append(helper.make_tensor_value_info("waveform", TensorProto.FLOAT, ["batch", "num_samples"]))
+
+    prop = model.metadata_props.add()
+    prop.key = "istft_in_graph"
+    prop.value = "1"
+    return model
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Append the ISTFT to a Vocos vocoder ONNX graph")
+    parser.add_argument("--input", required=True, help="Original vocoder (vocos-*.onnx)")
+    parser.add_argument("--output", required=True, help="Output model (vocos-*-istft.onnx)")
+    args = parser.parse_args()
+
+    model = append_istft(onnx.load(args.input))
+    onnx.checker.check_model(model)
+    onnx.save(model, args.output)
+    print(f"Saved {args.output}")
+
+
+if __name__ == "__main__":
+    main()
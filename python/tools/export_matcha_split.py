@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""
+Export a Matcha-TTS checkpoint as split encoder / decoder ONNX models
+
+The single-graph model (model-steps-3.onnx) produces the whole sentence's mel
+in one Run. With the split models the C++ backend runs the encoder and
+duration predictor once, then decodes mel in overlapping time windows and
+vocodes each window as soon as it is ready, so time-to-first-audio no longer
+grows with sentence length.
+
+Place the output next to model-steps-3.onnx:
+
+    <model_dir>/<model>/encoder.onnx
+    <model_dir>/<model>/decoder.onnx
+
+Interface expected by the backend:
+    encoder.onnx  x [1, T_tok] int64, x_length [1] int64, length_scale [1] float
+                  -> mu [1, n_feats, T_mel]
+    decoder.onnx  mu [1, n_feats, W], mask [1, 1, W], z [1, n_feats, W] (noise,
+                  already scaled by the noise scale) -> mel [1, n_feats, W]
+
+Multi-speaker checkpoints (n_spks > 1) add a sid [1] int64 input to both
+models and record n_speakers in their metadata.
+
+With --acoustic the single-graph model is exported as well, with a batch axis
+and a mel length output so the backend can run a whole batch through it:
+    model-steps-<n>.onnx  x [B, T_tok] int64, x_length [B] int64,
+                          noise_scale [1] float, length_scale [1] float
+                          -> mel [B, n_feats, T_mel], mel_lengths [B] int64
+Without mel_lengths the backend cannot tell an item's valid frames from the
+batch padding and falls back to running the acoustic model once per item.
+The backend loads model-steps-3.onnx, so keep the default --n-timesteps 3
+when replacing it.
+
+Requires the Matcha-TTS package (https://github.com/shivammehta25/Matcha-TTS).
+
+Usage:
+    python export_matcha_split.py --checkpoint matcha_baker.ckpt --output-dir out/
+    python export_matcha_split.py --checkpoint matcha_baker.ckpt --output-dir out/ --acoustic
+"""
+
+import argparse
+import os
+
+import onnx
+import torch
+import torch.nn.functional as F
+
+from matcha.models.matcha_tts import MatchaTTS
+from matcha.utils.model import denormalize, generate_path, sequence_mask
+
+
+def align(model: MatchaTTS, x, x_length, length_scale, spks):
+    """Encode and expand to mel frames: returns mu_y, y_mask and each item's mel length"""
+    mu_x, logw, x_mask = model.encoder(x, x_length, spks)
+    w = torch.exp(logw) * x_mask
+    w_ceil = torch.ceil(w) * length_scale
+    y_lengths = torch.clamp_min(torch.sum(w_ceil, [1, 2]), 1).long()
+    y_max_length = y_lengths.max()
+
+    y_mask = sequence_mask(y_lengths, y_max_length).unsqueeze(1).to(x_mask.dtype)
+    attn_mask = x_mask.unsqueeze(-1) * y_mask.unsqueeze(2)
+    attn = generate_path(w_ceil.squeeze(1), attn_mask.squeeze(1))
+
+    mu_y = torch.matmul(attn.transpose(1, 2), mu_x.transpose(1, 2))
+    return mu_y.transpose(1, 2), y_mask, y_lengths
+
+
+def decode(model: MatchaTTS, mu, mask, z, spks, n_timesteps: int):
+    """Flow-matching decode of mu, returns denormalized mel with mu's frame count"""
+    # The U-Net downsamples twice: pad the frames to a multiple of 4
+    frames = mu.shape[-1]
+    pad = (4 - frames % 4) % 4
+    mu = F.pad(mu, (0, pad))
+    mask = F.pad(mask, (0, pad))
+    z = F.pad(z, (0, pad))
+
+    t_span = torch.linspace(0, 1, n_timesteps + 1, device=mu.device)
+    mel = model.decoder.solve_euler(z, t_span=t_span, mu=mu, mask=mask, spks=spks, cond=None)
+    mel = denormalize(mel, model.mel_mean, model.mel_std)
+    return mel[:, :, :frames]
+
+
+class EncoderWrapper(torch.nn.Module):
+    """Text encoder + duration predictor + alignment, returns aligned mu"""
+
+    def __init__(self, model: MatchaTTS):
+        super().__init__()
+        self.model = model
+
+    def forward(self, x, x_length, length_scale, sid=None):
+        spks = self.model.spk_emb(sid) if sid is not None else None
+        mu_y, _, _ = align(self.model, x, x_length, length_scale, spks)
+        return mu_y
+
+
+class DecoderWrapper(torch.nn.Module):
+    """Flow-matching decoder over one window, returns denormalized mel"""
+
+    def __init__(self, model: MatchaTTS, n_timesteps: int):
+        super().__init__()
+        self.model = model
+        self.n_timesteps = n_timesteps
+
+    def forward(self, mu, mask, z, sid=None):
+        spks = self.model.spk_emb(sid) if sid is not None else None
+        return decode(self.model, mu, mask, z, spks, self.n_timesteps)
+
+
+class AcousticWrapper(torch.nn.Module):
+    """Whole model for a padded batch, returns mel and each item's valid mel frames"""
+
+    def __init__(self, model: MatchaTTS, n_timesteps: int):
+        super().__init__()
+        self.model = model
+        self.n_timesteps = n_timesteps
+
+    def forward(self, x, x_length, noise_scale, length_scale, sid=None):
+        spks = self.model.spk_emb(sid) if sid is not None else None
+        mu_y, y_mask, y_lengths = align(self.model, x, x_length, length_scale, spks)
+        z = torch.randn_like(mu_y) * noise_scale
+        mel = decode(self.model, mu_y, y_mask, z, spks, self.n_timesteps)
+        return mel, y_lengths
+
+
+def add_metadata(path: str, values: dict):
+    model = onnx.load(path)
+    for key, value in values.items():
+        prop = model.metadata_props.add()
+        prop.key = key
+        prop.value = str(value)
+    onnx.save(model, path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Export split Matcha-TTS encoder/decoder ONNX models")
+    parser.add_argument("--checkpoint", required=True, help="Matcha-TTS checkpoint (.ckpt)")
+    parser.add_argument("--output-dir", required=True, help="Output directory")
+    parser.add_argument("--n-timesteps", type=int, default=3, help="ODE solver steps (default: 3)")
+    parser.add_argument("--opset", type=int, default=15, help="ONNX opset version")
+    parser.add_argument("--acoustic", action="store_true",
+                        help="Also export the batched single-graph model with a mel_lengths output")
+    parser.add_argument("--pad-id", type=int, default=0,
+                        help="Token id used to pad batches (written to the acoustic model metadata)")
+    args = parser.parse_args()
+
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    model = MatchaTTS.load_from_checkpoint(args.checkpoint, map_location="cpu")
+    model.eval()
+    n_feats = model.n_feats
+    n_speakers = model.n_spks
+    sid = torch.tensor([0], dtype=torch.long)
+    speaker_inputs = (sid,) if n_speakers > 1 else ()
+    speaker_names = ["sid"] if n_speakers > 1 else []
+
+    with torch.no_grad():
+        encoder = EncoderWrapper(model)
+        x = torch.randint(1, 50, (1, 20), dtype=torch.long)
+        x_length = torch.tensor([20], dtype=torch.long)
+        length_scale = torch.tensor([1.0], dtype=torch.float32)
+        encoder_path = os.path.join(args.output_dir, "encoder.onnx")
+        torch.onnx.export(
+            encoder, (x, x_length, length_scale) + speaker_inputs, encoder_path,
+            input_names=["x", "x_length", "length_scale"] + speaker_names,
+            output_names=["mu"],
+            dynamic_axes={"x": {1: "num_tokens"}, "mu": {2: "num_frames"}},
+            opset_version=args.opset,
+        )
+        print(f"Saved {encoder_path}")
+
+        decoder = DecoderWrapper(model, args.n_timesteps)
+        frames = 96
+        mu = torch.randn(1, n_feats, frames)
+        mask = torch.ones(1, 1, frames)
+        z = torch.randn(1, n_feats, frames)
+        decoder_path = os.path.join(args.output_dir, "decoder.onnx")
+        torch.onnx.export(
+            decoder, (mu, mask, z) + speaker_inputs, decoder_path,
+            input_names=["mu", "mask", "z"] + speaker_names,
+            output_names=["mel"],
+            dynamic_axes={
+                "mu": {2: "num_frames"},
+                "mask": {2: "num_frames"},
+                "z": {2: "num_frames"},
+                "mel": {2: "num_frames"},
+            },
+            opset_version=args.opset,
+        )
+        print(f"Saved {decoder_path}")
+
+        acoustic_path = None
+        if args.acoustic:
+            acoustic = AcousticWrapper(model, args.n_timesteps)
+            x = torch.randint(1, 50, (2, 20), dtype=torch.long)
+            x_length = torch.tensor([20, 12], dtype=torch.long)
+            noise_scale = torch.tensor([1.0], dtype=torch.float32)
+            batch_sid = torch.tensor([0, 0], dtype=torch.long)
+            acoustic_path = os.path.join(args.output_dir, f"model-steps-{args.n_timesteps}.onnx")
+            torch.onnx.export(
+                acoustic, (x, x_length, noise_scale, length_scale) + ((batch_sid,) if n_speakers > 1 else ()),
+                acoustic_path,
+                input_names=["x", "x_length", "noise_scale", "length_scale"] + speaker_names,
+                output_names=["mel", "mel_lengths"],
+                dynamic_axes={
+                    "x": {0: "batch", 1: "num_tokens"},
+                    "x_length": {0: "batch"},
+                    "mel": {0: "batch", 2: "num_frames"},
+                    "mel_lengths": {0: "batch"},
+                    **({"sid": {0: "batch"}} if n_speakers > 1 else {}),
+                },
+                opset_version=args.opset,
+            )
+            add_metadata(acoustic_path, {"pad_id": args.pad_id})
+            print(f"Saved {acoustic_path}")
+
+    if n_speakers > 1:
+        for path in (encoder_path, decoder_path, acoustic_path):
+            if path:
+                add_metadata(path, {"n_speakers": n_speakers})
+        print(f"Multi-speaker model: {n_speakers} speakers (sid input)")
+
+
+if __name__ == "__main__":
+    main()
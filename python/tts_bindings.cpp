@@ -4,12 +4,17 @@
 #include <pybind11/stl.h>
 
 #include <functional>
+#include <fstream>
 #include <memory>
+#include <mutex>
+#include <atomic>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "tts_api.hpp"
+#include "tts_server.hpp"
+#include "tts_sink.hpp"
 
 namespace py = pybind11;
 
@@ -22,6 +27,10 @@ namespace py = pybind11;
  *
  * 继承 TtsResultCallback，将 C++ 回调桥接到 Python 函数
  * 关键点：在调用 Python 回调时获取 GIL
+ *
+ * 自由线程 (free-threaded) CPython 下获取 GIL 不再互斥, 设置回调与引擎线程调用回调
+ * 可能同时发生, 因此回调函数由 mutex_ 保护: 调用方先取得 GIL 再加锁复制一份, 解锁后调用
+ * (复制/析构 py::function 需要 GIL; 加锁顺序固定为先 GIL 后 mutex_, 避免死锁)
  */
 class PyTtsCallback : public Evo::TtsResultCallback {
 public:
@@ -34,62 +43,90 @@ public:
     PyTtsCallback() = default;
     ~PyTtsCallback() override = default;
 
-    // 设置回调
-    void setOnOpen(OpenCallback cb) { on_open_ = std::move(cb); }
-    void setOnEvent(EventCallback cb) { on_event_ = std::move(cb); }
-    void setOnComplete(CompleteCallback cb) { on_complete_ = std::move(cb); }
-    void setOnError(ErrorCallback cb) { on_error_ = std::move(cb); }
-    void setOnClose(CloseCallback cb) { on_close_ = std::move(cb); }
+    // 设置回调 (从 Python 调用, 持有 GIL)
+    void setOnOpen(OpenCallback cb) { store(on_open_, std::move(cb)); }
+    void setOnEvent(EventCallback cb) { store(on_event_, std::move(cb)); }
+    void setOnComplete(CompleteCallback cb) { store(on_complete_, std::move(cb)); }
+    void setOnError(ErrorCallback cb) { store(on_error_, std::move(cb)); }
+    void setOnClose(CloseCallback cb) { store(on_close_, std::move(cb)); }
+
+    // 取消 (可从任意线程调用, 不需要 GIL)
+    void cancel() { cancelled_.store(true); }
+    bool IsCancelled() const override { return cancelled_.load(); }
 
     // 重写基类虚函数
     void OnOpen() override {
-        if (on_open_) {
-            py::gil_scoped_acquire acquire;  // 获取 GIL
-            on_open_();
+        py::gil_scoped_acquire acquire;  // 获取 GIL
+        if (auto cb = load(on_open_)) {
+            cb();
         }
     }
 
     void OnEvent(std::shared_ptr<Evo::TtsEngineResult> result) override {
-        if (on_event_) {
-            py::gil_scoped_acquire acquire;  // 获取 GIL
-            on_event_(result);
+        py::gil_scoped_acquire acquire;  // 获取 GIL
+        if (auto cb = load(on_event_)) {
+            cb(result);
         }
     }
 
     void OnComplete() override {
-        if (on_complete_) {
-            py::gil_scoped_acquire acquire;  // 获取 GIL
-            on_complete_();
+        py::gil_scoped_acquire acquire;  // 获取 GIL
+        if (auto cb = load(on_complete_)) {
+            cb();
         }
     }
 
     void OnError(const std::string& message) override {
-        if (on_error_) {
-            py::gil_scoped_acquire acquire;  // 获取 GIL
-            on_error_(message);
+        py::gil_scoped_acquire acquire;  // 获取 GIL
+        if (auto cb = load(on_error_)) {
+            cb(message);
         }
     }
 
     void OnClose() override {
-        if (on_close_) {
-            py::gil_scoped_acquire acquire;  // 获取 GIL
-            on_close_();
+        py::gil_scoped_acquire acquire;  // 获取 GIL
+        if (auto cb = load(on_close_)) {
+            cb();
         }
     }
 
 private:
+    template <typename Fn>
+    void store(Fn& slot, Fn cb) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::swap(slot, cb);
+        }
+        // 旧回调在锁外析构
+    }
+
+    template <typename Fn>
+    Fn load(const Fn& slot) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return slot;
+    }
+
+    mutable std::mutex mutex_;
     OpenCallback on_open_;
     EventCallback on_event_;
     CompleteCallback on_complete_;
     ErrorCallback on_error_;
     CloseCallback on_close_;
+    std::atomic<bool> cancelled_{false};
 };
 
 // =============================================================================
 // pybind11 模块定义
 // =============================================================================
 
+// 声明模块不依赖 GIL (pybind11 >= 2.13): 自由线程 CPython 下导入时不会重新启用 GIL。
+// 跨线程共享: TtsEngine 线程安全, 合成结果创建后只读, 回调对象自带锁;
+// TtsConfig、TtsClient、TtsAudioStream 的同一实例不要在多个线程间同时使用 (与 C++ 接口相同)
+#if defined(PYBIND11_VERSION_HEX) && PYBIND11_VERSION_HEX >= 0x020D0000
+PYBIND11_MODULE(_evo_tts, m, py::mod_gil_not_used()) {
+#else
 PYBIND11_MODULE(_evo_tts, m) {
+#endif
     m.doc() = "EvoTTS - Text-To-Speech Engine Python bindings";
 
     // =========================================================================
@@ -111,11 +148,82 @@ PYBIND11_MODULE(_evo_tts, m) {
         .value("MATCHA_ZH_EN", Evo::BackendType::MATCHA_ZH_EN,
             "Matcha Chinese-English bilingual (16000Hz)")
         .value("COSYVOICE", Evo::BackendType::COSYVOICE, "CosyVoice (reserved)")
-        .value("VITS", Evo::BackendType::VITS, "VITS (reserved)")
-        .value("PIPER", Evo::BackendType::PIPER, "Piper TTS (reserved)")
+        .value("VITS", Evo::BackendType::VITS, "VITS (Piper-format export)")
+        .value("PIPER", Evo::BackendType::PIPER, "Piper TTS")
         .value("KOKORO", Evo::BackendType::KOKORO, "Kokoro TTS (reserved)")
         .export_values();
 
+    py::enum_<Evo::ResidencyState>(m, "ResidencyState", "Model residency state")
+        .value("RESIDENT", Evo::ResidencyState::RESIDENT, "Models loaded, caches kept")
+        .value("TRIMMED", Evo::ResidencyState::TRIMMED, "Models loaded, caches released")
+        .value("UNLOADED", Evo::ResidencyState::UNLOADED, "Models unloaded, reloaded on next request")
+        .export_values();
+
+    py::class_<Evo::PreloadProgress>(m, "PreloadProgress", "Cache preload progress")
+        .def_readonly("total", &Evo::PreloadProgress::total, "Number of manifest entries")
+        .def_readonly("completed", &Evo::PreloadProgress::completed, "Entries processed (including failures)")
+        .def_readonly("synthesized", &Evo::PreloadProgress::synthesized, "Entries newly synthesized")
+        .def_readonly("from_cache", &Evo::PreloadProgress::from_cache, "Entries already in memory or disk cache")
+        .def_readonly("failed", &Evo::PreloadProgress::failed, "Entries that failed to synthesize")
+        .def_readonly("finished", &Evo::PreloadProgress::finished, "Preloading has ended")
+        .def("__repr__", [](const Evo::PreloadProgress& p) {
+            return "<PreloadProgress " + std::to_string(p.completed) + "/" + std::to_string(p.total) +
+                   (p.finished ? " finished>" : ">");
+        });
+
+    py::class_<Evo::TenantQuota>(m, "TenantQuota", "Per-tenant scheduling weight and quotas")
+        .def(py::init<>())
+        .def_readwrite("weight", &Evo::TenantQuota::weight, "Scheduling weight (share of synthesis time)")
+        .def_readwrite("max_in_flight", &Evo::TenantQuota::max_in_flight,
+            "Max concurrent requests (0 = unlimited); extra requests wait")
+        .def_readwrite("audio_seconds_per_second", &Evo::TenantQuota::audio_seconds_per_second,
+            "Audio seconds synthesized per wall-clock second (0 = unlimited)")
+        .def_readwrite("audio_burst_seconds", &Evo::TenantQuota::audio_burst_seconds,
+            "Burst allowance of the audio quota (seconds)");
+
+    py::class_<Evo::TenantStats>(m, "TenantStats", "Per-tenant scheduling metrics")
+        .def_readonly("tenant_id", &Evo::TenantStats::tenant_id, "Tenant ('' = untagged requests)")
+        .def_readonly("weight", &Evo::TenantStats::weight, "Current scheduling weight")
+        .def_readonly("in_flight", &Evo::TenantStats::in_flight, "Requests being processed")
+        .def_readonly("waiting_requests", &Evo::TenantStats::waiting_requests, "Requests waiting for max_in_flight")
+        .def_readonly("queued_segments", &Evo::TenantStats::queued_segments, "Sentences waiting to be scheduled")
+        .def_readonly("throttled", &Evo::TenantStats::throttled, "Audio quota exhausted")
+        .def_readonly("requests", &Evo::TenantStats::requests, "Completed requests")
+        .def_readonly("segments", &Evo::TenantStats::segments, "Synthesized sentences")
+        .def_readonly("audio_ms", &Evo::TenantStats::audio_ms, "Total synthesized audio (ms)")
+        .def_readonly("busy_ms", &Evo::TenantStats::busy_ms, "Total synthesis time (ms)")
+        .def_readonly("wait_ms", &Evo::TenantStats::wait_ms, "Total sentence queueing time (ms)")
+        .def_readonly("max_wait_ms", &Evo::TenantStats::max_wait_ms, "Longest sentence queueing time (ms)")
+        .def("__repr__", [](const Evo::TenantStats& s) {
+            return "<TenantStats '" + s.tenant_id + "' requests=" + std::to_string(s.requests) +
+                   " audio_ms=" + std::to_string(s.audio_ms) +
+                   " max_wait_ms=" + std::to_string(s.max_wait_ms) + ">";
+        });
+
+    py::class_<Evo::DocumentProgress>(m, "DocumentProgress", "Long document synthesis progress / resume position")
+        .def_readonly("byte_offset", &Evo::DocumentProgress::byte_offset, "End of the text written so far (bytes)")
+        .def_readonly("audio_samples", &Evo::DocumentProgress::audio_samples, "Samples written up to byte_offset")
+        .def_readonly("sample_rate", &Evo::DocumentProgress::sample_rate, "Sample rate (Hz)")
+        .def_readonly("sentences", &Evo::DocumentProgress::sentences, "Sentences synthesized in this call")
+        .def_readonly("finished", &Evo::DocumentProgress::finished, "Whole input synthesized")
+        .def_readonly("success", &Evo::DocumentProgress::success, "No read, synthesis or write error")
+        .def_readonly("message", &Evo::DocumentProgress::message, "Error message")
+        .def("audio_ms", &Evo::DocumentProgress::AudioMs, "Audio time at byte_offset (ms)")
+        .def("__repr__", [](const Evo::DocumentProgress& p) {
+            return "<DocumentProgress offset=" + std::to_string(p.byte_offset) +
+                   " audio_ms=" + std::to_string(p.AudioMs()) + (p.finished ? " finished>" : ">");
+        });
+
+    py::class_<Evo::ModelMemoryStats>(m, "ModelMemoryStats", "Model weight and arena residency")
+        .def_readonly("mapped_bytes", &Evo::ModelMemoryStats::mapped_bytes, "Bytes mapped for weights and arena")
+        .def_readonly("resident_bytes", &Evo::ModelMemoryStats::resident_bytes, "Bytes currently resident in RAM")
+        .def_readonly("locked_bytes", &Evo::ModelMemoryStats::locked_bytes, "Bytes locked with mlock")
+        .def("__repr__", [](const Evo::ModelMemoryStats& s) {
+            return "<ModelMemoryStats resident=" + std::to_string(s.resident_bytes) +
+                   " mapped=" + std::to_string(s.mapped_bytes) +
+                   " locked=" + std::to_string(s.locked_bytes) + ">";
+        });
+
     // =========================================================================
     // TtsConfig - 配置结构
     // =========================================================================
@@ -138,8 +246,61 @@ PYBIND11_MODULE(_evo_tts, m) {
         .def_readwrite("compression_ratio", &Evo::TtsConfig::compression_ratio, "Compression ratio")
         .def_readwrite("use_rms_norm", &Evo::TtsConfig::use_rms_norm, "Use RMS normalization")
         .def_readwrite("remove_clicks", &Evo::TtsConfig::remove_clicks, "Remove clicks")
+        .def_readwrite("trim_silence", &Evo::TtsConfig::trim_silence, "Trim leading/trailing silence")
+        .def_readwrite("silence_threshold_db", &Evo::TtsConfig::silence_threshold_db,
+            "Silence threshold (frame RMS, dBFS)")
+        .def_readwrite("sentence_gap_ms", &Evo::TtsConfig::sentence_gap_ms,
+            "Silence inserted between sentences (ms); only where text is synthesized sentence by "
+            "sentence (streaming, documents, tenant scheduling), not by call()")
         .def_readwrite("num_threads", &Evo::TtsConfig::num_threads, "Number of inference threads")
         .def_readwrite("enable_warmup", &Evo::TtsConfig::enable_warmup, "Enable warmup on startup")
+        .def_readwrite("execution_providers", &Evo::TtsConfig::execution_providers,
+            "Execution providers in priority order (e.g. ['xnnpack', 'cpu']), empty = CPU only")
+        .def_readwrite("provider_options", &Evo::TtsConfig::provider_options,
+            "Per-provider options, e.g. {'xnnpack': {'intra_op_num_threads': '4'}}")
+        .def_readwrite("model_prefetch", &Evo::TtsConfig::model_prefetch,
+            "Read model files into the page cache in the background during init")
+        .def_readwrite("model_mlock", &Evo::TtsConfig::model_mlock,
+            "Lock weights and inference arena in memory (mlock)")
+        .def_readwrite("model_huge_pages", &Evo::TtsConfig::model_huge_pages,
+            "Use transparent huge pages for weights and inference arena")
+        .def_readwrite("shared_allocator", &Evo::TtsConfig::shared_allocator,
+            "Share one ORT CPU allocator across all engines in the process")
+        .def_readwrite("arena_max_mb", &Evo::TtsConfig::arena_max_mb,
+            "Shared arena size limit (MB, 0 = unlimited), set by the first engine")
+        .def_readwrite("engine_tag", &Evo::TtsConfig::engine_tag,
+            "Engine tag for ORT log attribution (empty = auto 'engine-N')")
+        .def_readwrite("idle_trim_ms", &Evo::TtsConfig::idle_trim_ms,
+            "Release inference caches after this idle time (0 = off)")
+        .def_readwrite("idle_unload_ms", &Evo::TtsConfig::idle_unload_ms,
+            "Unload models after this idle time (0 = off), reloaded on next request")
+        .def_readwrite("batch_window_ms", &Evo::TtsConfig::batch_window_ms,
+            "Window for merging concurrent requests into one batch (ms, 0 = off)")
+        .def_readwrite("max_batch_size", &Evo::TtsConfig::max_batch_size, "Maximum requests per batch")
+        .def_readwrite("max_batch_chars", &Evo::TtsConfig::max_batch_chars,
+            "Maximum padded characters per batch (longest text x batch size)")
+        .def_readwrite("stream_chunk_frames", &Evo::TtsConfig::stream_chunk_frames,
+            "Mel frames per chunk in streaming synthesis")
+        .def_readwrite("frontend_lookahead", &Evo::TtsConfig::frontend_lookahead,
+            "Sentences prepared ahead of inference in streaming synthesis (0 = off)")
+        .def_readwrite("token_buckets", &Evo::TtsConfig::token_buckets,
+            "Token length buckets for acoustic model inputs (empty = off)")
+        .def_readwrite("mel_frame_buckets", &Evo::TtsConfig::mel_frame_buckets,
+            "Mel frame buckets for vocoder inputs (empty = off)")
+        .def_readwrite("vocoder_istft", &Evo::TtsConfig::vocoder_istft,
+            "Where the vocoder ISTFT runs: 'auto', 'graph' (vocos-*-istft.onnx) or 'cpp'")
+        .def_readwrite("cache_max_mb", &Evo::TtsConfig::cache_max_mb,
+            "In-memory audio cache size (MB, 0 = off)")
+        .def_readwrite("cache_dir", &Evo::TtsConfig::cache_dir,
+            "Directory for the persisted cache tier (empty = memory only)")
+        .def_readwrite("preload_manifest", &Evo::TtsConfig::preload_manifest,
+            "Prompt manifest synthesized into the cache after init")
+        .def_readwrite("preload_async", &Evo::TtsConfig::preload_async,
+            "Preload in the background (False = finish during construction)")
+        .def_readwrite("coalesce_requests", &Evo::TtsConfig::coalesce_requests,
+            "Synthesize identical concurrent requests once and share the result")
+        .def_readwrite("tenant_scheduling", &Evo::TtsConfig::tenant_scheduling,
+            "Weighted fair scheduling by tenant at sentence granularity (see call_as)")
 
         // 静态工厂方法
         .def_static("Default", &Evo::TtsConfig::Default,
@@ -153,6 +314,10 @@ PYBIND11_MODULE(_evo_tts, m) {
         .def_static("MatchaZHEN", &Evo::TtsConfig::MatchaZHEN,
                     py::arg("model_dir") = "~/.cache/matcha-tts",
                     "Create Matcha Chinese-English bilingual configuration")
+        .def_static("Piper", &Evo::TtsConfig::Piper,
+                    py::arg("model_dir") = "~/.cache/piper-tts",
+                    py::arg("voice") = "default",
+                    "Create Piper configuration (<voice>.onnx + <voice>.onnx.json in model_dir)")
 
         // Builder 方法（链式调用）
         .def("withSpeed", &Evo::TtsConfig::withSpeed,
@@ -186,6 +351,15 @@ PYBIND11_MODULE(_evo_tts, m) {
             "Get audio as float32 array [-1.0, 1.0]")
         .def("get_audio_int16", &Evo::TtsEngineResult::GetAudioInt16,
             "Get audio as int16 array (PCM)")
+        // 零拷贝读取: numpy 视图引用结果对象, 结果对象随视图存活
+        .def("audio_view", [](std::shared_ptr<Evo::TtsEngineResult> self) {
+            const auto& samples = self->GetAudioFloatRef();
+            auto view = py::array_t<float>(
+                {static_cast<py::ssize_t>(samples.size())}, {static_cast<py::ssize_t>(sizeof(float))},
+                samples.empty() ? nullptr : samples.data(), py::cast(self));
+            view.attr("setflags")(py::arg("write") = false);
+            return view;
+        }, "Get audio as a read-only zero-copy float32 numpy view [-1.0, 1.0]")
 
         // 元信息
         .def("get_timestamp", &Evo::TtsEngineResult::GetTimestamp,
@@ -268,7 +442,11 @@ PYBIND11_MODULE(_evo_tts, m) {
             "Set callback for errors")
         .def("on_close", &PyTtsCallback::setOnClose,
             py::arg("callback"),
-            "Set callback for connection close");
+            "Set callback for connection close")
+        .def("cancel", &PyTtsCallback::cancel,
+            "Cancel the synthesis this callback is attached to")
+        .def("is_cancelled", &PyTtsCallback::IsCancelled,
+            "Check whether cancel() has been called");
 
     // =========================================================================
     // TtsEngine - 主引擎
@@ -291,9 +469,55 @@ PYBIND11_MODULE(_evo_tts, m) {
         }, py::arg("text"),
             "Synthesize text (blocking, releases GIL)")
 
+        .def("call_with_speaker", [](Evo::TtsEngine& self, const std::string& text, int speaker_id) {
+            py::gil_scoped_release release;
+            return self.Call(text, speaker_id);
+        }, py::arg("text"), py::arg("speaker_id"),
+            "Synthesize text with a per-request speaker (blocking, releases GIL)")
+
+        .def("call_many", [](Evo::TtsEngine& self, const std::vector<std::string>& texts, int max_workers) {
+            py::gil_scoped_release release;
+            return self.CallMany(texts, max_workers);
+        }, py::arg("texts"), py::arg("max_workers") = 0,
+            "Synthesize many texts with batching / worker threads; results in input order (releases GIL)")
+        .def("call_many_each", [](Evo::TtsEngine& self, const std::vector<std::string>& texts,
+                                  py::function on_result, int max_workers) {
+            // 回调异常不能穿过工作线程: 记下第一个, 之后的回调跳过, 返回前重新抛出。
+            // CallMany 串行调用 on_result, callback_error 不需要另外加锁 (自由线程下同样成立)
+            std::unique_ptr<py::error_already_set> callback_error;
+            auto deliver = [&on_result, &callback_error](size_t index,
+                                                         std::shared_ptr<Evo::TtsEngineResult> result) {
+                py::gil_scoped_acquire acquire;  // 获取 GIL
+                if (callback_error) {
+                    return;
+                }
+                try {
+                    on_result(index, result);
+                } catch (py::error_already_set& e) {
+                    callback_error = std::make_unique<py::error_already_set>(std::move(e));
+                }
+            };
+            {
+                py::gil_scoped_release release;
+                self.CallMany(texts, deliver, max_workers);
+            }
+            if (callback_error) {
+                throw std::move(*callback_error);
+            }
+        }, py::arg("texts"), py::arg("on_result"), py::arg("max_workers") = 0,
+            "Synthesize many texts, calling on_result(index, result) in completion order (releases GIL)")
+
+        .def("call_as", [](Evo::TtsEngine& self, const std::string& tenant_id,
+                           const std::string& text, int speaker_id) {
+            py::gil_scoped_release release;
+            return self.CallAs(tenant_id, text, speaker_id);
+        }, py::arg("tenant_id"), py::arg("text"), py::arg("speaker_id") = -1,
+            "Synthesize text on behalf of a tenant (blocking, releases GIL)")
+
+        // config 按值传入: 释放 GIL 后其他线程修改同一个 Config 对象不影响本次合成
         .def("call_with_config", [](Evo::TtsEngine& self,
             const std::string& text,
-            const Evo::TtsConfig& config) {
+            Evo::TtsConfig config) {
             py::gil_scoped_release release;
             return self.Call(text, config);
         }, py::arg("text"), py::arg("config"),
@@ -307,12 +531,70 @@ PYBIND11_MODULE(_evo_tts, m) {
         }, py::arg("text"), py::arg("file_path"),
             "Synthesize text and save to file (blocking, releases GIL)")
 
-        // 流式调用
-        .def("streaming_call", &Evo::TtsEngine::StreamingCall,
-            py::arg("text"),
+        // 长文档合成: 读文本文件写 WAV, 可从上次进度续合成
+        .def("synthesize_document", [](Evo::TtsEngine& self,
+            const std::string& input_path,
+            const std::string& output_path,
+            uint64_t start_offset,
+            uint64_t start_audio_samples,
+            py::object on_progress,
+            const std::string& tenant_id) {
+            std::ifstream input(input_path, std::ios::binary);
+            if (!input) {
+                throw std::runtime_error("Cannot open input: " + input_path);
+            }
+            const bool resume = start_offset > 0 || start_audio_samples > 0;
+            std::unique_ptr<Evo::WavFileSink> sink = resume
+                ? std::make_unique<Evo::WavFileSink>(output_path, start_audio_samples)
+                : std::make_unique<Evo::WavFileSink>(output_path);
+
+            Evo::DocumentOptions options;
+            options.tenant_id = tenant_id;
+            options.start_offset = start_offset;
+            options.start_audio_samples = start_audio_samples;
+            // 回调异常不能穿过 C++ 合成循环: 记下后停止, 返回前重新抛出。
+            // on_progress 只在合成线程上调用, 合成返回后才读取 callback_error
+            std::unique_ptr<py::error_already_set> callback_error;
+            if (!on_progress.is_none()) {
+                options.on_progress = [&on_progress, &callback_error](const Evo::DocumentProgress& p) {
+                    py::gil_scoped_acquire acquire;  // 获取 GIL
+                    try {
+                        py::object keep_going = on_progress(p);
+                        return keep_going.is_none() || keep_going.cast<bool>();
+                    } catch (py::error_already_set& e) {
+                        callback_error = std::make_unique<py::error_already_set>(std::move(e));
+                        return false;
+                    }
+                };
+            }
+
+            Evo::DocumentProgress progress;
+            {
+                py::gil_scoped_release release;
+                progress = self.SynthesizeStream(input, *sink, options);
+            }
+            if (callback_error) {
+                throw std::move(*callback_error);
+            }
+            return progress;
+        }, py::arg("input_path"), py::arg("output_path"),
+            py::arg("start_offset") = 0, py::arg("start_audio_samples") = 0,
+            py::arg("on_progress") = py::none(), py::arg("tenant_id") = "",
+            "Synthesize a UTF-8 text file into a WAV file with bounded memory (releases GIL). "
+            "on_progress(progress) may return False to stop; pass progress.byte_offset and "
+            "progress.audio_samples back to resume")
+
+        // 流式调用 - 释放 GIL, 回调中再获取
+        .def("streaming_call", [](Evo::TtsEngine& self,
+            const std::string& text,
+            std::shared_ptr<Evo::TtsResultCallback> callback,
+            Evo::TtsConfig config) {
+            py::gil_scoped_release release;
+            self.StreamingCall(text, std::move(callback), config);
+        }, py::arg("text"),
             py::arg("callback"),
             py::arg("config") = Evo::TtsConfig(),
-            "Streaming synthesis with callback")
+            "Streaming synthesis with callback (releases GIL; callbacks reacquire it)")
 
         // 注意：DuplexStream 暂不绑定（需要额外的包装类）
 
@@ -329,6 +611,35 @@ PYBIND11_MODULE(_evo_tts, m) {
         .def("get_config", &Evo::TtsEngine::GetConfig,
             "Get current configuration")
 
+        // 资源管理
+        .def("get_residency_state", &Evo::TtsEngine::GetResidencyState,
+            "Get model residency state")
+        .def("prewake", &Evo::TtsEngine::Prewake,
+            "Reload models in the background ahead of an expected request")
+        .def("release_resources", [](Evo::TtsEngine& self, Evo::ResidencyState level) {
+            py::gil_scoped_release release;
+            self.ReleaseResources(level);
+        }, py::arg("level"),
+            "Release resources now (TRIMMED or UNLOADED)")
+        .def("reload", [](Evo::TtsEngine& self, const Evo::TtsConfig& config) {
+            py::gil_scoped_release release;
+            return self.Reload(config);
+        }, py::arg("config"),
+            "Load and warm a new model, then swap it in without dropping requests (releases GIL)")
+        .def("try_reload_if_changed", [](Evo::TtsEngine& self) {
+            py::gil_scoped_release release;
+            return self.TryReloadIfChanged();
+        }, "Reload if the model files changed (size, mtime or content hash); returns True if reloaded")
+        .def("get_preload_progress", &Evo::TtsEngine::GetPreloadProgress,
+            "Get cache preload progress")
+        .def("set_tenant_quota", &Evo::TtsEngine::SetTenantQuota,
+            py::arg("tenant_id"), py::arg("quota"),
+            "Set a tenant's weight, max in-flight requests and audio quota")
+        .def("get_tenant_stats", &Evo::TtsEngine::GetTenantStats,
+            "Get per-tenant scheduling metrics")
+        .def("get_model_memory_stats", &Evo::TtsEngine::GetModelMemoryStats,
+            "Get mapped, resident and locked bytes of model weights and arena")
+
         // 辅助方法
         .def("is_initialized", &Evo::TtsEngine::IsInitialized,
             "Check if engine is initialized")
@@ -350,6 +661,96 @@ PYBIND11_MODULE(_evo_tts, m) {
                 " initialized=" + (engine.IsInitialized() ? "true" : "false") + ">";
         });
 
+    // =========================================================================
+    // TtsAudioStream - 共享内存音频流
+    // =========================================================================
+
+    py::class_<Evo::TtsAudioStream, std::shared_ptr<Evo::TtsAudioStream>>(
+        m, "TtsAudioStream", "Shared-memory audio stream from a TTS server (Linux only)")
+        .def_static("attach", [](int memfd, int data_fd, int space_fd) {
+            Evo::AudioStreamHandle handle;
+            handle.memfd = memfd;
+            handle.data_fd = data_fd;
+            handle.space_fd = space_fd;
+            return Evo::TtsAudioStream::Attach(handle);
+        }, py::arg("memfd"), py::arg("data_fd"), py::arg("space_fd"),
+            "Attach to a stream by handle (takes ownership of the fds)")
+
+        // 零拷贝读取: 返回指向共享内存的 numpy 视图, 在 consume() 之前有效
+        .def("read", [](std::shared_ptr<Evo::TtsAudioStream> self, int timeout_ms) {
+            const float* samples = nullptr;
+            size_t n;
+            {
+                py::gil_scoped_release release;
+                n = self->Read(&samples, timeout_ms);
+            }
+            auto view = py::array_t<float>(
+                {static_cast<py::ssize_t>(n)}, {static_cast<py::ssize_t>(sizeof(float))},
+                n > 0 ? samples : nullptr, py::cast(self));
+            view.attr("setflags")(py::arg("write") = false);
+            return view;
+        }, py::arg("timeout_ms") = -1,
+            "Wait for audio and return a zero-copy float32 view (valid until consume()); "
+            "empty array at end of stream or on timeout")
+        .def("consume", &Evo::TtsAudioStream::Consume,
+            py::arg("num_samples"),
+            "Release samples returned by read()")
+        .def("read_all", [](Evo::TtsAudioStream& self) {
+            py::gil_scoped_release release;
+            return self.ReadAll();
+        }, "Read the remaining audio into a TtsEngineResult (copies)")
+        .def("is_finished", &Evo::TtsAudioStream::IsFinished,
+            "Check if the writer closed and all audio was consumed")
+        .def("is_success", &Evo::TtsAudioStream::IsSuccess,
+            "Check if the stream has not failed")
+        .def("get_message", &Evo::TtsAudioStream::GetMessage,
+            "Get error message")
+        .def("get_sample_rate", &Evo::TtsAudioStream::GetSampleRate,
+            "Get sample rate (Hz)");
+
+    // =========================================================================
+    // TtsClient - 本地服务客户端
+    // =========================================================================
+
+    py::class_<Evo::TtsClient>(m, "TtsClient", "Client for a local TTS worker pool")
+        .def(py::init<const std::string&>(),
+            py::arg("socket_path") = "/tmp/evo_tts.sock",
+            "Create client for the server socket")
+        .def("connect", &Evo::TtsClient::Connect,
+            "Connect to server")
+        .def("close", &Evo::TtsClient::Close,
+            "Close connection")
+        .def("is_connected", &Evo::TtsClient::IsConnected,
+            "Check if connected")
+        .def("call", [](Evo::TtsClient& self, const std::string& text, float speech_rate) {
+            py::gil_scoped_release release;
+            return self.Call(text, speech_rate);
+        }, py::arg("text"), py::arg("speech_rate") = 0.0f,
+            "Synthesize text over the socket (blocking, releases GIL)")
+        .def("call_stream", [](Evo::TtsClient& self, const std::string& text, float speech_rate) {
+            py::gil_scoped_release release;
+            return self.CallStream(text, speech_rate);
+        }, py::arg("text"), py::arg("speech_rate") = 0.0f,
+            "Synthesize text into a shared-memory stream (Linux only, None on failure)")
+        .def("get_worker_stats", [](Evo::TtsClient& self) {
+            py::list out;
+            for (const auto& s : self.GetWorkerStats()) {
+                py::dict d;
+                d["index"] = s.index;
+                d["pid"] = s.pid;
+                d["alive"] = s.alive;
+                d["restarts"] = s.restarts;
+                d["requests"] = s.requests;
+                d["failures"] = s.failures;
+                d["audio_ms"] = s.audio_ms;
+                d["busy_ms"] = s.busy_ms;
+                d["text_bytes"] = s.text_bytes;
+                d["last_active_ms"] = s.last_active_ms;
+                out.append(d);
+            }
+            return out;
+        }, "Get per-worker statistics");
+
     // =========================================================================
     // 模块级属性
     // =========================================================================
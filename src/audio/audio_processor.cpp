@@ -211,20 +211,211 @@ std::vector<float> resampleAudio(const std::vector<float>& audio,
     return resampled;
 }
 
+// =============================================================================
+// 静音裁剪
+// =============================================================================
+
+namespace {
+
+size_t msToSamples(int ms, int sample_rate) {
+    if (ms <= 0 || sample_rate <= 0) return 0;
+    return static_cast<size_t>(static_cast<int64_t>(ms) * sample_rate / 1000);
+}
+
+// 帧均方值 (与阈值的平方比较, 省去开方)
+float frameMeanSquare(const float* samples, size_t n) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < n; ++i) {
+        sum += samples[i] * samples[i];
+    }
+    return n > 0 ? sum / n : 0.0f;
+}
+
+float silenceThresholdSquared(const AudioProcessConfig& config) {
+    return std::pow(10.0f, config.silence_threshold_db / 10.0f);
+}
+
+}  // namespace
+
+size_t findSpeechStart(const float* audio, size_t num_samples,
+                       const AudioProcessConfig& config) {
+    const size_t frame = std::max<size_t>(1, msToSamples(config.silence_frame_ms, config.sample_rate));
+    const float threshold = silenceThresholdSquared(config);
+
+    for (size_t pos = 0; pos < num_samples; pos += frame) {
+        size_t n = std::min(frame, num_samples - pos);
+        if (frameMeanSquare(audio + pos, n) >= threshold) {
+            size_t keep = msToSamples(config.silence_keep_ms, config.sample_rate);
+            return pos > keep ? pos - keep : 0;
+        }
+    }
+    return num_samples;
+}
+
+size_t findSpeechEnd(const float* audio, size_t num_samples,
+                     const AudioProcessConfig& config) {
+    const size_t frame = std::max<size_t>(1, msToSamples(config.silence_frame_ms, config.sample_rate));
+    const float threshold = silenceThresholdSquared(config);
+
+    for (size_t end = num_samples; end > 0;) {
+        size_t n = std::min(frame, end);
+        if (frameMeanSquare(audio + end - n, n) >= threshold) {
+            size_t keep = msToSamples(config.silence_keep_ms, config.sample_rate);
+            return std::min(num_samples, end + keep);
+        }
+        end -= n;
+    }
+    return 0;
+}
+
+std::vector<float> trimSilence(const std::vector<float>& audio,
+                               const AudioProcessConfig& config,
+                               bool trim_leading,
+                               bool trim_trailing) {
+    size_t begin = trim_leading ? findSpeechStart(audio.data(), audio.size(), config) : 0;
+    size_t end = trim_trailing ? findSpeechEnd(audio.data(), audio.size(), config) : audio.size();
+    if (end <= begin) {
+        return {};
+    }
+    return std::vector<float>(audio.begin() + begin, audio.begin() + end);
+}
+
 // =============================================================================
 // 完整处理流程
 // =============================================================================
 
 std::vector<float> processAudio(const std::vector<float>& audio,
-                                const AudioProcessConfig& config) {
+                                const AudioProcessConfig& config,
+                                const ChunkPosition& position) {
     if (audio.empty()) return audio;
 
-    // Step 1: Normalize
-    std::vector<float> processed = normalizeAudio(audio, config);
+    // Step 1: Locate speech (trim leading/trailing silence)
+    size_t begin = 0;
+    size_t end = audio.size();
+    if (config.trim_silence) {
+        if (position.segment_start) {
+            begin = findSpeechStart(audio.data(), audio.size(), config);
+        }
+        if (position.segment_end) {
+            end = std::max(begin, findSpeechEnd(audio.data(), audio.size(), config));
+        }
+    }
+
+    std::vector<float> processed;
+    if (end > begin) {
+        // Step 2: Normalize the speech span only
+        processed = normalizeAudio(std::vector<float>(audio.begin() + begin, audio.begin() + end),
+                                   config);
+
+        // Step 3: Remove clicks (optional)
+        if (config.remove_clicks) {
+            processed = removeClicksAndPops(processed);
+        }
+    }
+
+    // Step 4: Deterministic inter-sentence gap
+    if (position.segment_end && !position.last_segment) {
+        processed.resize(processed.size() + msToSamples(config.sentence_gap_ms, config.sample_rate),
+                         0.0f);
+    }
+
+    return processed;
+}
+
+// =============================================================================
+// 流式后处理
+// =============================================================================
+
+StreamingAudioProcessor::StreamingAudioProcessor(const AudioProcessConfig& config)
+    : config_(config) {
+}
+
+std::vector<float> StreamingAudioProcessor::process(const std::vector<float>& audio,
+                                                    const ChunkPosition& position) {
+    if (position.segment_start) {
+        gain_ = 1.0f;
+        gain_fixed_ = false;
+        speech_started_ = false;
+        hp_prev_input_ = 0.0f;
+        hp_prev_output_ = 0.0f;
+    }
+
+    // Step 1: Locate speech; leading silence is dropped until speech starts
+    size_t begin = 0;
+    size_t end = audio.size();
+    if (config_.trim_silence) {
+        if (!speech_started_) {
+            begin = findSpeechStart(audio.data(), audio.size(), config_);
+        }
+        if (position.segment_end) {
+            end = std::max(begin, findSpeechEnd(audio.data(), audio.size(), config_));
+        }
+    }
+
+    std::vector<float> processed;
+    if (end > begin) {
+        processed = applyCompression(std::vector<float>(audio.begin() + begin, audio.begin() + end),
+                                     config_.compression_threshold, config_.compression_ratio);
+
+        // Step 2: Gain is fixed by the first chunk that contains speech
+        if (!gain_fixed_) {
+            float level = 0.0f;
+            if (config_.use_rms_norm) {
+                level = calculateRMS(processed);
+                gain_ = level > 0.0f ? std::min(config_.target_rms / level, 3.0f) : 1.0f;
+            } else {
+                for (float sample : processed) {
+                    level = std::max(level, std::abs(sample));
+                }
+                gain_ = level > 0.0f ? 0.8f / level : 1.0f;
+            }
+            gain_fixed_ = true;
+        }
+        for (float& sample : processed) {
+            sample *= gain_;
+            if (config_.use_rms_norm && std::abs(sample) > 0.95f) {
+                float sign = (sample < 0) ? -1.0f : 1.0f;
+                sample = sign * (0.95f + 0.05f * std::tanh((std::abs(sample) - 0.95f) * 20.0f));
+            }
+        }
+
+        // Step 3: Click removal with state carried across chunks
+        if (config_.remove_clicks) {
+            if (!speech_started_) {
+                const int fade_in_samples = std::min(44, static_cast<int>(processed.size() / 100));
+                for (int i = 0; i < fade_in_samples; ++i) {
+                    float fade_factor = 0.5f * (1.0f - std::cos(M_PI * i / fade_in_samples));
+                    processed[i] *= fade_factor;
+                }
+            }
+            if (position.segment_end) {
+                const int fade_out_samples = std::min(110, static_cast<int>(processed.size() / 50));
+                for (int i = 0; i < fade_out_samples; ++i) {
+                    size_t idx = processed.size() - 1 - i;
+                    float fade_factor = 0.5f * (1.0f - std::cos(M_PI * i / fade_out_samples));
+                    processed[idx] *= fade_factor;
+                }
+            }
+
+            const float cutoff = 0.999f;
+            for (float& sample : processed) {
+                float current_output = cutoff * (hp_prev_output_ + sample - hp_prev_input_);
+                hp_prev_input_ = sample;
+                hp_prev_output_ = current_output;
+                sample = current_output;
+            }
+            if (position.segment_end && !processed.empty()) {
+                processed.back() = 0.0f;
+            }
+        }
+
+        speech_started_ = true;
+    }
 
-    // Step 2: Remove clicks (optional)
-    if (config.remove_clicks) {
-        processed = removeClicksAndPops(processed);
+    // Step 4: Deterministic inter-sentence gap
+    if (position.segment_end && !position.last_segment) {
+        processed.resize(processed.size() + msToSamples(config_.sentence_gap_ms, config_.sample_rate),
+                         0.0f);
     }
 
     return processed;
@@ -0,0 +1,241 @@
+#include "tts_sink.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include <filesystem>  // NOLINT(build/c++17)
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace Evo {
+
+namespace {
+
+constexpr size_t kWavHeaderSize = 44;
+
+// float [-1.0, 1.0] -> int16 (与 TtsEngineResult::GetAudioInt16 一致)
+void convertToInt16(const float* samples, size_t num_samples, std::vector<int16_t>& out) {
+    out.resize(num_samples);
+    for (size_t i = 0; i < num_samples; ++i) {
+        float sample = samples[i];
+        if (sample > 1.0f) sample = 1.0f;
+        if (sample < -1.0f) sample = -1.0f;
+        out[i] = static_cast<int16_t>(sample * 32767.0f);
+    }
+}
+
+void putU32(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+void putU16(uint8_t* p, uint16_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+// 16-bit 单声道 PCM WAV 头部
+void buildWavHeader(uint8_t* header, int sample_rate, uint32_t data_size) {
+    const uint16_t channels = 1;
+    const uint16_t bits_per_sample = 16;
+    const uint16_t block_align = channels * bits_per_sample / 8;
+
+    std::memcpy(header, "RIFF", 4);
+    putU32(header + 4, 36 + data_size);
+    std::memcpy(header + 8, "WAVE", 4);
+    std::memcpy(header + 12, "fmt ", 4);
+    putU32(header + 16, 16);
+    putU16(header + 20, 1);  // PCM
+    putU16(header + 22, channels);
+    putU32(header + 24, static_cast<uint32_t>(sample_rate));
+    putU32(header + 28, static_cast<uint32_t>(sample_rate) * block_align);
+    putU16(header + 32, block_align);
+    putU16(header + 34, bits_per_sample);
+    std::memcpy(header + 36, "data", 4);
+    putU32(header + 40, data_size);
+}
+
+// 续写: 把已有文件截断到 header_size + resume_samples 个样本, 并以读写方式打开到末尾
+// 文件比续写位置短 (被删改过) 时失败; 文件不存在且 resume_samples 为 0 时按新文件处理
+bool openForResume(const std::string& path, size_t header_size, uint64_t resume_samples,
+                   std::fstream& file) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    const uintmax_t keep = header_size + resume_samples * sizeof(int16_t);
+    const uintmax_t size = fs::file_size(path, ec);
+    if (ec || size < keep) {
+        return false;
+    }
+    fs::resize_file(path, keep, ec);
+    if (ec) {
+        return false;
+    }
+    file.open(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(0, std::ios::end);
+    return file.good();
+}
+
+}  // namespace
+
+// =============================================================================
+// WavFileSink
+// =============================================================================
+
+struct WavFileSink::Impl {
+    std::string file_path;
+    std::fstream file;
+    int sample_rate = 0;
+    size_t num_samples = 0;
+    bool resume = false;
+    uint64_t resume_samples = 0;
+    std::vector<int16_t> buffer;
+};
+
+WavFileSink::WavFileSink(const std::string& file_path)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->file_path = file_path;
+}
+
+WavFileSink::WavFileSink(const std::string& file_path, uint64_t resume_samples)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->file_path = file_path;
+    impl_->resume = true;
+    impl_->resume_samples = resume_samples;
+}
+
+WavFileSink::~WavFileSink() {
+    if (impl_->file.is_open()) {
+        Close();
+    }
+}
+
+bool WavFileSink::Open(int sample_rate) {
+    impl_->sample_rate = sample_rate;
+    if (impl_->resume && (impl_->resume_samples > 0 || std::filesystem::exists(impl_->file_path))) {
+        // 头部的长度字段由 Close() 按保留样本数 + 新写入样本数重写
+        if (!openForResume(impl_->file_path, kWavHeaderSize, impl_->resume_samples, impl_->file)) {
+            return false;
+        }
+        impl_->num_samples = static_cast<size_t>(impl_->resume_samples);
+        return true;
+    }
+
+    impl_->file.open(impl_->file_path, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!impl_->file) {
+        return false;
+    }
+    impl_->num_samples = 0;
+
+    // 先写入长度为 0 的头部, Close() 时回填
+    uint8_t header[kWavHeaderSize];
+    buildWavHeader(header, sample_rate, 0);
+    impl_->file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    return impl_->file.good();
+}
+
+bool WavFileSink::Write(const float* samples, size_t num_samples) {
+    if (!impl_->file.is_open()) {
+        return false;
+    }
+    convertToInt16(samples, num_samples, impl_->buffer);
+    impl_->file.write(reinterpret_cast<const char*>(impl_->buffer.data()),
+                      static_cast<std::streamsize>(num_samples * sizeof(int16_t)));
+    impl_->num_samples += num_samples;
+    return impl_->file.good();
+}
+
+bool WavFileSink::Close() {
+    if (!impl_->file.is_open()) {
+        return false;
+    }
+
+    uint8_t header[kWavHeaderSize];
+    buildWavHeader(header, impl_->sample_rate,
+                   static_cast<uint32_t>(impl_->num_samples * sizeof(int16_t)));
+    impl_->file.seekp(0);
+    impl_->file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    bool ok = impl_->file.good();
+    impl_->file.close();
+    return ok;
+}
+
+size_t WavFileSink::GetNumSamples() const {
+    return impl_->num_samples;
+}
+
+// =============================================================================
+// PcmFileSink
+// =============================================================================
+
+struct PcmFileSink::Impl {
+    std::string file_path;
+    std::fstream file;
+    size_t num_samples = 0;
+    bool resume = false;
+    uint64_t resume_samples = 0;
+    std::vector<int16_t> buffer;
+};
+
+PcmFileSink::PcmFileSink(const std::string& file_path)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->file_path = file_path;
+}
+
+PcmFileSink::PcmFileSink(const std::string& file_path, uint64_t resume_samples)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->file_path = file_path;
+    impl_->resume = true;
+    impl_->resume_samples = resume_samples;
+}
+
+PcmFileSink::~PcmFileSink() {
+    if (impl_->file.is_open()) {
+        Close();
+    }
+}
+
+bool PcmFileSink::Open(int sample_rate) {
+    (void)sample_rate;
+    if (impl_->resume && (impl_->resume_samples > 0 || std::filesystem::exists(impl_->file_path))) {
+        if (!openForResume(impl_->file_path, 0, impl_->resume_samples, impl_->file)) {
+            return false;
+        }
+        impl_->num_samples = static_cast<size_t>(impl_->resume_samples);
+        return true;
+    }
+    impl_->file.open(impl_->file_path, std::ios::binary | std::ios::out | std::ios::trunc);
+    impl_->num_samples = 0;
+    return impl_->file.good();
+}
+
+bool PcmFileSink::Write(const float* samples, size_t num_samples) {
+    if (!impl_->file.is_open()) {
+        return false;
+    }
+    convertToInt16(samples, num_samples, impl_->buffer);
+    impl_->file.write(reinterpret_cast<const char*>(impl_->buffer.data()),
+                      static_cast<std::streamsize>(num_samples * sizeof(int16_t)));
+    impl_->num_samples += num_samples;
+    return impl_->file.good();
+}
+
+bool PcmFileSink::Close() {
+    if (!impl_->file.is_open()) {
+        return false;
+    }
+    impl_->file.flush();
+    bool ok = impl_->file.good();
+    impl_->file.close();
+    return ok;
+}
+
+size_t PcmFileSink::GetNumSamples() const {
+    return impl_->num_samples;
+}
+
+}  // namespace Evo
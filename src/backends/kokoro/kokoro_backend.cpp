@@ -1,8 +1,6 @@
 #include "internal/backends/kokoro/kokoro_backend.hpp"
 
-#include <fcntl.h>
-#include <unistd.h>
-
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
@@ -16,7 +14,9 @@
 
 #include "internal/audio/audio_processor.hpp"
 #include "internal/backends/kokoro/kokoro_model_downloader.hpp"
+#include "internal/text/frontend_pipeline.hpp"
 #include "internal/text/text_normalizer.hpp"
+#include "internal/text/text_utils.hpp"
 
 namespace fs = std::filesystem;
 
@@ -80,18 +80,17 @@ ErrorInfo KokoroBackend::initialize(const TtsConfig& config) {
     }
 
     try {
-        // Initialize ONNX Runtime (suppress stderr warnings)
-        std::string model_path = model_dir + "/" + KokoroModelDownloader::MODEL_FILE;
-        int stderr_fd = dup(STDERR_FILENO);
-        int devnull_fd = open("/dev/null", O_WRONLY);
-        dup2(devnull_fd, STDERR_FILENO);
+        model_path_ = model_dir + "/" + KokoroModelDownloader::MODEL_FILE;
 
-        env_ = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "KokoroBackend");
+        // Read the model into the page cache in the background while ORT sets up
+        model_memory_.reset(config.memoryConfig());
+        model_memory_.prefetch({model_path_});
 
-        // Restore stderr
-        dup2(stderr_fd, STDERR_FILENO);
-        close(stderr_fd);
-        close(devnull_fd);
+        // Shared ONNX Runtime environment (one CPU allocator for all engines)
+        OrtEnvConfig env_config;
+        env_config.shared_allocator = config.shared_allocator;
+        env_config.arena_max_bytes = static_cast<size_t>(std::max(config.arena_max_mb, 0)) * 1024 * 1024;
+        env_ = OrtEnvironment::acquire(env_config);
 
         Ort::SessionOptions session_options;
         session_options.SetIntraOpNumThreads(config.num_threads > 0 ? config.num_threads : 2);
@@ -102,20 +101,28 @@ ErrorInfo KokoroBackend::initialize(const TtsConfig& config) {
         session_options.DisableCpuMemArena();
         #endif
 
-        session_ = std::make_unique<Ort::Session>(*env_, model_path.c_str(), session_options);
+        // Weights are tracked for residency control
+        model_memory_.track([&]() {
+            ExecutionProviderConfig providers;
+            providers.providers = config.execution_providers;
+            providers.options = config.provider_options;
+            session_ = env_->createSession(model_path_, session_options, providers, config.engine_tag + ":kokoro");
+        });
 
-        // Warm up with a small inference
+        // Warm up with a small inference; its arena is tracked too, unless it is the shared one
         if (config.enable_warmup) {
-            std::cout << "[Kokoro] Warming up model..." << std::endl;
-            auto start = std::chrono::high_resolution_clock::now();
-
-            std::vector<int64_t> small_tokens = {0, 43, 56, 0};  // pad, 'a', 'n', pad
-            auto style = voice_manager_.getStyleVector(static_cast<int>(small_tokens.size()));
-            runInference(small_tokens, style, 1.0f);
-
-            auto end = std::chrono::high_resolution_clock::now();
-            auto dur = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-            std::cout << "[Kokoro] Model warmed up in " << dur.count() << "ms" << std::endl;
+            model_memory_.trackInference(env_->sharedAllocator(), [&]() {
+                std::cout << "[Kokoro] Warming up model..." << std::endl;
+                auto start = std::chrono::high_resolution_clock::now();
+
+                std::vector<int64_t> small_tokens = {0, 43, 56, 0};  // pad, 'a', 'n', pad
+                auto style = voice_manager_.getStyleVector(static_cast<int>(small_tokens.size()));
+                runInference(small_tokens, style, 1.0f);
+
+                auto end = std::chrono::high_resolution_clock::now();
+                auto dur = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+                std::cout << "[Kokoro] Model warmed up in " << dur.count() << "ms" << std::endl;
+            });
         }
 
         initialized_ = true;
@@ -159,7 +166,7 @@ std::string KokoroBackend::getVersion() const {
 }
 
 bool KokoroBackend::supportsStreaming() const {
-    return false;
+    return true;
 }
 
 int KokoroBackend::getNumSpeakers() const {
@@ -210,13 +217,7 @@ ErrorInfo KokoroBackend::synthesize(const std::string& text, SynthesisResult& re
         }
 
         // Step 4: Audio post-processing
-        audio::AudioProcessConfig audio_config;
-        audio_config.target_rms = config_.target_rms;
-        audio_config.compression_ratio = config_.compression_ratio;
-        audio_config.use_rms_norm = config_.use_rms_norm;
-        audio_config.remove_clicks = config_.remove_clicks;
-
-        audio_samples = audio::processAudio(audio_samples, audio_config);
+        audio_samples = audio::processAudio(audio_samples, makeAudioProcessConfig());
 
         // Record timing
         auto end_time = std::chrono::high_resolution_clock::now();
@@ -249,6 +250,62 @@ ErrorInfo KokoroBackend::synthesize(const std::string& text, SynthesisResult& re
     }
 }
 
+ErrorInfo KokoroBackend::synthesizeStreaming(const std::string& text, ITtsCallback& callback) {
+    if (!initialized_) {
+        return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
+    }
+
+    if (text.empty()) {
+        return ErrorInfo::error(ErrorCode::INVALID_TEXT, "Empty text");
+    }
+
+    try {
+        std::vector<std::string> sentences = text::splitSentences(text);
+        if (sentences.empty()) {
+            sentences.push_back(text);
+        }
+
+        // Phonemize upcoming sentences on a separate thread so inference
+        // always finds its next input ready
+        text::FrontendPipeline<std::vector<int64_t>> frontend(
+            std::move(sentences),
+            [this](const std::string& sentence) { return phonemizer_.textToTokenIds(sentence); },
+            static_cast<size_t>(std::max(config_.frontend_lookahead, 0)));
+
+        audio::StreamingAudioProcessor processor(makeAudioProcessConfig());
+        const size_t num_sentences = frontend.size();
+        const float kokoro_speed = 1.0f / current_speed_;
+
+        std::vector<int64_t> token_ids;
+        for (size_t index = 0; frontend.next(token_ids); ++index) {
+            if (callback.isCancelled()) {
+                return ErrorInfo::error(ErrorCode::CANCELLED, "Cancelled");
+            }
+
+            std::vector<float> audio_samples;
+            if (!token_ids.empty()) {
+                auto style_vector = voice_manager_.getStyleVector(static_cast<int>(token_ids.size()));
+                audio_samples = runInference(token_ids, style_vector, kokoro_speed);
+            }
+
+            // Each sentence is one segment: trimmed, normalized, and followed
+            // by the sentence gap unless it is the last one
+            audio::ChunkPosition position;
+            position.last_segment = (index + 1 == num_sentences);
+            audio_samples = processor.process(audio_samples, position);
+
+            AudioChunk chunk = AudioChunk::fromFloat(audio_samples, SAMPLE_RATE, position.last_segment);
+            chunk.sentence_index = static_cast<int>(index);
+            callback.onAudioChunk(chunk);
+        }
+
+        return ErrorInfo::ok();
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::SYNTHESIS_FAILED,
+            std::string("Kokoro synthesis failed: ") + e.what());
+    }
+}
+
 ErrorInfo KokoroBackend::setSpeed(float speed) {
     if (speed <= 0.0f || speed > 10.0f) {
         return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Speed must be between 0.1 and 10.0");
@@ -257,10 +314,52 @@ ErrorInfo KokoroBackend::setSpeed(float speed) {
     return ErrorInfo::ok();
 }
 
+// =============================================================================
+// Memory Management
+// =============================================================================
+
+ErrorInfo KokoroBackend::trimMemory() {
+    if (!initialized_) {
+        return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
+    }
+
+    // ORT only shrinks the arena at the end of a Run, so do a minimal one
+    try {
+        std::vector<int64_t> small_tokens = {0, 43, 56, 0};
+        auto style = voice_manager_.getStyleVector(static_cast<int>(small_tokens.size()));
+        runInference(small_tokens, style, 1.0f, true);
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::INTERNAL_ERROR,
+            std::string("Failed to trim inference memory: ") + e.what());
+    }
+    return ErrorInfo::ok();
+}
+
+std::vector<std::string> KokoroBackend::getModelFiles() const {
+    return {model_path_};
+}
+
+ModelMemoryStats KokoroBackend::getMemoryStats() const {
+    return model_memory_.stats();
+}
+
 // =============================================================================
 // Private Methods
 // =============================================================================
 
+audio::AudioProcessConfig KokoroBackend::makeAudioProcessConfig() const {
+    audio::AudioProcessConfig audio_config;
+    audio_config.target_rms = config_.target_rms;
+    audio_config.compression_ratio = config_.compression_ratio;
+    audio_config.use_rms_norm = config_.use_rms_norm;
+    audio_config.remove_clicks = config_.remove_clicks;
+    audio_config.trim_silence = config_.trim_silence;
+    audio_config.silence_threshold_db = config_.silence_threshold_db;
+    audio_config.sentence_gap_ms = config_.sentence_gap_ms;
+    audio_config.sample_rate = SAMPLE_RATE;
+    return audio_config;
+}
+
 std::string KokoroBackend::getModelDir() const {
     std::string model_dir = config_.model_dir;
     if (model_dir.empty()) {
@@ -279,7 +378,8 @@ std::string KokoroBackend::getModelDir() const {
 std::vector<float> KokoroBackend::runInference(
     const std::vector<int64_t>& token_ids,
     const std::vector<float>& style_vector,
-    float speed) {
+    float speed,
+    bool shrink_arena) {
     auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
 
     // Input 1: input_ids [1, seq_len]
@@ -319,9 +419,14 @@ std::vector<float> KokoroBackend::runInference(
     input_tensors.push_back(std::move(style_tensor));
     input_tensors.push_back(std::move(speed_tensor));
 
+    Ort::RunOptions run_options;
+    if (shrink_arena) {
+        run_options.AddConfigEntry("memory.enable_memory_arena_shrinkage", "cpu:0");
+    }
+
     std::lock_guard<std::mutex> lock(inference_mutex_);
     auto output_tensors = session_->Run(
-        Ort::RunOptions{nullptr},
+        run_options,
         input_names, input_tensors.data(), 3,
         output_names, 1);
 
@@ -6,7 +6,6 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdio>
-#include <filesystem>  // NOLINT(build/c++17)
 #include <iostream>
 #include <memory>
 #include <regex>
@@ -19,11 +18,10 @@
 
 #include "internal/backends/matcha/tts_model_downloader.hpp"
 #include "internal/text/phoneme_utils.hpp"
+#include "internal/text/pinyin_service.hpp"
 #include "internal/text/text_normalizer.hpp"
 #include "internal/text/text_utils.hpp"
 
-namespace fs = std::filesystem;
-
 namespace tts {
 
 // =============================================================================
@@ -237,8 +235,8 @@ void KokoroPhonemizer::initPinyin() {
     std::string pinyin_dict_dir = downloader.getCppPinyinPath();
     std::cout << "[KokoroPhonemizer] Using cpp-pinyin dictionary at: " << pinyin_dict_dir << std::endl;
 
-    Pinyin::setDictionaryPath(fs::path(pinyin_dict_dir));
-    pinyin_converter_ = std::make_unique<Pinyin::Pinyin>();
+    // Shared with other backends/engines using the same dictionary directory
+    pinyin_converter_ = text::acquirePinyinConverter(pinyin_dict_dir);
 
     std::cout << "[KokoroPhonemizer] cpp-pinyin initialized successfully." << std::endl;
 
@@ -1,12 +1,9 @@
 #include "internal/backends/matcha/matcha_backend.hpp"
 
-#include <fcntl.h>
-#include <unistd.h>
-
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
-#include <cstdio>
 #include <cstdlib>
 #include <filesystem>  // NOLINT(build/c++17)
 #include <functional>
@@ -14,13 +11,16 @@
 #include <memory>
 #include <mutex>
 #include <numeric>
-#include <regex>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "internal/audio/audio_processor.hpp"
 #include "internal/backends/matcha/tts_model_downloader.hpp"
+#include "internal/text/frontend_pipeline.hpp"
+#include "internal/text/phoneme_utils.hpp"
 #include "internal/text/text_normalizer.hpp"
+#include "internal/text/text_utils.hpp"
 #include "internal/text/token_utils.hpp"
 #include "internal/vocoder/vocoder.hpp"
 
@@ -52,6 +52,11 @@ ErrorInfo MatchaBackend::initialize(const TtsConfig& config) {
         return ErrorInfo::error(ErrorCode::ALREADY_STARTED, "Backend already initialized");
     }
 
+    if (config.vocoder_istft != "auto" && config.vocoder_istft != "graph" && config.vocoder_istft != "cpp") {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG,
+            "Invalid vocoder_istft: " + config.vocoder_istft + " (expected auto, graph or cpp)");
+    }
+
     config_ = config;
     createInternalConfig();
 
@@ -64,22 +69,22 @@ ErrorInfo MatchaBackend::initialize(const TtsConfig& config) {
             "Failed to download TTS models for language: " + language);
     }
 
-    try {
-        // 初始化 ONNX Runtime
-        // 暂时抑制 stderr 避免 ONNX schema 警告
-        int stderr_fd = dup(STDERR_FILENO);
-        int devnull_fd = open("/dev/null", O_WRONLY);
-        dup2(devnull_fd, STDERR_FILENO);
-
-        env_ = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "MatchaBackend");
+    // 模型文件在后台读入页缓存, 与 ORT 环境创建、词典加载并行
+    model_memory_.reset(config.memoryConfig());
+    const bool want_istft_graph = config.vocoder_istft != "cpp";
+    model_memory_.prefetch({internal_config_.acoustic_model_path, internal_config_.vocoder_path,
+                            want_istft_graph ? internal_config_.vocoder_istft_path : std::string(),
+                            internal_config_.encoder_model_path, internal_config_.decoder_model_path});
 
-        // 恢复 stderr
-        dup2(stderr_fd, STDERR_FILENO);
-        close(stderr_fd);
-        close(devnull_fd);
+    try {
+        // 获取进程级共享的 ONNX Runtime 环境 (含共享 CPU 分配器)
+        OrtEnvConfig env_config;
+        env_config.shared_allocator = config.shared_allocator;
+        env_config.arena_max_bytes = static_cast<size_t>(std::max(config.arena_max_mb, 0)) * 1024 * 1024;
+        env_ = OrtEnvironment::acquire(env_config);
 
         Ort::SessionOptions session_options;
-        session_options.SetIntraOpNumThreads(3);
+        session_options.SetIntraOpNumThreads(config.num_threads > 0 ? config.num_threads : 3);
         session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
 
         // RISC-V 特定: 禁用内存池以避免对齐问题
@@ -88,13 +93,33 @@ ErrorInfo MatchaBackend::initialize(const TtsConfig& config) {
         session_options.DisableCpuMemArena();
         #endif
 
-        // 加载声学模型
-        acoustic_model_ = std::make_unique<Ort::Session>(
-            *env_, internal_config_.acoustic_model_path.c_str(), session_options);
+        model_memory_.track([&]() {
+            // 每个会话单独按执行提供器优先级回退; 日志标识带上引擎标识
+            ExecutionProviderConfig providers;
+            providers.providers = config.execution_providers;
+            providers.options = config.provider_options;
+            auto create_session = [&](const std::string& path, const char* name) {
+                return env_->createSession(path, session_options, providers, config.engine_tag + ":" + name);
+            };
 
-        // 加载声码器模型
-        vocoder_model_ = std::make_unique<Ort::Session>(
-            *env_, internal_config_.vocoder_path.c_str(), session_options);
+            // 加载声学模型
+            acoustic_model_ = create_session(internal_config_.acoustic_model_path, "acoustic");
+
+            // 加载声码器模型
+            vocoder_model_ = create_session(internal_config_.vocoder_path, "vocoder");
+
+            // 可选: 追加了 ISTFT 的声码器, 元数据读取后再决定是否使用
+            if (want_istft_graph && fs::exists(internal_config_.vocoder_istft_path)) {
+                vocoder_istft_model_ = create_session(internal_config_.vocoder_istft_path, "vocoder-istft");
+            }
+
+            // 可选: 拆分导出的编码器/解码器 (用于分块解码的流式合成)
+            if (fs::exists(internal_config_.encoder_model_path) &&
+                fs::exists(internal_config_.decoder_model_path)) {
+                encoder_model_ = create_session(internal_config_.encoder_model_path, "encoder");
+                decoder_model_ = create_session(internal_config_.decoder_model_path, "decoder");
+            }
+        });
 
         // 加载 token 映射
         if (type_ == BackendType::MATCHA_ZH_EN) {
@@ -106,20 +131,30 @@ ErrorInfo MatchaBackend::initialize(const TtsConfig& config) {
         // 提取模型元数据
         extractModelMetadata();
 
+        // 选择 ISTFT 位置 (会话独占 arena 时, 计时推理分配的 arena 同样纳入驻留控制)
+        if (vocoder_istft_model_) {
+            model_memory_.trackInference(env_->sharedAllocator(), [this]() { selectVocoderIstft(); });
+        }
+
         // 派生类特有的初始化
         auto err = initializeLanguageSpecific(config);
         if (!err.isOk()) {
             return err;
         }
 
-        // 预热模型
+        // 预热模型 (会话独占 arena 时, 首次推理分配的 arena 同样纳入驻留控制)
         if (config.enable_warmup) {
-            warmUpModels();
+            model_memory_.trackInference(env_->sharedAllocator(), [this]() { warmUpModels(); });
         }
 
         initialized_ = true;
         current_speed_ = config.speech_rate;
         current_speaker_ = config.speaker_id;
+        if (!validateSpeaker(current_speaker_).isOk()) {
+            std::cerr << "[MatchaBackend] speaker_id " << current_speaker_ << " out of range (model has "
+                      << num_speakers_ << " speakers), using 0" << std::endl;
+            current_speaker_ = 0;
+        }
 
         return ErrorInfo::ok();
     } catch (const std::exception& e) {
@@ -133,6 +168,15 @@ void MatchaBackend::shutdown() {
         shutdownLanguageSpecific();
         acoustic_model_.reset();
         vocoder_model_.reset();
+        vocoder_istft_model_.reset();
+        vocoder_istft_in_graph_ = false;
+        encoder_model_.reset();
+        decoder_model_.reset();
+        acoustic_sid_input_.clear();
+        encoder_sid_input_.clear();
+        decoder_sid_input_.clear();
+        acoustic_length_output_.clear();
+        num_speakers_ = 1;
         env_.reset();
         token_to_id_.clear();
         initialized_ = false;
@@ -165,7 +209,7 @@ std::string MatchaBackend::getVersion() const {
 }
 
 bool MatchaBackend::supportsStreaming() const {
-    return false;  // 当前版本不支持流式
+    return true;
 }
 
 int MatchaBackend::getNumSpeakers() const {
@@ -185,6 +229,11 @@ int MatchaBackend::getSampleRate() const {
 // =============================================================================
 
 ErrorInfo MatchaBackend::synthesize(const std::string& text, SynthesisResult& result) {
+    return synthesizeWithSpeaker(text, current_speaker_, result);
+}
+
+ErrorInfo MatchaBackend::synthesizeWithSpeaker(const std::string& text, int speaker_id,
+                                               SynthesisResult& result) {
     if (!initialized_) {
         return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
     }
@@ -193,44 +242,25 @@ ErrorInfo MatchaBackend::synthesize(const std::string& text, SynthesisResult& re
         return ErrorInfo::error(ErrorCode::INVALID_TEXT, "Empty text");
     }
 
+    ErrorInfo speaker_err = validateSpeaker(speaker_id);
+    if (!speaker_err.isOk()) {
+        return speaker_err;
+    }
+
     auto start_time = std::chrono::high_resolution_clock::now();
 
     try {
-        // 0. 文本规范化 (处理数字、公式、货币、日期等)
-        text::Language norm_lang;
-        switch (type_) {
-            case BackendType::MATCHA_ZH:
-                norm_lang = text::Language::ZH;
-                break;
-            case BackendType::MATCHA_EN:
-                norm_lang = text::Language::EN;
-                break;
-            case BackendType::MATCHA_ZH_EN:
-            default:
-                norm_lang = text::Language::AUTO;
-                break;
-        }
-        std::string normalized_text = text::normalizeText(text, norm_lang);
+        // 0-2. 文本规范化、转 token IDs、添加 blank tokens
+        std::vector<int64_t> final_tokens = prepareTokens(text);
 
-        // 1. 文本转 token IDs (派生类实现)
-        std::vector<int64_t> token_ids = textToTokenIds(normalized_text);
-
-        if (token_ids.empty()) {
+        if (final_tokens.empty()) {
             result.audio = AudioChunk::fromFloat({}, sample_rate_, true);
             result.success = true;
             return ErrorInfo::ok();
         }
 
-        // 2. 添加 blank tokens (根据后端类型)
-        std::vector<int64_t> final_tokens;
-        if (usesBlankTokens()) {
-            final_tokens = addBlankTokens(token_ids);
-        } else {
-            final_tokens = token_ids;
-        }
-
         // 3. 运行声学模型
-        std::vector<float> mel = runAcousticModel(final_tokens, current_speaker_, current_speed_);
+        std::vector<float> mel = runAcousticModel(final_tokens, speaker_id, current_speed_);
 
         if (mel.empty()) {
             result.audio = AudioChunk::fromFloat({}, sample_rate_, true);
@@ -241,31 +271,12 @@ ErrorInfo MatchaBackend::synthesize(const std::string& text, SynthesisResult& re
         // 4. 运行声码器
         std::vector<float> audio_samples = runVocoder(mel, mel_dim_);
 
-        // 5. 重采样（如果需要）
-        int output_sample_rate = sample_rate_;
-        if (config_.output_sample_rate > 0 && config_.output_sample_rate != sample_rate_) {
-            audio_samples = audio::resampleAudio(audio_samples, sample_rate_, config_.output_sample_rate);
-            output_sample_rate = config_.output_sample_rate;
-        }
-
         // 记录结束时间
         auto end_time = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
 
-        // 填充结果
-        result.audio = AudioChunk::fromFloat(audio_samples, output_sample_rate, true);
-        result.audio_duration_ms = result.audio.getDurationMs();
-        result.processing_time_ms = duration.count();
-        result.calculateRTF();
-        result.success = true;
-
-        // 添加句子信息
-        SentenceInfo sentence;
-        sentence.text = text;
-        sentence.begin_time_ms = 0;
-        sentence.end_time_ms = result.audio_duration_ms;
-        sentence.is_final = true;
-        result.sentences.push_back(sentence);
+        // 5. 重采样 (如果需要) 并填充结果
+        fillResult(text, std::move(audio_samples), duration.count(), result);
 
         // 触发回调
         if (callback_) {
@@ -279,6 +290,235 @@ ErrorInfo MatchaBackend::synthesize(const std::string& text, SynthesisResult& re
     }
 }
 
+ErrorInfo MatchaBackend::synthesizeBatch(const std::vector<std::string>& texts,
+                                         std::vector<SynthesisResult>& results) {
+    return synthesizeBatch(texts, std::vector<int>(texts.size(), current_speaker_), results);
+}
+
+ErrorInfo MatchaBackend::synthesizeBatch(const std::vector<std::string>& texts,
+                                         const std::vector<int>& speaker_ids,
+                                         std::vector<SynthesisResult>& results) {
+    if (!initialized_) {
+        return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
+    }
+    if (speaker_ids.size() != texts.size()) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "speaker_ids size mismatch");
+    }
+
+    results.clear();
+    results.resize(texts.size());
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    // 前端逐条处理; 空文本或无 token 的条目不参与推理
+    std::vector<std::vector<int64_t>> batch_tokens;
+    std::vector<int64_t> batch_speakers;
+    std::vector<size_t> batch_index;
+    for (size_t i = 0; i < texts.size(); ++i) {
+        if (texts[i].empty()) {
+            results[i].success = false;
+            results[i].error = ErrorInfo::error(ErrorCode::INVALID_TEXT, "Empty text");
+            continue;
+        }
+        ErrorInfo speaker_err = validateSpeaker(speaker_ids[i]);
+        if (!speaker_err.isOk()) {
+            results[i].success = false;
+            results[i].error = speaker_err;
+            continue;
+        }
+        try {
+            std::vector<int64_t> tokens = prepareTokens(texts[i]);
+            if (tokens.empty()) {
+                results[i].audio = AudioChunk::fromFloat({}, sample_rate_, true);
+                results[i].success = true;
+                continue;
+            }
+            batch_tokens.push_back(std::move(tokens));
+            batch_speakers.push_back(speaker_ids[i]);
+            batch_index.push_back(i);
+        } catch (const std::exception& e) {
+            results[i].success = false;
+            results[i].error = ErrorInfo::error(ErrorCode::SYNTHESIS_FAILED,
+                std::string("Synthesis failed: ") + e.what());
+        }
+    }
+
+    if (batch_tokens.empty()) {
+        return ErrorInfo::ok();
+    }
+
+    try {
+        std::vector<std::vector<float>> batch_audio = runBatch(batch_tokens, batch_speakers, current_speed_);
+
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+
+        for (size_t b = 0; b < batch_index.size(); ++b) {
+            size_t i = batch_index[b];
+            fillResult(texts[i], std::move(batch_audio[b]), duration.count(), results[i]);
+        }
+    } catch (const std::exception& e) {
+        ErrorInfo err = ErrorInfo::error(ErrorCode::SYNTHESIS_FAILED,
+            std::string("Batch synthesis failed: ") + e.what());
+        for (size_t i : batch_index) {
+            results[i].success = false;
+            results[i].error = err;
+        }
+    }
+
+    return ErrorInfo::ok();
+}
+
+bool MatchaBackend::supportsBatching() const {
+    return true;
+}
+
+bool MatchaBackend::supportsPerRequestSpeaker() const {
+    return !acoustic_sid_input_.empty();
+}
+
+// =============================================================================
+// 流式合成 (分块解码)
+// =============================================================================
+
+ErrorInfo MatchaBackend::synthesizeStreaming(const std::string& text, ITtsCallback& callback) {
+    if (!initialized_) {
+        return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
+    }
+
+    if (text.empty()) {
+        return ErrorInfo::error(ErrorCode::INVALID_TEXT, "Empty text");
+    }
+
+    try {
+        std::vector<std::string> sentences = text::splitSentences(text);
+        if (sentences.empty()) {
+            sentences.push_back(text);
+        }
+
+        // 前端在独立线程中提前把后续句子转换为 token, 推理取下一句时输入已就绪
+        text::FrontendPipeline<std::vector<int64_t>> frontend(
+            std::move(sentences),
+            [this](const std::string& sentence) { return prepareTokens(sentence); },
+            static_cast<size_t>(std::max(config_.frontend_lookahead, 0)));
+
+        // 整段共用一个后处理器, 块间增益与滤波器状态连续; 每句为一个 segment
+        audio::StreamingAudioProcessor processor(makeAudioProcessConfig());
+        const size_t num_sentences = frontend.size();
+        size_t sentence_index = 0;
+        bool sentence_started = false;
+        auto emit = [&](std::vector<float> samples, bool sentence_end) {
+            audio::ChunkPosition position;
+            position.segment_start = !sentence_started;
+            position.segment_end = sentence_end;
+            position.last_segment = (sentence_index + 1 == num_sentences);
+            sentence_started = !sentence_end;
+            samples = processor.process(samples, position);
+
+            int output_sample_rate = sample_rate_;
+            if (config_.output_sample_rate > 0 && config_.output_sample_rate != sample_rate_) {
+                samples = audio::resampleAudio(samples, sample_rate_, config_.output_sample_rate);
+                output_sample_rate = config_.output_sample_rate;
+            }
+
+            AudioChunk chunk = AudioChunk::fromFloat(samples, output_sample_rate,
+                                                     sentence_end && position.last_segment);
+            chunk.sentence_index = static_cast<int>(sentence_index);
+            callback.onAudioChunk(chunk);
+        };
+
+        std::vector<int64_t> tokens;
+        for (; frontend.next(tokens); ++sentence_index) {
+            if (callback.isCancelled()) {
+                return ErrorInfo::error(ErrorCode::CANCELLED, "Cancelled");
+            }
+            auto err = streamSentence(tokens, callback, emit);
+            if (!err.isOk()) {
+                return err;
+            }
+        }
+
+        return ErrorInfo::ok();
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::SYNTHESIS_FAILED,
+            std::string("Synthesis failed: ") + e.what());
+    }
+}
+
+ErrorInfo MatchaBackend::streamSentence(const std::vector<int64_t>& tokens, ITtsCallback& callback,
+                                        const ChunkEmitter& emit) {
+    const ErrorInfo cancelled = ErrorInfo::error(ErrorCode::CANCELLED, "Cancelled");
+    const int32_t chunk_frames = std::max(internal_config_.stream_chunk_frames, 8);
+    const float speed = current_speed_;
+    const int speaker_id = current_speaker_;
+
+    if (tokens.empty()) {
+        emit({}, true);
+        return ErrorInfo::ok();
+    }
+
+    if (encoder_model_ && decoder_model_) {
+        // 编码器与时长预测只运行一次, 解码器按带上下文的时间窗逐块解码
+        int32_t num_frames = 0;
+        std::vector<float> mu = runEncoder(tokens, speaker_id, speed, num_frames);
+        if (num_frames <= 0) {
+            emit({}, true);
+            return ErrorInfo::ok();
+        }
+
+        // 整句共用一份噪声, 重叠区域在相邻窗口中看到相同的输入
+        std::vector<float> noise(mu.size());
+        static thread_local std::mt19937 rng(std::random_device{}());
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        for (float& value : noise) {
+            value = normal(rng) * internal_config_.noise_scale;
+        }
+
+        // mel 缓冲: [0, end) 为已确定的帧, 之后是当前窗口的右侧上下文 (临时)
+        constexpr int32_t kDecoderContextFrames = 16;
+        std::vector<float> mel(static_cast<size_t>(mel_dim_) * num_frames, 0.0f);
+        for (int32_t begin = 0; begin < num_frames; begin += chunk_frames) {
+            if (callback.isCancelled()) {
+                return cancelled;
+            }
+            int32_t end = std::min(begin + chunk_frames, num_frames);
+            int32_t window_begin = std::max(0, begin - kDecoderContextFrames);
+            int32_t window_end = std::min(num_frames, end + kDecoderContextFrames);
+
+            std::vector<float> window = runDecoderWindow(mu, noise, num_frames, window_begin, window_end,
+                                                         speaker_id);
+            const int32_t window_frames = window_end - window_begin;
+            for (int32_t d = 0; d < mel_dim_; ++d) {
+                const float* src = window.data() + static_cast<size_t>(d) * window_frames;
+                float* dst = mel.data() + static_cast<size_t>(d) * num_frames;
+                // 左侧上下文帧已由上一块确定, 不覆盖
+                std::copy(src + (begin - window_begin), src + window_frames, dst + begin);
+            }
+
+            bool last = (end == num_frames);
+            emit(vocodeFrames(mel, num_frames, begin, end, last), last);
+        }
+    } else {
+        // 单一模型: 整句 mel 解码后分块声码
+        std::vector<float> mel = runAcousticModel(tokens, speaker_id, speed);
+        const int32_t num_frames = static_cast<int32_t>(mel.size() / mel_dim_);
+        if (num_frames <= 0) {
+            emit({}, true);
+            return ErrorInfo::ok();
+        }
+        for (int32_t begin = 0; begin < num_frames; begin += chunk_frames) {
+            if (callback.isCancelled()) {
+                return cancelled;
+            }
+            int32_t end = std::min(begin + chunk_frames, num_frames);
+            bool last = (end == num_frames);
+            emit(vocodeFrames(mel, num_frames, begin, end, last), last);
+        }
+    }
+
+    return ErrorInfo::ok();
+}
+
 ErrorInfo MatchaBackend::synthesizeToFile(const std::string& text, const std::string& file_path) {
     SynthesisResult result;
     auto err = synthesize(text, result);
@@ -301,16 +541,61 @@ ErrorInfo MatchaBackend::setSpeed(float speed) {
 }
 
 ErrorInfo MatchaBackend::setSpeaker(int speaker_id) {
+    ErrorInfo err = validateSpeaker(speaker_id);
+    if (!err.isOk()) {
+        return err;
+    }
+    current_speaker_ = speaker_id;
+    return ErrorInfo::ok();
+}
+
+ErrorInfo MatchaBackend::validateSpeaker(int speaker_id) const {
     if (speaker_id < 0) {
         return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Speaker ID must be non-negative");
     }
     if (speaker_id >= num_speakers_) {
         return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Speaker ID out of range");
     }
-    current_speaker_ = speaker_id;
     return ErrorInfo::ok();
 }
 
+// =============================================================================
+// 内存管理
+// =============================================================================
+
+ErrorInfo MatchaBackend::trimMemory() {
+    if (!initialized_) {
+        return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
+    }
+
+    // ORT 只在 Run 结束时收缩 arena, 因此用最小输入各跑一次两个模型
+    try {
+        std::vector<int64_t> small_tokens = {1, 2, 3};
+        std::vector<int64_t> tokens = usesBlankTokens() ? addBlankTokens(small_tokens) : small_tokens;
+        std::vector<float> mel = runAcousticModel(tokens, 0, 1.0f, true);
+        runVocoder(mel, mel_dim_, true);
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::INTERNAL_ERROR,
+            std::string("Failed to trim inference memory: ") + e.what());
+    }
+    return ErrorInfo::ok();
+}
+
+std::vector<std::string> MatchaBackend::getModelFiles() const {
+    std::vector<std::string> files = {
+        internal_config_.acoustic_model_path,
+        vocoder_istft_in_graph_ ? internal_config_.vocoder_istft_path : internal_config_.vocoder_path};
+    if (encoder_model_ && decoder_model_) {
+        files.push_back(internal_config_.encoder_model_path);
+        files.push_back(internal_config_.decoder_model_path);
+    }
+    return files;
+}
+
+ModelMemoryStats MatchaBackend::getMemoryStats() const {
+    return model_memory_.stats();
+}
+
 // =============================================================================
 // 受保护的辅助方法
 // =============================================================================
@@ -344,74 +629,64 @@ std::vector<int64_t> MatchaBackend::addBlankTokens(const std::vector<int64_t>& t
     return result;
 }
 
-bool MatchaBackend::checkEspeakNgAvailable() {
-    std::string command = "echo 'test' | espeak-ng -q --ipa=3 2>/dev/null";
-
-    std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(command.c_str(), "r"), pclose);
-    if (!pipe) {
-        return false;
+std::vector<int64_t> MatchaBackend::prepareTokens(const std::string& text) {
+    // 文本规范化 (处理数字、公式、货币、日期等)
+    text::Language norm_lang;
+    switch (type_) {
+        case BackendType::MATCHA_ZH:
+            norm_lang = text::Language::ZH;
+            break;
+        case BackendType::MATCHA_EN:
+            norm_lang = text::Language::EN;
+            break;
+        case BackendType::MATCHA_ZH_EN:
+        default:
+            norm_lang = text::Language::AUTO;
+            break;
     }
+    std::string normalized_text = text::normalizeText(text, norm_lang);
 
-    char buffer[128];
-    std::string result;
-    if (fgets(buffer, sizeof(buffer), pipe.get()) != nullptr) {
-        result += buffer;
+    // 文本转 token IDs (派生类实现)
+    std::vector<int64_t> token_ids = textToTokenIds(normalized_text);
+    if (token_ids.empty()) {
+        return token_ids;
     }
 
-    int exit_status = pclose(pipe.release());
-    return exit_status == 0 && !result.empty();
+    // 添加 blank tokens (根据后端类型)
+    return usesBlankTokens() ? addBlankTokens(token_ids) : token_ids;
 }
 
-std::string MatchaBackend::processEnglishTextToPhonemes(const std::string& text) {
-    if (text.empty()) {
-        return "";
-    }
-
-    // 转义单引号
-    std::string escaped_text = text;
-    std::string::size_type pos = 0;
-    while ((pos = escaped_text.find("'", pos)) != std::string::npos) {
-        escaped_text.replace(pos, 1, "'\"'\"'");
-        pos += 5;
-    }
-
-    // 使用 espeak-ng 转换为 IPA (使用 en-us 美式英语)
-    std::string command = "echo '" + escaped_text + "' | espeak-ng -q --ipa=3 -v en-us";
-
-    std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(command.c_str(), "r"), pclose);
-    if (!pipe) {
-        std::cerr << "Error: Failed to run espeak-ng command" << std::endl;
-        return "";
-    }
-
-    char buffer[4096];
-    std::string result;
-    while (fgets(buffer, sizeof(buffer), pipe.get()) != nullptr) {
-        result += buffer;
+void MatchaBackend::fillResult(const std::string& text, std::vector<float> audio_samples,
+                               int64_t processing_time_ms, SynthesisResult& result) {
+    // 重采样（如果需要）
+    int output_sample_rate = sample_rate_;
+    if (config_.output_sample_rate > 0 && config_.output_sample_rate != sample_rate_) {
+        audio_samples = audio::resampleAudio(audio_samples, sample_rate_, config_.output_sample_rate);
+        output_sample_rate = config_.output_sample_rate;
     }
 
-    int exit_status = pclose(pipe.release());
-    if (exit_status != 0) {
-        return "";
-    }
-
-    // 清理结果 - 移除换行符和多余空白
-    result.erase(std::remove_if(result.begin(), result.end(),
-        [](char c) { return c == '\n' || c == '\r'; }), result.end());
-
-    // 替换多个连续空格为单个空格
-    std::regex multi_space("\\s+");
-    result = std::regex_replace(result, multi_space, " ");
+    result.audio = AudioChunk::fromFloat(audio_samples, output_sample_rate, true);
+    result.audio_duration_ms = result.audio.getDurationMs();
+    result.processing_time_ms = processing_time_ms;
+    result.calculateRTF();
+    result.success = true;
+
+    // 添加句子信息
+    SentenceInfo sentence;
+    sentence.text = text;
+    sentence.begin_time_ms = 0;
+    sentence.end_time_ms = result.audio_duration_ms;
+    sentence.is_final = true;
+    result.sentences.push_back(sentence);
+}
 
-    // 去除首尾空白
-    size_t start = result.find_first_not_of(" \t");
-    if (start == std::string::npos) {
-        return "";
-    }
-    size_t end = result.find_last_not_of(" \t");
-    result = result.substr(start, end - start + 1);
+bool MatchaBackend::checkEspeakNgAvailable() {
+    return text::isEspeakNgAvailable();
+}
 
-    return result;
+std::string MatchaBackend::processEnglishTextToPhonemes(const std::string& text) {
+    // 使用 espeak-ng 转换为 IPA (使用 en-us 美式英语)
+    return text::espeakToIpa(text, "en-us", 3);
 }
 
 // =============================================================================
@@ -423,6 +698,8 @@ void MatchaBackend::createInternalConfig() {
     std::string subdir = getModelSubdir();
 
     internal_config_.acoustic_model_path = model_dir + "/" + subdir + "/model-steps-3.onnx";
+    internal_config_.encoder_model_path = model_dir + "/" + subdir + "/encoder.onnx";
+    internal_config_.decoder_model_path = model_dir + "/" + subdir + "/decoder.onnx";
     internal_config_.tokens_path = model_dir + "/" + subdir + "/tokens.txt";
 
     if (type_ == BackendType::MATCHA_ZH) {
@@ -444,6 +721,11 @@ void MatchaBackend::createInternalConfig() {
         sample_rate_ = 16000;
     }
 
+    // 图内 ISTFT 的声码器与原声码器同目录: vocos-22khz-univ.onnx -> vocos-22khz-univ-istft.onnx
+    fs::path vocoder_path(internal_config_.vocoder_path);
+    internal_config_.vocoder_istft_path =
+        (vocoder_path.parent_path() / (vocoder_path.stem().string() + "-istft.onnx")).string();
+
     internal_config_.sample_rate = sample_rate_;
     internal_config_.speaker_id = config_.speaker_id;
     internal_config_.length_scale = 1.0f / config_.speech_rate;
@@ -453,16 +735,59 @@ void MatchaBackend::createInternalConfig() {
     internal_config_.compression_ratio = config_.compression_ratio;
     internal_config_.use_rms_norm = config_.use_rms_norm;
     internal_config_.remove_clicks = config_.remove_clicks;
+    internal_config_.trim_silence = config_.trim_silence;
+    internal_config_.silence_threshold_db = config_.silence_threshold_db;
+    internal_config_.sentence_gap_ms = config_.sentence_gap_ms;
+    internal_config_.stream_chunk_frames = config_.stream_chunk_frames;
     internal_config_.enable_warmup = config_.enable_warmup;
 }
 
+namespace {
+
+// 说话人输入名: 通用导出为 "sid", Matcha 原版导出为 "spks"; 没有时返回空串
+std::string findSpeakerInput(Ort::Session& session) {
+    Ort::AllocatorWithDefaultOptions allocator;
+    for (size_t i = 0; i < session.GetInputCount(); ++i) {
+        std::string name = session.GetInputNameAllocated(i, allocator).get();
+        if (name == "sid" || name == "spks") {
+            return name;
+        }
+    }
+    return "";
+}
+
+// 声学模型的 mel 长度输出名 (批量推理时各条目的有效帧数); 没有时返回空串
+std::string findMelLengthOutput(Ort::Session& session) {
+    Ort::AllocatorWithDefaultOptions allocator;
+    for (size_t i = 0; i < session.GetOutputCount(); ++i) {
+        std::string name = session.GetOutputNameAllocated(i, allocator).get();
+        if (name == "mel_lengths" || name == "mel_length" || name == "y_lengths") {
+            return name;
+        }
+    }
+    return "";
+}
+
+}  // namespace
+
 void MatchaBackend::extractModelMetadata() {
     Ort::AllocatorWithDefaultOptions allocator;
 
     // 读取声学模型元数据
+    num_speakers_ = 1;
     try {
         Ort::ModelMetadata acoustic_meta = acoustic_model_->GetModelMetadata();
 
+        // 读取说话人数量 (多说话人导出写入 n_speakers)
+        try {
+            auto n_speakers_value = acoustic_meta.LookupCustomMetadataMapAllocated("n_speakers", allocator);
+            if (n_speakers_value) {
+                num_speakers_ = std::max(1, std::stoi(n_speakers_value.get()));
+            }
+        } catch (...) {
+            num_speakers_ = 1;
+        }
+
         // 读取 pad_id
         try {
             auto pad_id_value = acoustic_meta.LookupCustomMetadataMapAllocated("pad_id", allocator);
@@ -503,7 +828,26 @@ void MatchaBackend::extractModelMetadata() {
     }
 
     mel_dim_ = 80;
-    num_speakers_ = 1;
+    acoustic_length_output_ = findMelLengthOutput(*acoustic_model_);
+
+    // 说话人输入: 只在多说话人模型上绑定
+    acoustic_sid_input_.clear();
+    encoder_sid_input_.clear();
+    decoder_sid_input_.clear();
+    if (num_speakers_ > 1) {
+        acoustic_sid_input_ = findSpeakerInput(*acoustic_model_);
+        if (encoder_model_ && decoder_model_) {
+            encoder_sid_input_ = findSpeakerInput(*encoder_model_);
+            decoder_sid_input_ = findSpeakerInput(*decoder_model_);
+        }
+        if (acoustic_sid_input_.empty()) {
+            std::cerr << "[MatchaBackend] Model declares " << num_speakers_
+                      << " speakers but has no sid input, using a single speaker" << std::endl;
+            num_speakers_ = 1;
+        } else {
+            std::cout << "[MatchaBackend] Multi-speaker model: " << num_speakers_ << " speakers" << std::endl;
+        }
+    }
 }
 
 void MatchaBackend::warmUpModels() {
@@ -524,10 +868,93 @@ void MatchaBackend::warmUpModels() {
     }
 }
 
+void MatchaBackend::selectVocoderIstft() {
+    const std::string& mode = config_.vocoder_istft;
+    const auto use_graph = [this]() {
+        std::swap(vocoder_model_, vocoder_istft_model_);
+        vocoder_istft_in_graph_ = true;
+    };
+
+    if (mode == "graph") {
+        use_graph();
+        vocoder_istft_model_.reset();
+        std::cout << "Vocoder ISTFT: graph (" << internal_config_.vocoder_istft_path << ")" << std::endl;
+        return;
+    }
+
+    // auto: 同一段 mel 各跑一次预热 + 若干次计时, 取平均耗时较短的一种
+    constexpr int32_t kBenchmarkFrames = 200;
+    constexpr int kBenchmarkRuns = 3;
+    const std::vector<float> mel(static_cast<size_t>(mel_dim_) * kBenchmarkFrames, -5.0f);
+    const auto benchmark = [&]() {
+        runVocoderWaveform(mel, mel_dim_);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kBenchmarkRuns; ++i) {
+            runVocoderWaveform(mel, mel_dim_);
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / kBenchmarkRuns;
+    };
+
+    double cpp_ms = 0.0;
+    double graph_ms = 0.0;
+    try {
+        cpp_ms = benchmark();
+        use_graph();
+        graph_ms = benchmark();
+    } catch (const std::exception& e) {
+        std::cerr << "Warning: in-graph ISTFT vocoder failed, using C++ ISTFT: " << e.what() << std::endl;
+        graph_ms = -1.0;
+    }
+
+    if (graph_ms < 0.0 || graph_ms >= cpp_ms) {
+        if (vocoder_istft_in_graph_) {
+            std::swap(vocoder_model_, vocoder_istft_model_);
+            vocoder_istft_in_graph_ = false;
+        }
+    }
+    vocoder_istft_model_.reset();
+
+    if (graph_ms >= 0.0) {
+        std::cout << "Vocoder ISTFT: " << (vocoder_istft_in_graph_ ? "graph" : "cpp")
+                  << " (cpp " << cpp_ms << "ms, graph " << graph_ms << "ms per "
+                  << kBenchmarkFrames << " frames)" << std::endl;
+    }
+}
+
+// =============================================================================
+// 形状分桶
+// =============================================================================
+
+namespace {
+
+// 不小于 length 的最小分桶边界; 超过最大边界时保持原长度
+int64_t bucketLength(int64_t length, const std::vector<int>& buckets) {
+    int64_t bucket = 0;
+    for (int boundary : buckets) {
+        if (boundary >= length && (bucket == 0 || boundary < bucket)) {
+            bucket = boundary;
+        }
+    }
+    return bucket > 0 ? bucket : length;
+}
+
+}  // namespace
+
+std::vector<int64_t> MatchaBackend::padTokensToBucket(const std::vector<int64_t>& tokens) const {
+    // 填充部分由 x_length 屏蔽, 不影响时长预测与输出 mel 长度
+    std::vector<int64_t> padded = tokens;
+    padded.resize(static_cast<size_t>(bucketLength(static_cast<int64_t>(tokens.size()), config_.token_buckets)),
+                  pad_id_);
+    return padded;
+}
+
 std::vector<float> MatchaBackend::runAcousticModel(
-    const std::vector<int64_t>& tokens, int speaker_id, float speed) {
+    const std::vector<int64_t>& raw_tokens, int speaker_id, float speed, bool shrink_arena) {
+    // 按分桶填充输入, ORT 可复用同一形状的内存规划; x_length 仍为实际长度
+    const std::vector<int64_t> tokens = padTokensToBucket(raw_tokens);
     std::vector<int64_t> token_shape = {1, static_cast<int64_t>(tokens.size())};
-    std::vector<int64_t> length_data = {static_cast<int64_t>(tokens.size())};
+    std::vector<int64_t> length_data = {static_cast<int64_t>(raw_tokens.size())};
     std::vector<int64_t> length_shape = {1};
     std::vector<float> noise_scale_data = {internal_config_.noise_scale};
     std::vector<int64_t> noise_scale_shape = {1};
@@ -554,13 +981,28 @@ std::vector<float> MatchaBackend::runAcousticModel(
         memory_info, length_scale_data.data(), 1,
         length_scale_shape.data(), length_scale_shape.size()));
 
-    const char* input_names[] = {"x", "x_length", "noise_scale", "length_scale"};
+    std::vector<const char*> input_names = {"x", "x_length", "noise_scale", "length_scale"};
     const char* output_names[] = {"mel"};
 
+    // 多说话人模型: sid [1]
+    std::vector<int64_t> sid_data = {static_cast<int64_t>(speaker_id)};
+    std::vector<int64_t> sid_shape = {1};
+    if (!acoustic_sid_input_.empty()) {
+        input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+            memory_info, sid_data.data(), 1,
+            sid_shape.data(), sid_shape.size()));
+        input_names.push_back(acoustic_sid_input_.c_str());
+    }
+
+    Ort::RunOptions run_options;
+    if (shrink_arena) {
+        run_options.AddConfigEntry("memory.enable_memory_arena_shrinkage", "cpu:0");
+    }
+
     std::lock_guard<std::mutex> lock(inference_mutex_);
     auto output_tensors = acoustic_model_->Run(
-        Ort::RunOptions{nullptr},
-        input_names, input_tensors.data(), 4,
+        run_options,
+        input_names.data(), input_tensors.data(), input_tensors.size(),
         output_names, 1);
 
     float* mel_data = output_tensors[0].GetTensorMutableData<float>();
@@ -571,9 +1013,31 @@ std::vector<float> MatchaBackend::runAcousticModel(
     return std::vector<float>(mel_data, mel_data + mel_size);
 }
 
-std::vector<float> MatchaBackend::runVocoder(const std::vector<float>& mel, int mel_dim) {
-    int64_t num_frames = mel.size() / mel_dim;
-    std::vector<int64_t> input_shape = {1, mel_dim, num_frames};
+std::vector<float> MatchaBackend::runVocoder(const std::vector<float>& mel, int mel_dim, bool shrink_arena) {
+    std::vector<float> audio = runVocoderWaveform(mel, mel_dim, shrink_arena);
+
+    // 应用音频后处理
+    return audio::processAudio(audio, makeAudioProcessConfig());
+}
+
+std::vector<float> MatchaBackend::runVocoderWaveform(const std::vector<float>& raw_mel, int mel_dim,
+                                                     bool shrink_arena) {
+    const int64_t num_frames = raw_mel.size() / mel_dim;
+    const int64_t padded_frames = bucketLength(num_frames, config_.mel_frame_buckets);
+
+    // 按分桶在尾部重复最后一帧填充, 输出只取前 num_frames 帧
+    std::vector<float> padded_mel;
+    if (padded_frames > num_frames && num_frames > 0) {
+        padded_mel.resize(static_cast<size_t>(mel_dim) * padded_frames);
+        for (int d = 0; d < mel_dim; ++d) {
+            const float* src = raw_mel.data() + static_cast<size_t>(d) * num_frames;
+            float* dst = padded_mel.data() + static_cast<size_t>(d) * padded_frames;
+            std::copy(src, src + num_frames, dst);
+            std::fill(dst + num_frames, dst + padded_frames, src[num_frames - 1]);
+        }
+    }
+    const std::vector<float>& mel = padded_mel.empty() ? raw_mel : padded_mel;
+    std::vector<int64_t> input_shape = {1, mel_dim, static_cast<int64_t>(mel.size() / mel_dim)};
 
     auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
     Ort::Value input_tensor = Ort::Value::CreateTensor<float>(
@@ -582,32 +1046,61 @@ std::vector<float> MatchaBackend::runVocoder(const std::vector<float>& mel, int
 
     const char* input_names[] = {"mels"};
     const char* output_names[] = {"mag", "x", "y"};
+    const char* waveform_names[] = {"waveform"};
+
+    Ort::RunOptions run_options;
+    if (shrink_arena) {
+        run_options.AddConfigEntry("memory.enable_memory_arena_shrinkage", "cpu:0");
+    }
+
+    std::unique_lock<std::mutex> lock(inference_mutex_);
+    if (vocoder_istft_in_graph_) {
+        // 图内 ISTFT: 直接输出波形 [1, L], 只取前 num_frames 帧对应的样本
+        auto waveform_tensors = vocoder_model_->Run(
+            run_options,
+            input_names, &input_tensor, 1,
+            waveform_names, 1);
+        lock.unlock();
+
+        const float* waveform = waveform_tensors[0].GetTensorData<float>();
+        auto waveform_shape = waveform_tensors[0].GetTensorTypeAndShapeInfo().GetShape();
+        size_t length = std::min(static_cast<size_t>(waveform_shape[1]),
+                                 istftLength(static_cast<int32_t>(num_frames)));
+        return std::vector<float>(waveform, waveform + length);
+    }
 
-    std::lock_guard<std::mutex> lock(inference_mutex_);
     auto output_tensors = vocoder_model_->Run(
-        Ort::RunOptions{nullptr},
+        run_options,
         input_names, &input_tensor, 1,
         output_names, 3);
+    lock.unlock();
 
-    float* mag_data = output_tensors[0].GetTensorMutableData<float>();
-    float* x_data = output_tensors[1].GetTensorMutableData<float>();
-    float* y_data = output_tensors[2].GetTensorMutableData<float>();
+    const float* mag_data = output_tensors[0].GetTensorData<float>();
+    const float* x_data = output_tensors[1].GetTensorData<float>();
+    const float* y_data = output_tensors[2].GetTensorData<float>();
 
     auto vocoder_shape = output_tensors[0].GetTensorTypeAndShapeInfo().GetShape();
     int32_t n_fft_bins = vocoder_shape[1];
     int32_t vocoder_frames = vocoder_shape[2];
+    int32_t valid_frames = std::min(vocoder_frames, static_cast<int32_t>(num_frames));
+
+    return vocoderOutputToWaveform(mag_data, x_data, y_data, n_fft_bins, vocoder_frames, valid_frames);
+}
 
+std::vector<float> MatchaBackend::vocoderOutputToWaveform(const float* mag, const float* x, const float* y,
+                                                          int32_t n_fft_bins, int32_t frame_stride,
+                                                          int32_t num_frames) {
     // 重建复数 STFT
-    std::vector<float> stft_real(vocoder_frames * n_fft_bins);
-    std::vector<float> stft_imag(vocoder_frames * n_fft_bins);
+    std::vector<float> stft_real(num_frames * n_fft_bins);
+    std::vector<float> stft_imag(num_frames * n_fft_bins);
 
-    for (int32_t frame = 0; frame < vocoder_frames; ++frame) {
+    for (int32_t frame = 0; frame < num_frames; ++frame) {
         for (int32_t bin = 0; bin < n_fft_bins; ++bin) {
-            int32_t vocoder_idx = bin * vocoder_frames + frame;
+            int32_t vocoder_idx = bin * frame_stride + frame;
             int32_t stft_idx = frame * n_fft_bins + bin;
 
-            stft_real[stft_idx] = mag_data[vocoder_idx] * x_data[vocoder_idx];
-            stft_imag[stft_idx] = mag_data[vocoder_idx] * y_data[vocoder_idx];
+            stft_real[stft_idx] = mag[vocoder_idx] * x[vocoder_idx];
+            stft_imag[stft_idx] = mag[vocoder_idx] * y[vocoder_idx];
         }
     }
 
@@ -617,20 +1110,371 @@ std::vector<float> MatchaBackend::runVocoder(const std::vector<float>& mel, int
     istft_config.hop_length = istft_hop_length_;
     istft_config.win_length = istft_win_length_;
 
-    std::vector<float> audio = vocoder::istft(
-        stft_real, stft_imag, vocoder_frames, n_fft_bins, istft_config);
+    return vocoder::istft(stft_real, stft_imag, num_frames, n_fft_bins, istft_config);
+}
 
-    // 应用音频后处理
+size_t MatchaBackend::istftLength(int32_t num_frames) const {
+    // 与 vocoder::istft 一致: 不裁剪两端, 最后一帧的窗口完整保留
+    if (num_frames <= 0) {
+        return 0;
+    }
+    return static_cast<size_t>(istft_n_fft_) + static_cast<size_t>(num_frames - 1) * istft_hop_length_;
+}
+
+audio::AudioProcessConfig MatchaBackend::makeAudioProcessConfig() const {
     audio::AudioProcessConfig audio_config;
     audio_config.target_rms = internal_config_.target_rms;
     audio_config.compression_ratio = internal_config_.compression_ratio;
     audio_config.compression_threshold = internal_config_.compression_threshold;
     audio_config.use_rms_norm = internal_config_.use_rms_norm;
     audio_config.remove_clicks = internal_config_.remove_clicks;
+    audio_config.trim_silence = internal_config_.trim_silence;
+    audio_config.silence_threshold_db = internal_config_.silence_threshold_db;
+    audio_config.sentence_gap_ms = internal_config_.sentence_gap_ms;
+    audio_config.sample_rate = sample_rate_;
+    return audio_config;
+}
+
+// =============================================================================
+// 分块解码
+// =============================================================================
+
+namespace {
+
+// 从 [dim, total_frames] 布局中取出 [begin, end) 帧, 结果布局 [dim, end - begin]
+std::vector<float> sliceFrames(const std::vector<float>& data, int32_t dim, int32_t total_frames,
+                               int32_t begin, int32_t end) {
+    const int32_t frames = end - begin;
+    std::vector<float> slice(static_cast<size_t>(dim) * frames);
+    for (int32_t d = 0; d < dim; ++d) {
+        const float* src = data.data() + static_cast<size_t>(d) * total_frames + begin;
+        std::copy(src, src + frames, slice.data() + static_cast<size_t>(d) * frames);
+    }
+    return slice;
+}
+
+}  // namespace
+
+std::vector<float> MatchaBackend::runEncoder(const std::vector<int64_t>& raw_tokens, int speaker_id,
+                                             float speed, int32_t& num_frames) {
+    const std::vector<int64_t> tokens = padTokensToBucket(raw_tokens);
+    std::vector<int64_t> token_shape = {1, static_cast<int64_t>(tokens.size())};
+    std::vector<int64_t> length_data = {static_cast<int64_t>(raw_tokens.size())};
+    std::vector<int64_t> length_shape = {1};
+    std::vector<float> length_scale_data = {internal_config_.length_scale / speed};
+    std::vector<int64_t> length_scale_shape = {1};
 
-    audio = audio::processAudio(audio, audio_config);
+    auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+
+    std::vector<Ort::Value> input_tensors;
+    input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+        memory_info, const_cast<int64_t*>(tokens.data()), tokens.size(),
+        token_shape.data(), token_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+        memory_info, length_data.data(), 1,
+        length_shape.data(), length_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
+        memory_info, length_scale_data.data(), 1,
+        length_scale_shape.data(), length_scale_shape.size()));
+
+    std::vector<const char*> input_names = {"x", "x_length", "length_scale"};
+    const char* output_names[] = {"mu"};
+
+    std::vector<int64_t> sid_data = {static_cast<int64_t>(speaker_id)};
+    std::vector<int64_t> sid_shape = {1};
+    if (!encoder_sid_input_.empty()) {
+        input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+            memory_info, sid_data.data(), 1,
+            sid_shape.data(), sid_shape.size()));
+        input_names.push_back(encoder_sid_input_.c_str());
+    }
+
+    std::lock_guard<std::mutex> lock(inference_mutex_);
+    auto output_tensors = encoder_model_->Run(
+        Ort::RunOptions{nullptr},
+        input_names.data(), input_tensors.data(), input_tensors.size(),
+        output_names, 1);
+
+    const float* mu_data = output_tensors[0].GetTensorData<float>();
+    auto mu_shape = output_tensors[0].GetTensorTypeAndShapeInfo().GetShape();
+    num_frames = static_cast<int32_t>(mu_shape[2]);
+
+    return std::vector<float>(mu_data, mu_data + static_cast<size_t>(mu_shape[1]) * num_frames);
+}
+
+std::vector<float> MatchaBackend::runDecoderWindow(const std::vector<float>& mu, const std::vector<float>& noise,
+                                                   int32_t total_frames, int32_t begin, int32_t end,
+                                                   int speaker_id) {
+    const int64_t frames = end - begin;
+    std::vector<float> mu_window = sliceFrames(mu, mel_dim_, total_frames, begin, end);
+    std::vector<float> noise_window = sliceFrames(noise, mel_dim_, total_frames, begin, end);
+    std::vector<float> mask(frames, 1.0f);
+
+    std::vector<int64_t> mel_shape = {1, mel_dim_, frames};
+    std::vector<int64_t> mask_shape = {1, 1, frames};
+
+    auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+
+    std::vector<Ort::Value> input_tensors;
+    input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
+        memory_info, mu_window.data(), mu_window.size(),
+        mel_shape.data(), mel_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
+        memory_info, mask.data(), mask.size(),
+        mask_shape.data(), mask_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
+        memory_info, noise_window.data(), noise_window.size(),
+        mel_shape.data(), mel_shape.size()));
+
+    std::vector<const char*> input_names = {"mu", "mask", "z"};
+    const char* output_names[] = {"mel"};
+
+    std::vector<int64_t> sid_data = {static_cast<int64_t>(speaker_id)};
+    std::vector<int64_t> sid_shape = {1};
+    if (!decoder_sid_input_.empty()) {
+        input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+            memory_info, sid_data.data(), 1,
+            sid_shape.data(), sid_shape.size()));
+        input_names.push_back(decoder_sid_input_.c_str());
+    }
+
+    std::lock_guard<std::mutex> lock(inference_mutex_);
+    auto output_tensors = decoder_model_->Run(
+        Ort::RunOptions{nullptr},
+        input_names.data(), input_tensors.data(), input_tensors.size(),
+        output_names, 1);
+
+    const float* mel_data = output_tensors[0].GetTensorData<float>();
+    return std::vector<float>(mel_data, mel_data + mu_window.size());
+}
+
+std::vector<float> MatchaBackend::vocodeFrames(const std::vector<float>& mel, int32_t total_frames,
+                                               int32_t begin, int32_t end, bool last) {
+    // 左侧至少覆盖一个 ISTFT 窗口 (n_fft / hop 帧) 使重叠相加结果与整句一致,
+    // 右侧上下文减小声码器卷积在块边界处的差异
+    const int32_t hop = istft_hop_length_;
+    const int32_t context = std::max(8, istft_n_fft_ / hop);
+    const int32_t window_begin = std::max(0, begin - context);
+    const int32_t window_end = last ? total_frames : std::min(total_frames, end + context);
+
+    std::vector<float> waveform = runVocoderWaveform(
+        sliceFrames(mel, mel_dim_, total_frames, window_begin, window_end), mel_dim_);
+
+    // 第 f 帧覆盖波形 [f * hop, f * hop + n_fft); 本块输出 [begin * hop, end * hop)
+    size_t from = std::min(waveform.size(), static_cast<size_t>(begin - window_begin) * hop);
+    size_t to = last ? waveform.size()
+                     : std::min(waveform.size(), static_cast<size_t>(end - window_begin) * hop);
+    return std::vector<float>(waveform.begin() + from, waveform.begin() + std::max(from, to));
+}
+
+// =============================================================================
+// 批量推理
+// =============================================================================
+
+Ort::Value MatchaBackend::runAcousticBatch(const std::vector<std::vector<int64_t>>& batch_tokens,
+                                          const std::vector<int64_t>& speaker_ids, float speed,
+                                          std::vector<int32_t>& valid_frames) {
+    const int64_t batch_size = static_cast<int64_t>(batch_tokens.size());
+    size_t max_len = 0;
+    for (const auto& tokens : batch_tokens) {
+        max_len = std::max(max_len, tokens.size());
+    }
+    max_len = static_cast<size_t>(bucketLength(static_cast<int64_t>(max_len), config_.token_buckets));
+
+    // 填充到相同长度, x_length 记录各条目的实际长度
+    std::vector<int64_t> token_data(batch_size * max_len, pad_id_);
+    std::vector<int64_t> length_data(batch_size);
+    for (int64_t b = 0; b < batch_size; ++b) {
+        const auto& tokens = batch_tokens[b];
+        std::copy(tokens.begin(), tokens.end(), token_data.begin() + b * max_len);
+        length_data[b] = static_cast<int64_t>(tokens.size());
+    }
+
+    std::vector<int64_t> token_shape = {batch_size, static_cast<int64_t>(max_len)};
+    std::vector<int64_t> length_shape = {batch_size};
+    std::vector<float> noise_scale_data = {internal_config_.noise_scale};
+    std::vector<int64_t> noise_scale_shape = {1};
+    std::vector<float> length_scale_data = {internal_config_.length_scale / speed};
+    std::vector<int64_t> length_scale_shape = {1};
+
+    auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+
+    std::vector<Ort::Value> input_tensors;
+    input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+        memory_info, token_data.data(), token_data.size(),
+        token_shape.data(), token_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+        memory_info, length_data.data(), length_data.size(),
+        length_shape.data(), length_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
+        memory_info, noise_scale_data.data(), 1,
+        noise_scale_shape.data(), noise_scale_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
+        memory_info, length_scale_data.data(), 1,
+        length_scale_shape.data(), length_scale_shape.size()));
+
+    std::vector<const char*> acoustic_input_names = {"x", "x_length", "noise_scale", "length_scale"};
+    const char* acoustic_output_names[] = {"mel", acoustic_length_output_.c_str()};
+
+    // 多说话人模型: sid [B], 同一批中的条目可以使用不同说话人
+    std::vector<int64_t> sid_shape = {batch_size};
+    if (!acoustic_sid_input_.empty()) {
+        input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+            memory_info, const_cast<int64_t*>(speaker_ids.data()), speaker_ids.size(),
+            sid_shape.data(), sid_shape.size()));
+        acoustic_input_names.push_back(acoustic_sid_input_.c_str());
+    }
+
+    // 声学模型: [B, T_tok] -> mel [B, mel_dim, T_mel] 与各条目的 mel 长度 [B]
+    std::lock_guard<std::mutex> lock(inference_mutex_);
+    auto mel_tensors = acoustic_model_->Run(
+        Ort::RunOptions{nullptr},
+        acoustic_input_names.data(), input_tensors.data(), input_tensors.size(),
+        acoustic_output_names, 2);
+
+    const int64_t mel_frames = mel_tensors[0].GetTensorTypeAndShapeInfo().GetShape()[2];
+    auto length_info = mel_tensors[1].GetTensorTypeAndShapeInfo();
+    for (int64_t b = 0; b < batch_size; ++b) {
+        int64_t frames = mel_frames;
+        switch (length_info.GetElementType()) {
+            case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+                frames = mel_tensors[1].GetTensorData<int64_t>()[b];
+                break;
+            case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+                frames = mel_tensors[1].GetTensorData<int32_t>()[b];
+                break;
+            case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+                frames = static_cast<int64_t>(mel_tensors[1].GetTensorData<float>()[b]);
+                break;
+            default:
+                break;
+        }
+        valid_frames[b] = static_cast<int32_t>(std::max<int64_t>(0, std::min(frames, mel_frames)));
+    }
+    return std::move(mel_tensors[0]);
+}
+
+std::vector<std::vector<float>> MatchaBackend::runBatch(
+    const std::vector<std::vector<int64_t>>& batch_tokens, const std::vector<int64_t>& speaker_ids,
+    float speed) {
+    const int64_t batch_size = static_cast<int64_t>(batch_tokens.size());
+    const char* vocoder_input_names[] = {"mels"};
+    const char* vocoder_output_names[] = {"mag", "x", "y"};
+
+    // 各条目的有效 mel 帧数必须来自模型: 批内较短条目的 mel 尾部是填充
+    std::vector<int32_t> valid_frames(batch_size);
+    std::vector<float> padded_mel;
+    Ort::Value mel_input{nullptr};
+
+    if (!acoustic_length_output_.empty()) {
+        // 声学模型输出各条目的 mel 长度: 整批一次推理
+        mel_input = runAcousticBatch(batch_tokens, speaker_ids, speed, valid_frames);
+
+        // 声码器输入按分桶补齐帧数 (尾部重复各条目的最后一帧)
+        auto mel_shape = mel_input.GetTensorTypeAndShapeInfo().GetShape();
+        const int64_t mel_frames = mel_shape[2];
+        const int64_t padded_frames = bucketLength(mel_frames, config_.mel_frame_buckets);
+        if (padded_frames > mel_frames && mel_frames > 0) {
+            const float* src_mel = mel_input.GetTensorData<float>();
+            padded_mel.resize(static_cast<size_t>(batch_size) * mel_dim_ * padded_frames);
+            for (int64_t row = 0; row < batch_size * mel_dim_; ++row) {
+                const float* src = src_mel + row * mel_frames;
+                float* dst = padded_mel.data() + row * padded_frames;
+                std::copy(src, src + mel_frames, dst);
+                std::fill(dst + mel_frames, dst + padded_frames, src[mel_frames - 1]);
+            }
+
+            auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+            mel_shape[2] = padded_frames;
+            mel_input = Ort::Value::CreateTensor<float>(
+                memory_info, padded_mel.data(), padded_mel.size(),
+                mel_shape.data(), mel_shape.size());
+        }
+    } else {
+        // 没有长度输出时, 条目的 mel 长度无法从填充后的批量输出中得到:
+        // 声学模型逐条运行, 再在尾部重复最后一帧拼成一批送入声码器
+        std::vector<std::vector<float>> mels(batch_size);
+        int32_t max_frames = 0;
+        for (int64_t b = 0; b < batch_size; ++b) {
+            mels[b] = runAcousticModel(batch_tokens[b], static_cast<int>(speaker_ids[b]), speed);
+            valid_frames[b] = static_cast<int32_t>(mels[b].size() / mel_dim_);
+            max_frames = std::max(max_frames, valid_frames[b]);
+        }
+
+        // 与单条合成一样按分桶补齐帧数, 声码器输入形状保持在少数几种
+        const int64_t padded_frames = bucketLength(max_frames, config_.mel_frame_buckets);
+        padded_mel.assign(static_cast<size_t>(batch_size) * mel_dim_ * padded_frames, 0.0f);
+        for (int64_t b = 0; b < batch_size; ++b) {
+            const int32_t frames = valid_frames[b];
+            if (frames == 0) {
+                continue;
+            }
+            for (int32_t d = 0; d < mel_dim_; ++d) {
+                const float* src = mels[b].data() + static_cast<size_t>(d) * frames;
+                float* dst = padded_mel.data() + (static_cast<size_t>(b) * mel_dim_ + d) * padded_frames;
+                std::copy(src, src + frames, dst);
+                std::fill(dst + frames, dst + padded_frames, src[frames - 1]);
+            }
+        }
+
+        auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+        std::vector<int64_t> mel_shape = {batch_size, mel_dim_, padded_frames};
+        mel_input = Ort::Value::CreateTensor<float>(
+            memory_info, padded_mel.data(), padded_mel.size(),
+            mel_shape.data(), mel_shape.size());
+    }
+
+    std::unique_lock<std::mutex> lock(inference_mutex_);
+
+    const audio::AudioProcessConfig audio_config = makeAudioProcessConfig();
+    std::vector<std::vector<float>> batch_audio(batch_size);
+
+    if (vocoder_istft_in_graph_) {
+        // 图内 ISTFT: 波形 [B, L], 各条目取有效帧对应的样本
+        const char* waveform_names[] = {"waveform"};
+        auto waveform_tensors = vocoder_model_->Run(
+            Ort::RunOptions{nullptr},
+            vocoder_input_names, &mel_input, 1,
+            waveform_names, 1);
+        lock.unlock();
+
+        const float* waveform = waveform_tensors[0].GetTensorData<float>();
+        const size_t waveform_length =
+            static_cast<size_t>(waveform_tensors[0].GetTensorTypeAndShapeInfo().GetShape()[1]);
+        for (int64_t b = 0; b < batch_size; ++b) {
+            const float* item = waveform + b * waveform_length;
+            size_t length = std::min(waveform_length, istftLength(valid_frames[b]));
+            batch_audio[b] = audio::processAudio(std::vector<float>(item, item + length), audio_config);
+        }
+        return batch_audio;
+    }
+
+    // 声码器: 直接使用填充后的 mel 批量推理, ISTFT 时只取各条目的有效帧
+    auto vocoder_tensors = vocoder_model_->Run(
+        Ort::RunOptions{nullptr},
+        vocoder_input_names, &mel_input, 1,
+        vocoder_output_names, 3);
+    lock.unlock();
+
+    const float* mag_data = vocoder_tensors[0].GetTensorData<float>();
+    const float* x_data = vocoder_tensors[1].GetTensorData<float>();
+    const float* y_data = vocoder_tensors[2].GetTensorData<float>();
+
+    auto vocoder_shape = vocoder_tensors[0].GetTensorTypeAndShapeInfo().GetShape();
+    const int32_t n_fft_bins = static_cast<int32_t>(vocoder_shape[1]);
+    const int32_t vocoder_frames = static_cast<int32_t>(vocoder_shape[2]);
+    const size_t vocoder_item_size = static_cast<size_t>(n_fft_bins) * vocoder_frames;
+
+    for (int64_t b = 0; b < batch_size; ++b) {
+        int32_t frames = std::min(valid_frames[b], vocoder_frames);
+        size_t offset = b * vocoder_item_size;
+        batch_audio[b] = audio::processAudio(
+            vocoderOutputToWaveform(mag_data + offset, x_data + offset, y_data + offset,
+                                    n_fft_bins, vocoder_frames, frames),
+            audio_config);
+    }
 
-    return audio;
+    return batch_audio;
 }
 
 }  // namespace tts
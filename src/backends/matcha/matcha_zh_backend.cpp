@@ -23,6 +23,21 @@ namespace fs = std::filesystem;
 
 namespace tts {
 
+namespace {
+
+// 进程内共享的只读资源 (多个后端实例使用同一份分词器/词典)
+text::SharedResourceCache<cppjieba::Jieba>& jiebaCache() {
+    static text::SharedResourceCache<cppjieba::Jieba> cache;
+    return cache;
+}
+
+text::SharedResourceCache<MatchaZhBackend::Lexicon>& lexiconCache() {
+    static text::SharedResourceCache<MatchaZhBackend::Lexicon> cache;
+    return cache;
+}
+
+}  // namespace
+
 // =============================================================================
 // 构造与析构
 // =============================================================================
@@ -56,7 +71,8 @@ ErrorInfo MatchaZhBackend::initializeLanguageSpecific(const TtsConfig& config) {
         const auto& internal_config = getInternalConfig();
         if (!internal_config.lexicon_path.empty() &&
             fs::exists(internal_config.lexicon_path)) {
-            loadLexicon(internal_config.lexicon_path);
+            const std::string& path = internal_config.lexicon_path;
+            lexicon_ = lexiconCache().get(path, [&path]() { return loadLexicon(path); });
         } else {
             std::cout << "Warning: Lexicon file not found. Continuing without lexicon." << std::endl;
         }
@@ -70,7 +86,8 @@ ErrorInfo MatchaZhBackend::initializeLanguageSpecific(const TtsConfig& config) {
 
 void MatchaZhBackend::shutdownLanguageSpecific() {
     jieba_.reset();
-    lexicon_.clear();
+    lexicon_.reset();
+    context_pool_.clear();
 }
 
 // =============================================================================
@@ -85,23 +102,27 @@ std::vector<int64_t> MatchaZhBackend::textToTokenIds(const std::string& text) {
         return token_ids;
     }
 
+    auto context = context_pool_.acquire();
+    std::string& processed_text = context->processed_text;
+    std::vector<std::string>& words = context->words;
+    std::vector<std::string>& cleaned_words = context->cleaned_words;
+
     // Step 1: 替换标点符号 (遵循 sherpa-onnx 模式)
-    std::string processed_text = text;
-    std::regex punct_re1("：|、|；");
-    processed_text = std::regex_replace(processed_text, punct_re1, "，");
-    std::regex punct_re2("[.]");
+    static const std::regex punct_re1("：|、|；");
+    static const std::regex punct_re2("[.]");
+    static const std::regex punct_re3("[?]");
+    static const std::regex punct_re4("[!]");
+    processed_text = std::regex_replace(text, punct_re1, "，");
     processed_text = std::regex_replace(processed_text, punct_re2, "。");
-    std::regex punct_re3("[?]");
     processed_text = std::regex_replace(processed_text, punct_re3, "？");
-    std::regex punct_re4("[!]");
     processed_text = std::regex_replace(processed_text, punct_re4, "！");
 
     // Step 2: Jieba 分词
-    std::vector<std::string> words;
+    words.clear();
     jieba_->Cut(processed_text, words, true);
 
     // Step 3: 移除冗余空格和标点 (遵循 sherpa-onnx)
-    std::vector<std::string> cleaned_words;
+    cleaned_words.clear();
     for (size_t i = 0; i < words.size(); ++i) {
         if (i == 0) {
             cleaned_words.push_back(words[i]);
@@ -153,16 +174,20 @@ void MatchaZhBackend::initializeJieba() {
     std::string idf_path = jieba_dir + "/idf.utf8";
     std::string stop_words = jieba_dir + "/stop_words.utf8";
 
-    jieba_ = std::make_unique<cppjieba::Jieba>(
-        dict_path, hmm_path, user_dict, idf_path, stop_words);
+    jieba_ = jiebaCache().get(jieba_dir, [&]() {
+        return std::make_shared<const cppjieba::Jieba>(
+            dict_path, hmm_path, user_dict, idf_path, stop_words);
+    });
 }
 
-void MatchaZhBackend::loadLexicon(const std::string& path) {
+std::shared_ptr<const MatchaZhBackend::Lexicon> MatchaZhBackend::loadLexicon(
+    const std::string& path) {
     std::ifstream file(path);
     if (!file.is_open()) {
         throw std::runtime_error("Cannot open lexicon file: " + path);
     }
 
+    auto lexicon = std::make_shared<Lexicon>();
     std::string line;
     while (std::getline(file, line)) {
         if (line.empty()) continue;
@@ -182,11 +207,12 @@ void MatchaZhBackend::loadLexicon(const std::string& path) {
         }
 
         if (!word.empty() && !phonemes.empty()) {
-            lexicon_[word] = phonemes;
+            (*lexicon)[word] = phonemes;
         }
     }
 
-    std::cout << "Loaded " << lexicon_.size() << " entries from lexicon." << std::endl;
+    std::cout << "Loaded " << lexicon->size() << " entries from lexicon." << std::endl;
+    return lexicon;
 }
 
 std::vector<int64_t> MatchaZhBackend::convertWordToIds(const std::string& word) {
@@ -197,9 +223,9 @@ std::vector<int64_t> MatchaZhBackend::convertWordToIds(const std::string& word)
     std::transform(lower_word.begin(), lower_word.end(), lower_word.begin(), ::tolower);
 
     // 1. 尝试在词典中查找
-    if (!lexicon_.empty()) {
-        auto lex_it = lexicon_.find(lower_word);
-        if (lex_it != lexicon_.end()) {
+    if (lexicon_ && !lexicon_->empty()) {
+        auto lex_it = lexicon_->find(lower_word);
+        if (lex_it != lexicon_->end()) {
             return convertPhonemesToIds(lex_it->second);
         }
     }
@@ -226,9 +252,9 @@ std::vector<int64_t> MatchaZhBackend::convertWordToIds(const std::string& word)
     std::vector<std::string> chars = text::splitUtf8(word);
 
     for (const auto& char_str : chars) {
-        if (!lexicon_.empty()) {
-            auto char_lex_it = lexicon_.find(char_str);
-            if (char_lex_it != lexicon_.end()) {
+        if (lexicon_ && !lexicon_->empty()) {
+            auto char_lex_it = lexicon_->find(char_str);
+            if (char_lex_it != lexicon_->end()) {
                 auto char_ids = convertPhonemesToIds(char_lex_it->second);
                 result.insert(result.end(), char_ids.begin(), char_ids.end());
             } else {
@@ -279,7 +305,7 @@ std::string MatchaZhBackend::mapPunctuation(const std::string& punct) {
 
 std::string MatchaZhBackend::mapPhoneme(const std::string& phone) {
     // 处理常见的拼音不匹配
-    static std::unordered_map<std::string, std::string> phoneme_mapping = {
+    static const std::unordered_map<std::string, std::string> phoneme_mapping = {
         {"shei2", "she2"},
         {"cei2", "ce2"},
         {"den1", "de1"},
@@ -5,7 +5,6 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <filesystem>  // NOLINT(build/c++17)
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -16,10 +15,9 @@
 #include "internal/backends/matcha/tts_model_downloader.hpp"
 #include "internal/text/number_utils.hpp"
 #include "internal/text/phoneme_utils.hpp"
+#include "internal/text/pinyin_service.hpp"
 #include "internal/text/text_utils.hpp"
 
-namespace fs = std::filesystem;
-
 namespace tts {
 
 // =============================================================================
@@ -86,11 +84,8 @@ void MatchaZhEnBackend::initializePinyin() {
     std::string pinyin_dict_dir = downloader.getCppPinyinPath();
     std::cout << "Using cpp-pinyin dictionary at: " << pinyin_dict_dir << std::endl;
 
-    // 设置词典路径
-    Pinyin::setDictionaryPath(fs::path(pinyin_dict_dir));
-
-    // 创建 Pinyin 转换器
-    pinyin_converter_ = std::make_unique<Pinyin::Pinyin>();
+    // 获取进程级共享的转换器，同一词典目录只加载一次
+    pinyin_converter_ = text::acquirePinyinConverter(pinyin_dict_dir);
 
     std::cout << "cpp-pinyin initialized successfully." << std::endl;
 }
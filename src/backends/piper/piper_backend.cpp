@@ -0,0 +1,493 @@
+#include "internal/backends/piper/piper_backend.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>  // NOLINT(build/c++17)
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "internal/audio/audio_processor.hpp"
+#include "internal/text/frontend_pipeline.hpp"
+#include "internal/text/text_utils.hpp"
+
+namespace fs = std::filesystem;
+
+namespace tts {
+
+// =============================================================================
+// Construction / Destruction
+// =============================================================================
+
+PiperBackend::PiperBackend(BackendType type)
+    : type_(type)
+    , initialized_(false)
+    , current_speed_(1.0f)
+    , current_speaker_(0) {
+}
+
+PiperBackend::~PiperBackend() {
+    shutdown();
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+ErrorInfo PiperBackend::initialize(const TtsConfig& config) {
+    if (initialized_) {
+        return ErrorInfo::error(ErrorCode::ALREADY_STARTED, "Backend already initialized");
+    }
+
+    config_ = config;
+
+    // Resolve and load the voice (model + JSON config)
+    std::string model_dir = getModelDir();
+    auto err = resolveModelPath(model_dir, config.voice, model_path_);
+    if (!err.isOk()) {
+        return err;
+    }
+    err = loadPiperConfig(model_path_ + ".json", voice_config_);
+    if (!err.isOk()) {
+        return err;
+    }
+
+    if (config.speaker_id < 0 || config.speaker_id >= voice_config_.num_speakers) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG,
+            "Speaker ID " + std::to_string(config.speaker_id) + " out of range (voice has " +
+            std::to_string(voice_config_.num_speakers) + " speakers)");
+    }
+
+    try {
+        phonemizer_.init(voice_config_);
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::INTERNAL_ERROR,
+            std::string("Failed to initialize Piper front end: ") + e.what());
+    }
+
+    try {
+        // Read the model into the page cache in the background while ORT sets up
+        model_memory_.reset(config.memoryConfig());
+        model_memory_.prefetch({model_path_});
+
+        // Shared ONNX Runtime environment (one CPU allocator for all engines)
+        OrtEnvConfig env_config;
+        env_config.shared_allocator = config.shared_allocator;
+        env_config.arena_max_bytes = static_cast<size_t>(std::max(config.arena_max_mb, 0)) * 1024 * 1024;
+        env_ = OrtEnvironment::acquire(env_config);
+
+        Ort::SessionOptions session_options;
+        session_options.SetIntraOpNumThreads(config.num_threads > 0 ? config.num_threads : 2);
+        session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+
+        #if defined(__riscv) || defined(__riscv__)
+        session_options.DisableMemPattern();
+        session_options.DisableCpuMemArena();
+        #endif
+
+        // Weights are tracked for residency control
+        model_memory_.track([&]() {
+            ExecutionProviderConfig providers;
+            providers.providers = config.execution_providers;
+            providers.options = config.provider_options;
+            session_ = env_->createSession(model_path_, session_options, providers, config.engine_tag + ":piper");
+
+            // Multi-speaker exports take an extra "sid" input
+            Ort::AllocatorWithDefaultOptions allocator;
+            has_sid_input_ = false;
+            for (size_t i = 0; i < session_->GetInputCount(); ++i) {
+                if (std::string(session_->GetInputNameAllocated(i, allocator).get()) == "sid") {
+                    has_sid_input_ = true;
+                }
+            }
+        });
+
+        // So is the arena allocated by warm-up, unless it is the shared one owned by all engines
+        if (config.enable_warmup) {
+            model_memory_.trackInference(env_->sharedAllocator(), [&]() {
+                std::cout << "[Piper] Warming up model..." << std::endl;
+                auto start = std::chrono::high_resolution_clock::now();
+
+                runInference(phonemizer_.phonemesToIds({" "}), config.speaker_id, 1.0f);
+
+                auto end = std::chrono::high_resolution_clock::now();
+                auto dur = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+                std::cout << "[Piper] Model warmed up in " << dur.count() << "ms" << std::endl;
+            });
+        }
+
+        initialized_ = true;
+        current_speed_ = config.speech_rate;
+        current_speaker_ = config.speaker_id;
+
+        std::cout << "[Piper] Using voice: " << model_path_ << " (" << voice_config_.phoneme_type
+                  << ", " << voice_config_.sample_rate << "Hz, " << voice_config_.num_speakers
+                  << " speakers)" << std::endl;
+        return ErrorInfo::ok();
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::MODEL_NOT_FOUND,
+            std::string("Failed to initialize Piper model: ") + e.what());
+    }
+}
+
+void PiperBackend::shutdown() {
+    if (initialized_) {
+        session_.reset();
+        env_.reset();
+        initialized_ = false;
+    }
+}
+
+bool PiperBackend::isInitialized() const {
+    return initialized_;
+}
+
+// =============================================================================
+// Backend Info
+// =============================================================================
+
+BackendType PiperBackend::getType() const {
+    return type_;
+}
+
+std::string PiperBackend::getName() const {
+    return type_ == BackendType::VITS ? "VITS (Piper format)" : "Piper TTS";
+}
+
+std::string PiperBackend::getVersion() const {
+    return "1.0.0";
+}
+
+bool PiperBackend::supportsStreaming() const {
+    return true;
+}
+
+int PiperBackend::getNumSpeakers() const {
+    return voice_config_.num_speakers;
+}
+
+bool PiperBackend::supportsPerRequestSpeaker() const {
+    return has_sid_input_;
+}
+
+int PiperBackend::getSampleRate() const {
+    if (config_.output_sample_rate > 0) {
+        return config_.output_sample_rate;
+    }
+    return voice_config_.sample_rate;
+}
+
+// =============================================================================
+// Synthesis
+// =============================================================================
+
+ErrorInfo PiperBackend::synthesize(const std::string& text, SynthesisResult& result) {
+    return synthesizeWithSpeaker(text, current_speaker_, result);
+}
+
+ErrorInfo PiperBackend::synthesizeWithSpeaker(const std::string& text, int speaker_id,
+                                              SynthesisResult& result) {
+    if (!initialized_) {
+        return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
+    }
+
+    if (text.empty()) {
+        return ErrorInfo::error(ErrorCode::INVALID_TEXT, "Empty text");
+    }
+
+    if (speaker_id < 0 || speaker_id >= voice_config_.num_speakers) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Speaker ID out of range");
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    try {
+        std::vector<int64_t> ids = phonemizer_.textToIds(text);
+        std::vector<float> audio_samples;
+        if (!ids.empty()) {
+            audio_samples = runInference(ids, speaker_id, current_speed_);
+        }
+
+        if (audio_samples.empty()) {
+            result.audio = AudioChunk::fromFloat({}, getSampleRate(), true);
+            result.success = true;
+            return ErrorInfo::ok();
+        }
+
+        audio_samples = resampleOutput(audio::processAudio(audio_samples, makeAudioProcessConfig()));
+
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+
+        result.audio = AudioChunk::fromFloat(audio_samples, getSampleRate(), true);
+        result.audio_duration_ms = result.audio.getDurationMs();
+        result.processing_time_ms = duration.count();
+        result.calculateRTF();
+        result.success = true;
+
+        SentenceInfo sentence;
+        sentence.text = text;
+        sentence.begin_time_ms = 0;
+        sentence.end_time_ms = result.audio_duration_ms;
+        sentence.is_final = true;
+        result.sentences.push_back(sentence);
+
+        if (callback_) {
+            notifyAudioChunk(result.audio);
+        }
+
+        return ErrorInfo::ok();
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::SYNTHESIS_FAILED,
+            std::string("Piper synthesis failed: ") + e.what());
+    }
+}
+
+ErrorInfo PiperBackend::synthesizeStreaming(const std::string& text, ITtsCallback& callback) {
+    if (!initialized_) {
+        return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
+    }
+
+    if (text.empty()) {
+        return ErrorInfo::error(ErrorCode::INVALID_TEXT, "Empty text");
+    }
+
+    try {
+        std::vector<std::string> sentences = text::splitSentences(text);
+        if (sentences.empty()) {
+            sentences.push_back(text);
+        }
+
+        // Phonemize upcoming sentences on a separate thread so inference
+        // always finds its next input ready
+        text::FrontendPipeline<std::vector<int64_t>> frontend(
+            std::move(sentences),
+            [this](const std::string& sentence) { return phonemizer_.textToIds(sentence); },
+            static_cast<size_t>(std::max(config_.frontend_lookahead, 0)));
+
+        audio::StreamingAudioProcessor processor(makeAudioProcessConfig());
+        const size_t num_sentences = frontend.size();
+        const float speed = current_speed_;
+        const int speaker = current_speaker_;
+
+        std::vector<int64_t> ids;
+        for (size_t index = 0; frontend.next(ids); ++index) {
+            if (callback.isCancelled()) {
+                return ErrorInfo::error(ErrorCode::CANCELLED, "Cancelled");
+            }
+
+            std::vector<float> audio_samples;
+            if (!ids.empty()) {
+                audio_samples = runInference(ids, speaker, speed);
+            }
+
+            // Each sentence is one segment: trimmed, normalized, and followed
+            // by the sentence gap unless it is the last one
+            audio::ChunkPosition position;
+            position.last_segment = (index + 1 == num_sentences);
+            audio_samples = resampleOutput(processor.process(audio_samples, position));
+
+            AudioChunk chunk = AudioChunk::fromFloat(audio_samples, getSampleRate(), position.last_segment);
+            chunk.sentence_index = static_cast<int>(index);
+            callback.onAudioChunk(chunk);
+        }
+
+        return ErrorInfo::ok();
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::SYNTHESIS_FAILED,
+            std::string("Piper synthesis failed: ") + e.what());
+    }
+}
+
+ErrorInfo PiperBackend::setSpeed(float speed) {
+    if (speed <= 0.0f || speed > 10.0f) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Speed must be between 0.1 and 10.0");
+    }
+    current_speed_ = speed;
+    return ErrorInfo::ok();
+}
+
+ErrorInfo PiperBackend::setSpeaker(int speaker_id) {
+    if (speaker_id < 0) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Speaker ID must be non-negative");
+    }
+    if (speaker_id >= voice_config_.num_speakers) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Speaker ID out of range");
+    }
+    current_speaker_ = speaker_id;
+    return ErrorInfo::ok();
+}
+
+// =============================================================================
+// Memory Management
+// =============================================================================
+
+ErrorInfo PiperBackend::trimMemory() {
+    if (!initialized_) {
+        return ErrorInfo::error(ErrorCode::NOT_INITIALIZED, "Backend not initialized");
+    }
+
+    // ORT only shrinks the arena at the end of a Run, so do a minimal one
+    try {
+        runInference(phonemizer_.phonemesToIds({" "}), 0, 1.0f, true);
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::INTERNAL_ERROR,
+            std::string("Failed to trim inference memory: ") + e.what());
+    }
+    return ErrorInfo::ok();
+}
+
+std::vector<std::string> PiperBackend::getModelFiles() const {
+    return {model_path_};
+}
+
+ModelMemoryStats PiperBackend::getMemoryStats() const {
+    return model_memory_.stats();
+}
+
+// =============================================================================
+// Private Methods
+// =============================================================================
+
+std::string PiperBackend::getModelDir() const {
+    std::string model_dir = config_.model_dir;
+    if (model_dir.empty()) {
+        model_dir = "~/.cache/piper-tts";
+    }
+    // Expand ~
+    if (!model_dir.empty() && model_dir[0] == '~') {
+        const char* home = getenv("HOME");
+        if (home) {
+            model_dir = std::string(home) + model_dir.substr(1);
+        }
+    }
+    return model_dir;
+}
+
+ErrorInfo PiperBackend::resolveModelPath(const std::string& model_dir, const std::string& voice,
+                                         std::string& model_path) const {
+    if (voice.empty() || voice == "default") {
+        // First voice (alphabetically) that has its JSON config next to it
+        std::vector<std::string> candidates;
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator(model_dir, ec)) {
+            const fs::path& path = entry.path();
+            if (path.extension() == ".onnx" && fs::exists(path.string() + ".json")) {
+                candidates.push_back(path.string());
+            }
+        }
+        if (candidates.empty()) {
+            return ErrorInfo::error(ErrorCode::MODEL_NOT_FOUND,
+                "No Piper voice found in: " + model_dir + "\n"
+                "Please download a voice (<voice>.onnx and <voice>.onnx.json) into that directory");
+        }
+        std::sort(candidates.begin(), candidates.end());
+        model_path = candidates.front();
+        return ErrorInfo::ok();
+    }
+
+    // Voice name, file name, or path to the .onnx file
+    fs::path path(voice);
+    if (path.extension() != ".onnx") {
+        path += ".onnx";
+    }
+    if (path.is_relative()) {
+        path = fs::path(model_dir) / path;
+    }
+    if (!fs::exists(path)) {
+        return ErrorInfo::error(ErrorCode::MODEL_NOT_FOUND,
+            "Piper voice not found at: " + path.string() + "\n"
+            "Please download " + path.filename().string() + " and " +
+            path.filename().string() + ".json into " + path.parent_path().string());
+    }
+    model_path = path.string();
+    return ErrorInfo::ok();
+}
+
+audio::AudioProcessConfig PiperBackend::makeAudioProcessConfig() const {
+    audio::AudioProcessConfig audio_config;
+    audio_config.target_rms = config_.target_rms;
+    audio_config.compression_ratio = config_.compression_ratio;
+    audio_config.use_rms_norm = config_.use_rms_norm;
+    audio_config.remove_clicks = config_.remove_clicks;
+    audio_config.trim_silence = config_.trim_silence;
+    audio_config.silence_threshold_db = config_.silence_threshold_db;
+    audio_config.sentence_gap_ms = config_.sentence_gap_ms;
+    audio_config.sample_rate = voice_config_.sample_rate;
+    return audio_config;
+}
+
+std::vector<float> PiperBackend::resampleOutput(std::vector<float> samples) const {
+    if (config_.output_sample_rate > 0 && config_.output_sample_rate != voice_config_.sample_rate) {
+        return audio::resampleAudio(samples, voice_config_.sample_rate, config_.output_sample_rate);
+    }
+    return samples;
+}
+
+std::vector<float> PiperBackend::runInference(const std::vector<int64_t>& ids, int speaker_id, float speed,
+                                              bool shrink_arena) {
+    auto memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+
+    // input [1, N], input_lengths [1]
+    std::vector<int64_t> ids_shape = {1, static_cast<int64_t>(ids.size())};
+    std::vector<int64_t> length_data = {static_cast<int64_t>(ids.size())};
+    std::vector<int64_t> length_shape = {1};
+
+    // scales [3]: noise_scale, length_scale (divided by speed), noise_w
+    std::vector<float> scales = {voice_config_.noise_scale, voice_config_.length_scale / speed,
+                                 voice_config_.noise_w};
+    std::vector<int64_t> scales_shape = {3};
+
+    // sid [1] (multi-speaker models only)
+    std::vector<int64_t> sid_data = {static_cast<int64_t>(speaker_id)};
+    std::vector<int64_t> sid_shape = {1};
+
+    std::vector<Ort::Value> input_tensors;
+    input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+        memory_info, const_cast<int64_t*>(ids.data()), ids.size(),
+        ids_shape.data(), ids_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+        memory_info, length_data.data(), length_data.size(),
+        length_shape.data(), length_shape.size()));
+    input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
+        memory_info, scales.data(), scales.size(),
+        scales_shape.data(), scales_shape.size()));
+    if (has_sid_input_) {
+        input_tensors.emplace_back(Ort::Value::CreateTensor<int64_t>(
+            memory_info, sid_data.data(), sid_data.size(),
+            sid_shape.data(), sid_shape.size()));
+    }
+
+    const char* input_names[] = {"input", "input_lengths", "scales", "sid"};
+    const char* output_names[] = {"output"};
+
+    Ort::RunOptions run_options;
+    if (shrink_arena) {
+        run_options.AddConfigEntry("memory.enable_memory_arena_shrinkage", "cpu:0");
+    }
+
+    std::lock_guard<std::mutex> lock(inference_mutex_);
+    auto output_tensors = session_->Run(
+        run_options,
+        input_names, input_tensors.data(), input_tensors.size(),
+        output_names, 1);
+
+    // Output [1, 1, T] (some exports add another unit axis)
+    const float* audio_data = output_tensors[0].GetTensorData<float>();
+    auto audio_shape = output_tensors[0].GetTensorTypeAndShapeInfo().GetShape();
+
+    size_t num_samples = 1;
+    for (auto dim : audio_shape) {
+        num_samples *= static_cast<size_t>(dim);
+    }
+
+    return std::vector<float>(audio_data, audio_data + num_samples);
+}
+
+}  // namespace tts
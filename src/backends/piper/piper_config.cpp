@@ -0,0 +1,349 @@
+#include "internal/backends/piper/piper_config.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tts {
+
+namespace {
+
+// =============================================================================
+// Minimal JSON reader (only what voice configs use)
+// =============================================================================
+
+struct JsonValue {
+    enum class Type { NUL, BOOL, NUMBER, STRING, ARRAY, OBJECT };
+
+    Type type = Type::NUL;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::map<std::string, JsonValue> object;
+
+    const JsonValue* find(const std::string& key) const {
+        if (type != Type::OBJECT) {
+            return nullptr;
+        }
+        auto it = object.find(key);
+        return it == object.end() ? nullptr : &it->second;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& text) : text_(text) {}
+
+    JsonValue parse() {
+        JsonValue value = parseValue();
+        skipWhitespace();
+        if (pos_ != text_.size()) {
+            fail("trailing characters");
+        }
+        return value;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::runtime_error(what + " at offset " + std::to_string(pos_));
+    }
+
+    void skipWhitespace() {
+        while (pos_ < text_.size() &&
+               (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    char peek() {
+        skipWhitespace();
+        if (pos_ >= text_.size()) {
+            fail("unexpected end of input");
+        }
+        return text_[pos_];
+    }
+
+    void expect(char c) {
+        if (peek() != c) {
+            fail(std::string("expected '") + c + "'");
+        }
+        ++pos_;
+    }
+
+    bool consumeLiteral(const char* literal) {
+        std::string word(literal);
+        if (text_.compare(pos_, word.size(), word) == 0) {
+            pos_ += word.size();
+            return true;
+        }
+        return false;
+    }
+
+    JsonValue parseValue() {
+        JsonValue value;
+        char c = peek();
+        if (c == '{') {
+            value.type = JsonValue::Type::OBJECT;
+            ++pos_;
+            if (peek() == '}') {
+                ++pos_;
+                return value;
+            }
+            while (true) {
+                if (peek() != '"') {
+                    fail("expected object key");
+                }
+                std::string key = parseString();
+                expect(':');
+                value.object[key] = parseValue();
+                if (peek() == ',') {
+                    ++pos_;
+                    continue;
+                }
+                expect('}');
+                return value;
+            }
+        }
+        if (c == '[') {
+            value.type = JsonValue::Type::ARRAY;
+            ++pos_;
+            if (peek() == ']') {
+                ++pos_;
+                return value;
+            }
+            while (true) {
+                value.array.push_back(parseValue());
+                if (peek() == ',') {
+                    ++pos_;
+                    continue;
+                }
+                expect(']');
+                return value;
+            }
+        }
+        if (c == '"') {
+            value.type = JsonValue::Type::STRING;
+            value.string = parseString();
+            return value;
+        }
+        if (consumeLiteral("true")) {
+            value.type = JsonValue::Type::BOOL;
+            value.boolean = true;
+            return value;
+        }
+        if (consumeLiteral("false")) {
+            value.type = JsonValue::Type::BOOL;
+            return value;
+        }
+        if (consumeLiteral("null")) {
+            return value;
+        }
+
+        const char* begin = text_.c_str() + pos_;
+        char* end = nullptr;
+        value.number = std::strtod(begin, &end);
+        if (end == begin) {
+            fail("invalid value");
+        }
+        value.type = JsonValue::Type::NUMBER;
+        pos_ += static_cast<size_t>(end - begin);
+        return value;
+    }
+
+    std::string parseString() {
+        expect('"');
+        std::string result;
+        while (true) {
+            if (pos_ >= text_.size()) {
+                fail("unterminated string");
+            }
+            char c = text_[pos_++];
+            if (c == '"') {
+                return result;
+            }
+            if (c != '\\') {
+                result += c;
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                fail("unterminated escape");
+            }
+            char escape = text_[pos_++];
+            switch (escape) {
+                case '"':  result += '"'; break;
+                case '\\': result += '\\'; break;
+                case '/':  result += '/'; break;
+                case 'b':  result += '\b'; break;
+                case 'f':  result += '\f'; break;
+                case 'n':  result += '\n'; break;
+                case 'r':  result += '\r'; break;
+                case 't':  result += '\t'; break;
+                case 'u':  appendUtf8(result, parseCodepoint()); break;
+                default:   fail("invalid escape");
+            }
+        }
+    }
+
+    uint32_t parseHex4() {
+        if (pos_ + 4 > text_.size()) {
+            fail("truncated \\u escape");
+        }
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = text_[pos_++];
+            value <<= 4;
+            if (c >= '0' && c <= '9') {
+                value |= static_cast<uint32_t>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                value |= static_cast<uint32_t>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                value |= static_cast<uint32_t>(c - 'A' + 10);
+            } else {
+                fail("invalid \\u escape");
+            }
+        }
+        return value;
+    }
+
+    uint32_t parseCodepoint() {
+        uint32_t codepoint = parseHex4();
+        // Surrogate pair (characters outside the BMP)
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF &&
+            text_.compare(pos_, 2, "\\u") == 0) {
+            pos_ += 2;
+            uint32_t low = parseHex4();
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        return codepoint;
+    }
+
+    static void appendUtf8(std::string& out, uint32_t codepoint) {
+        if (codepoint < 0x80) {
+            out += static_cast<char>(codepoint);
+        } else if (codepoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codepoint >> 6));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        } else if (codepoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codepoint >> 12));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (codepoint >> 18));
+            out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+    }
+
+    const std::string& text_;
+    size_t pos_ = 0;
+};
+
+// Typed lookups with defaults: a missing or mistyped field keeps the default
+void readNumber(const JsonValue& parent, const char* key, float& value) {
+    const JsonValue* field = parent.find(key);
+    if (field && field->type == JsonValue::Type::NUMBER) {
+        value = static_cast<float>(field->number);
+    }
+}
+
+void readInt(const JsonValue& parent, const char* key, int& value) {
+    const JsonValue* field = parent.find(key);
+    if (field && field->type == JsonValue::Type::NUMBER) {
+        value = static_cast<int>(field->number);
+    }
+}
+
+void readString(const JsonValue& parent, const char* key, std::string& value) {
+    const JsonValue* field = parent.find(key);
+    if (field && field->type == JsonValue::Type::STRING) {
+        value = field->string;
+    }
+}
+
+}  // namespace
+
+// =============================================================================
+// Loading
+// =============================================================================
+
+ErrorInfo loadPiperConfig(const std::string& path, PiperConfig& config) {
+    std::ifstream file(path);
+    if (!file) {
+        return ErrorInfo::error(ErrorCode::MODEL_NOT_FOUND, "Cannot open voice config: " + path);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string content = buffer.str();
+
+    JsonValue root;
+    try {
+        root = JsonParser(content).parse();
+    } catch (const std::exception& e) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG,
+            "Invalid voice config " + path + ": " + e.what());
+    }
+    if (root.type != JsonValue::Type::OBJECT) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Invalid voice config " + path + ": not an object");
+    }
+
+    config = PiperConfig();
+    if (const JsonValue* audio = root.find("audio")) {
+        readInt(*audio, "sample_rate", config.sample_rate);
+    }
+    if (const JsonValue* espeak = root.find("espeak")) {
+        readString(*espeak, "voice", config.espeak_voice);
+    }
+    if (const JsonValue* inference = root.find("inference")) {
+        readNumber(*inference, "noise_scale", config.noise_scale);
+        readNumber(*inference, "length_scale", config.length_scale);
+        readNumber(*inference, "noise_w", config.noise_w);
+    }
+    readString(root, "phoneme_type", config.phoneme_type);
+    readInt(root, "num_speakers", config.num_speakers);
+
+    if (const JsonValue* speakers = root.find("speaker_id_map")) {
+        for (const auto& entry : speakers->object) {
+            if (entry.second.type == JsonValue::Type::NUMBER) {
+                config.speaker_id_map[entry.first] = static_cast<int64_t>(entry.second.number);
+            }
+        }
+    }
+
+    const JsonValue* id_map = root.find("phoneme_id_map");
+    if (!id_map || id_map->object.empty()) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG, "Voice config has no phoneme_id_map: " + path);
+    }
+    for (const auto& entry : id_map->object) {
+        std::vector<int64_t> ids;
+        for (const auto& id : entry.second.array) {
+            if (id.type == JsonValue::Type::NUMBER) {
+                ids.push_back(static_cast<int64_t>(id.number));
+            }
+        }
+        if (!ids.empty()) {
+            config.phoneme_id_map[entry.first] = std::move(ids);
+        }
+    }
+
+    if (config.sample_rate <= 0 || config.num_speakers <= 0) {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG,
+            "Invalid sample_rate or num_speakers in voice config: " + path);
+    }
+    if (config.phoneme_type != "espeak" && config.phoneme_type != "pinyin" && config.phoneme_type != "text") {
+        return ErrorInfo::error(ErrorCode::INVALID_CONFIG,
+            "Unsupported phoneme_type '" + config.phoneme_type + "' in voice config: " + path);
+    }
+
+    return ErrorInfo::ok();
+}
+
+}  // namespace tts
@@ -0,0 +1,312 @@
+#include "internal/backends/piper/piper_phonemizer.hpp"
+
+#include <cpp-pinyin/G2pglobal.h>
+#include <cpp-pinyin/Pinyin.h>
+
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "internal/backends/matcha/tts_model_downloader.hpp"
+#include "internal/text/phoneme_utils.hpp"
+#include "internal/text/pinyin_service.hpp"
+#include "internal/text/text_normalizer.hpp"
+#include "internal/text/text_utils.hpp"
+
+namespace tts {
+
+namespace {
+
+// Piper special symbols
+const char* const kBos = "^";
+const char* const kEos = "$";
+const char* const kPad = "_";
+
+// Ordered for longest match (zh/ch/sh before z/c/s)
+const std::vector<std::string> kPinyinInitials = {
+    "zh", "ch", "sh",
+    "b", "p", "m", "f",
+    "d", "t", "n", "l",
+    "g", "k", "h",
+    "j", "q", "x",
+    "r", "z", "c", "s",
+    "y", "w",
+};
+
+bool startsWith(const std::string& s, const std::string& prefix) {
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+// Clause-ending punctuation kept as a phoneme after the clause (ASCII form)
+bool isClausePunctuation(const std::string& ch) {
+    return ch == "," || ch == "." || ch == "!" || ch == "?" || ch == ";" || ch == ":";
+}
+
+}  // namespace
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+void PiperPhonemizer::init(const PiperConfig& config) {
+    config_ = &config;
+    pinyin_converter_.reset();
+
+    if (config.phoneme_type == "pinyin") {
+        // Reuse TTSModelDownloader to ensure cpp-pinyin is available
+        TTSModelDownloader downloader;
+        if (!downloader.ensureCppPinyin()) {
+            throw std::runtime_error("Failed to download cpp-pinyin dictionary.");
+        }
+        // Shared with other backends/engines using the same dictionary directory
+        pinyin_converter_ = text::acquirePinyinConverter(downloader.getCppPinyinPath());
+    }
+
+    espeak_available_ = text::isEspeakNgAvailable();
+    if (config.phoneme_type == "espeak" && !espeak_available_) {
+        throw std::runtime_error(
+            "espeak-ng is required for this voice but not available. "
+            "Please install: brew install espeak-ng (macOS) or apt-get install espeak-ng (Linux)");
+    }
+}
+
+// =============================================================================
+// Text -> IDs
+// =============================================================================
+
+std::vector<int64_t> PiperPhonemizer::textToIds(const std::string& text) const {
+    if (!config_ || text.empty()) {
+        return {};
+    }
+
+    std::vector<std::string> phonemes;
+    if (config_->phoneme_type == "pinyin") {
+        phonemes = phonemizePinyin(text::normalizeText(text, text::Language::ZH));
+    } else if (config_->phoneme_type == "text") {
+        phonemes = phonemizeText(text);
+    } else {
+        // Number/date normalization only exists for English and Chinese
+        const std::string& voice = config_->espeak_voice;
+        if (startsWith(voice, "en")) {
+            phonemes = phonemizeEspeak(text::normalizeText(text, text::Language::EN), voice);
+        } else if (startsWith(voice, "cmn") || startsWith(voice, "zh") || startsWith(voice, "yue")) {
+            phonemes = phonemizeEspeak(text::normalizeText(text, text::Language::ZH), voice);
+        } else {
+            phonemes = phonemizeEspeak(text, voice);
+        }
+    }
+
+    // Only the symbols must not count as speech
+    bool has_speech = false;
+    for (const auto& phoneme : phonemes) {
+        if (phoneme != " " && !isClausePunctuation(phoneme)) {
+            has_speech = true;
+            break;
+        }
+    }
+    return has_speech ? phonemesToIds(phonemes) : std::vector<int64_t>();
+}
+
+std::vector<int64_t> PiperPhonemizer::phonemesToIds(const std::vector<std::string>& phonemes) const {
+    std::vector<int64_t> ids;
+    if (!config_) {
+        return ids;
+    }
+
+    const auto& id_map = config_->phoneme_id_map;
+    auto pad_it = id_map.find(kPad);
+    auto append = [&](const std::string& phoneme) {
+        auto it = id_map.find(phoneme);
+        if (it == id_map.end()) {
+            return false;
+        }
+        ids.insert(ids.end(), it->second.begin(), it->second.end());
+        return true;
+    };
+    auto append_pad = [&]() {
+        if (pad_it != id_map.end()) {
+            ids.insert(ids.end(), pad_it->second.begin(), pad_it->second.end());
+        }
+    };
+
+    append(kBos);
+    append_pad();
+    for (const auto& phoneme : phonemes) {
+        // Phonemes missing from the voice's table are dropped (as Piper does)
+        if (append(phoneme)) {
+            append_pad();
+        }
+    }
+    append(kEos);
+    return ids;
+}
+
+// =============================================================================
+// Front ends
+// =============================================================================
+
+std::vector<std::string> PiperPhonemizer::phonemizeEspeak(const std::string& text,
+                                                          const std::string& voice) const {
+    std::vector<std::string> phonemes;
+    std::vector<std::string> chars = text::splitUtf8(text);
+    std::string clause;
+
+    // espeak-ng drops punctuation, so phonemize clause by clause and put the
+    // clause punctuation back (the models were trained with it)
+    auto flush = [&](const std::string& punctuation) {
+        std::string ipa = text::espeakToIpa(clause, voice, 0);
+        clause.clear();
+        for (auto& phoneme : text::splitUtf8(ipa)) {
+            phonemes.push_back(std::move(phoneme));
+        }
+        if (!punctuation.empty() && !phonemes.empty()) {
+            phonemes.push_back(punctuation);
+            phonemes.push_back(" ");
+        }
+    };
+
+    for (size_t i = 0; i < chars.size(); ++i) {
+        std::string ch = text::mapChinesePunctToAscii(chars[i]);
+        // "." splits only before whitespace or at the end (not inside decimals)
+        bool boundary = isClausePunctuation(ch) &&
+            (ch != "." || i + 1 == chars.size() || chars[i + 1] == " " || chars[i + 1] == "\n");
+        if (boundary) {
+            flush(ch);
+        } else if (ch == "...") {
+            flush(".");
+        } else {
+            clause += chars[i];
+        }
+    }
+    flush("");
+
+    while (!phonemes.empty() && phonemes.back() == " ") {
+        phonemes.pop_back();
+    }
+    return phonemes;
+}
+
+std::vector<std::string> PiperPhonemizer::phonemizePinyin(const std::string& text) const {
+    std::vector<std::string> phonemes;
+    if (!pinyin_converter_) {
+        return phonemes;
+    }
+
+    auto chars = text::splitUtf8(text);
+    size_t i = 0;
+    while (i < chars.size()) {
+        // --- Chinese segment ---
+        if (text::isChineseChar(chars[i])) {
+            std::string chinese_segment;
+            while (i < chars.size() && text::isChineseChar(chars[i])) {
+                chinese_segment += chars[i++];
+            }
+
+            Pinyin::PinyinResVector pinyin_result = pinyin_converter_->hanziToPinyin(
+                chinese_segment,
+                Pinyin::ManTone::Style::TONE3,
+                Pinyin::Error::Default,
+                false,  // candidates
+                false,  // v_to_u
+                true);  // neutral_tone_with_five
+            for (const auto& res : pinyin_result) {
+                if (!res.error) {
+                    appendPinyinSyllable(res.pinyin, phonemes);
+                }
+            }
+            continue;
+        }
+
+        // --- English segment (only useful if the table has IPA symbols) ---
+        if (text::isEnglishLetter(chars[i])) {
+            std::string english_segment;
+            while (i < chars.size() &&
+                   (text::isEnglishLetter(chars[i]) || chars[i] == " " || chars[i] == "'")) {
+                english_segment += chars[i++];
+            }
+            if (espeak_available_) {
+                for (const auto& phoneme : text::splitUtf8(text::espeakToIpa(english_segment, "en-us", 0))) {
+                    if (hasPhoneme(phoneme)) {
+                        phonemes.push_back(phoneme);
+                    }
+                }
+            }
+            continue;
+        }
+
+        // --- Punctuation / spaces / other characters ---
+        std::string mapped = text::mapChinesePunctToAscii(chars[i++]);
+        if (hasPhoneme(mapped)) {
+            phonemes.push_back(mapped);
+        } else if (mapped == "...") {
+            phonemes.push_back(".");
+        }
+    }
+
+    return phonemes;
+}
+
+std::vector<std::string> PiperPhonemizer::phonemizeText(const std::string& text) const {
+    std::vector<std::string> phonemes;
+    for (auto& ch : text::splitUtf8(text)) {
+        if (ch.size() == 1) {
+            ch[0] = static_cast<char>(std::tolower(static_cast<unsigned char>(ch[0])));
+        }
+        phonemes.push_back(std::move(ch));
+    }
+    return phonemes;
+}
+
+void PiperPhonemizer::appendPinyinSyllable(const std::string& syllable,
+                                           std::vector<std::string>& phonemes) const {
+    if (syllable.empty()) {
+        return;
+    }
+
+    // Whole syllable with tone (e.g. "hao3")
+    if (hasPhoneme(syllable)) {
+        phonemes.push_back(syllable);
+        return;
+    }
+
+    std::string base = syllable;
+    std::string tone = "5";
+    if (std::isdigit(static_cast<unsigned char>(base.back()))) {
+        tone = base.substr(base.size() - 1);
+        base.pop_back();
+    }
+
+    // Initial + final with tone (e.g. "h" + "ao3")
+    std::string initial;
+    for (const auto& candidate : kPinyinInitials) {
+        if (startsWith(base, candidate) && base.size() > candidate.size()) {
+            initial = candidate;
+            break;
+        }
+    }
+    std::string final_ = base.substr(initial.size());
+
+    if (!initial.empty() && hasPhoneme(initial)) {
+        phonemes.push_back(initial);
+    }
+    if (hasPhoneme(final_ + tone)) {
+        phonemes.push_back(final_ + tone);
+    } else if (hasPhoneme(final_)) {
+        phonemes.push_back(final_);
+        if (hasPhoneme(tone)) {
+            phonemes.push_back(tone);
+        }
+    } else {
+        std::cerr << "[PiperPhonemizer] Unknown pinyin: " << syllable << std::endl;
+    }
+}
+
+bool PiperPhonemizer::hasPhoneme(const std::string& phoneme) const {
+    return config_ && config_->phoneme_id_map.count(phoneme) > 0;
+}
+
+}  // namespace tts
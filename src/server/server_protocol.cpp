@@ -0,0 +1,154 @@
+#include "internal/server/server_protocol.hpp"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// macOS 无 MSG_NOSIGNAL, 工作进程已忽略 SIGPIPE
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace tts {
+namespace server {
+
+bool writeFully(int fd, const void* data, size_t size) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        // MSG_NOSIGNAL: 对端关闭时返回 EPIPE 而不是触发 SIGPIPE
+        ssize_t n = send(fd, ptr, size, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        ptr += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool readFully(int fd, void* data, size_t size) {
+    uint8_t* ptr = static_cast<uint8_t*>(data);
+    while (size > 0) {
+        ssize_t n = read(fd, ptr, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (n == 0) {
+            return false;  // 对端关闭
+        }
+        ptr += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool sendResponse(int fd, ResponseHeader header, const void* payload, size_t size) {
+    header.magic = kProtocolMagic;
+    header.payload_size = static_cast<uint32_t>(size);
+    if (!writeFully(fd, &header, sizeof(header))) {
+        return false;
+    }
+    return size == 0 || writeFully(fd, payload, size);
+}
+
+bool sendError(int fd, ResponseStatus status, const std::string& message) {
+    ResponseHeader header;
+    header.status = static_cast<int32_t>(status);
+    return sendResponse(fd, header, message.data(), message.size());
+}
+
+namespace {
+
+constexpr int kMaxPassedFds = 4;
+
+}  // namespace
+
+bool sendResponseWithFds(int fd, ResponseHeader header, const int* fds, int num_fds) {
+    if (num_fds <= 0 || num_fds > kMaxPassedFds) {
+        return false;
+    }
+    header.magic = kProtocolMagic;
+    header.payload_size = 0;
+
+    iovec iov;
+    iov.iov_base = &header;
+    iov.iov_len = sizeof(header);
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * kMaxPassedFds)];
+    std::memset(control, 0, sizeof(control));
+
+    msghdr msg {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = CMSG_SPACE(sizeof(int) * num_fds);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * num_fds);
+    std::memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * num_fds);
+
+    ssize_t n;
+    do {
+        n = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    } while (n < 0 && errno == EINTR);
+    if (n < 0) {
+        return false;
+    }
+    // 描述符随第一个字节送达, 余下部分按普通数据补发
+    size_t sent = static_cast<size_t>(n);
+    return sent == sizeof(header) ||
+        writeFully(fd, reinterpret_cast<const uint8_t*>(&header) + sent, sizeof(header) - sent);
+}
+
+bool readResponseWithFds(int fd, ResponseHeader& header, int* fds, int max_fds, int& num_fds) {
+    num_fds = 0;
+
+    iovec iov;
+    iov.iov_base = &header;
+    iov.iov_len = sizeof(header);
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * kMaxPassedFds)];
+    msghdr msg {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t n;
+    do {
+        n = recvmsg(fd, &msg, 0);
+    } while (n < 0 && errno == EINTR);
+    if (n <= 0) {
+        return false;
+    }
+
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+        int count = static_cast<int>((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+        const int* received = reinterpret_cast<const int*>(CMSG_DATA(cmsg));
+        for (int i = 0; i < count; ++i) {
+            if (num_fds < max_fds) {
+                fds[num_fds++] = received[i];
+            } else {
+                close(received[i]);
+            }
+        }
+    }
+
+    size_t got = static_cast<size_t>(n);
+    return got == sizeof(header) ||
+        readFully(fd, reinterpret_cast<uint8_t*>(&header) + got, sizeof(header) - got);
+}
+
+}  // namespace server
+}  // namespace tts
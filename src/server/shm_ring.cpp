@@ -0,0 +1,320 @@
+#include "internal/server/shm_ring.hpp"
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace tts {
+namespace server {
+
+namespace {
+
+constexpr uint32_t kShmMagic = 0x52534D53;     ///< "SMSR"
+constexpr size_t kMessageSize = 256;
+
+}  // namespace
+
+/// 共享头部 (位于 memfd 第一页)
+struct ShmRing::Header {
+    uint32_t magic;
+    uint32_t sample_rate;
+    uint64_t capacity;
+    std::atomic<uint64_t> write_pos;
+    std::atomic<uint64_t> read_pos;
+    std::atomic<int32_t> status;        ///< ShmStreamStatus
+    std::atomic<uint32_t> closed;
+    char message[kMessageSize];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared-memory ring requires lock-free 64-bit atomics");
+
+ShmRing::~ShmRing() {
+    release();
+}
+
+void ShmRing::release() {
+    if (base_) {
+        munmap(base_, mapped_size_);
+        base_ = nullptr;
+    }
+    for (int* fd : {&memfd_, &data_fd_, &space_fd_}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+    capacity_ = 0;
+    mapped_size_ = 0;
+}
+
+#if defined(__linux__)
+
+bool ShmRing::mapRegion(bool initialize) {
+    // 预留 头部 + 2 * 容量 的连续地址空间，再用 MAP_FIXED 把数据区映射两次
+    mapped_size_ = header_size_ + 2 * capacity_;
+    void* reserve = mmap(nullptr, mapped_size_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserve == MAP_FAILED) {
+        return false;
+    }
+    base_ = static_cast<uint8_t*>(reserve);
+
+    void* first = mmap(base_, header_size_ + capacity_, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_FIXED, memfd_, 0);
+    void* mirror = mmap(base_ + header_size_ + capacity_, capacity_, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_FIXED, memfd_, static_cast<off_t>(header_size_));
+    if (first == MAP_FAILED || mirror == MAP_FAILED) {
+        munmap(base_, mapped_size_);
+        base_ = nullptr;
+        return false;
+    }
+
+    Header* header = reinterpret_cast<Header*>(base_);
+    if (initialize) {
+        new (header) Header();
+        header->magic = kShmMagic;
+        header->capacity = capacity_;
+        header->write_pos.store(0);
+        header->read_pos.store(0);
+        header->status.store(static_cast<int32_t>(ShmStreamStatus::RUNNING));
+        header->closed.store(0);
+        header->message[0] = '\0';
+    } else if (header->magic != kShmMagic || header->capacity != capacity_) {
+        munmap(base_, mapped_size_);
+        base_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool ShmRing::create(size_t min_capacity, int sample_rate) {
+    release();
+
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    header_size_ = std::max(page, (sizeof(Header) + page - 1) / page * page);
+    capacity_ = std::max(page, (min_capacity + page - 1) / page * page);
+
+    memfd_ = memfd_create("evo_tts_stream", MFD_CLOEXEC);
+    data_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    space_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (memfd_ < 0 || data_fd_ < 0 || space_fd_ < 0 ||
+        ftruncate(memfd_, static_cast<off_t>(header_size_ + capacity_)) < 0 ||
+        !mapRegion(true)) {
+        release();
+        return false;
+    }
+
+    reinterpret_cast<Header*>(base_)->sample_rate = static_cast<uint32_t>(sample_rate);
+    return true;
+}
+
+bool ShmRing::attach(int memfd, int data_fd, int space_fd) {
+    release();
+    memfd_ = memfd;
+    data_fd_ = data_fd;
+    space_fd_ = space_fd;
+
+    // 映射前先从头部读取容量 (与 Header 前三个字段布局一致)
+    struct {
+        uint32_t magic;
+        uint32_t sample_rate;
+        uint64_t capacity;
+    } probe {};
+    if (pread(memfd_, &probe, sizeof(probe), 0) != static_cast<ssize_t>(sizeof(probe)) ||
+        probe.magic != kShmMagic || probe.capacity == 0) {
+        release();
+        return false;
+    }
+
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    header_size_ = std::max(page, (sizeof(Header) + page - 1) / page * page);
+    capacity_ = static_cast<size_t>(probe.capacity);
+    if (!mapRegion(false)) {
+        release();
+        return false;
+    }
+    return true;
+}
+
+#else  // !__linux__
+
+bool ShmRing::mapRegion(bool) {
+    return false;
+}
+
+bool ShmRing::create(size_t, int) {
+    return false;
+}
+
+bool ShmRing::attach(int memfd, int data_fd, int space_fd) {
+    memfd_ = memfd;
+    data_fd_ = data_fd;
+    space_fd_ = space_fd;
+    release();
+    return false;
+}
+
+#endif  // __linux__
+
+namespace {
+
+/// eventfd 计数 +1
+void signalFd(int fd) {
+    uint64_t one = 1;
+    ssize_t n;
+    do {
+        n = ::write(fd, &one, sizeof(one));
+    } while (n < 0 && errno == EINTR);
+}
+
+/// 清空 eventfd 计数 (非阻塞)
+void drainFd(int fd) {
+    uint64_t value;
+    ssize_t n;
+    do {
+        n = ::read(fd, &value, sizeof(value));
+    } while (n < 0 && errno == EINTR);
+}
+
+}  // namespace
+
+int ShmRing::sampleRate() const {
+    return base_ ? static_cast<int>(reinterpret_cast<const Header*>(base_)->sample_rate) : 0;
+}
+
+bool ShmRing::write(const void* data, size_t size, int abort_fd) {
+    if (!base_) {
+        return false;
+    }
+    Header* header = reinterpret_cast<Header*>(base_);
+    uint8_t* ring = base_ + header_size_;
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+
+    while (size > 0) {
+        uint64_t write_pos = header->write_pos.load(std::memory_order_relaxed);
+        uint64_t read_pos = header->read_pos.load(std::memory_order_acquire);
+        size_t space = capacity_ - static_cast<size_t>(write_pos - read_pos);
+
+        if (space == 0) {
+            // 缓冲区满: 等待读端消费，同时监视客户端连接
+            pollfd fds[2];
+            fds[0] = {space_fd_, POLLIN, 0};
+            fds[1] = {abort_fd, 0, 0};
+            int rc = poll(fds, abort_fd >= 0 ? 2 : 1, -1);
+            if (rc < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            if (abort_fd >= 0 && (fds[1].revents & (POLLHUP | POLLERR))) {
+                return false;
+            }
+            drainFd(space_fd_);
+            continue;
+        }
+
+        // 镜像映射保证 [offset, offset + space) 连续
+        size_t n = std::min(space, size);
+        std::memcpy(ring + (write_pos % capacity_), src, n);
+        header->write_pos.store(write_pos + n, std::memory_order_release);
+        signalFd(data_fd_);
+
+        src += n;
+        size -= n;
+    }
+    return true;
+}
+
+void ShmRing::close(ShmStreamStatus status, const std::string& message) {
+    if (!base_) {
+        return;
+    }
+    Header* header = reinterpret_cast<Header*>(base_);
+    size_t len = std::min(message.size(), kMessageSize - 1);
+    std::memcpy(header->message, message.data(), len);
+    header->message[len] = '\0';
+    header->status.store(static_cast<int32_t>(status), std::memory_order_relaxed);
+    header->closed.store(1, std::memory_order_release);
+    signalFd(data_fd_);
+}
+
+size_t ShmRing::readable() const {
+    if (!base_) {
+        return 0;
+    }
+    const Header* header = reinterpret_cast<const Header*>(base_);
+    uint64_t write_pos = header->write_pos.load(std::memory_order_acquire);
+    uint64_t read_pos = header->read_pos.load(std::memory_order_relaxed);
+    return static_cast<size_t>(write_pos - read_pos);
+}
+
+const uint8_t* ShmRing::readPtr() const {
+    if (!base_) {
+        return nullptr;
+    }
+    const Header* header = reinterpret_cast<const Header*>(base_);
+    uint64_t read_pos = header->read_pos.load(std::memory_order_relaxed);
+    return base_ + header_size_ + (read_pos % capacity_);
+}
+
+void ShmRing::consume(size_t size) {
+    if (!base_) {
+        return;
+    }
+    Header* header = reinterpret_cast<Header*>(base_);
+    size = std::min(size, readable());
+    header->read_pos.fetch_add(size, std::memory_order_release);
+    signalFd(space_fd_);
+}
+
+bool ShmRing::waitReadable(int timeout_ms) {
+    if (!base_) {
+        return true;
+    }
+    while (readable() == 0 && !closed()) {
+        pollfd fd = {data_fd_, POLLIN, 0};
+        int rc = poll(&fd, 1, timeout_ms);
+        if (rc < 0) {
+            if (errno == EINTR) continue;
+            return true;
+        }
+        if (rc == 0) {
+            return false;
+        }
+        drainFd(data_fd_);
+    }
+    return true;
+}
+
+bool ShmRing::closed() const {
+    return !base_ ||
+        reinterpret_cast<const Header*>(base_)->closed.load(std::memory_order_acquire) != 0;
+}
+
+ShmStreamStatus ShmRing::status() const {
+    if (!base_) {
+        return ShmStreamStatus::FAILED;
+    }
+    return static_cast<ShmStreamStatus>(
+        reinterpret_cast<const Header*>(base_)->status.load(std::memory_order_relaxed));
+}
+
+std::string ShmRing::message() const {
+    if (!base_) {
+        return "Stream not attached";
+    }
+    return std::string(reinterpret_cast<const Header*>(base_)->message);
+}
+
+}  // namespace server
+}  // namespace tts
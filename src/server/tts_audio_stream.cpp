@@ -0,0 +1,90 @@
+#include "tts_server.hpp"
+
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "internal/server/shm_ring.hpp"
+#include "internal/tts_result_impl.hpp"
+
+namespace Evo {
+
+using tts::server::ShmRing;
+using tts::server::ShmStreamStatus;
+
+// =============================================================================
+// TtsAudioStream::Impl
+// =============================================================================
+
+struct TtsAudioStream::Impl {
+    ShmRing ring;
+};
+
+// =============================================================================
+// TtsAudioStream 实现
+// =============================================================================
+
+TtsAudioStream::TtsAudioStream() : impl_(std::make_unique<Impl>()) {}
+
+TtsAudioStream::~TtsAudioStream() = default;
+
+std::shared_ptr<TtsAudioStream> TtsAudioStream::Attach(const AudioStreamHandle& handle) {
+    std::shared_ptr<TtsAudioStream> stream(new TtsAudioStream());
+    if (!stream->impl_->ring.attach(handle.memfd, handle.data_fd, handle.space_fd)) {
+        return nullptr;
+    }
+    return stream;
+}
+
+int TtsAudioStream::GetSampleRate() const {
+    return impl_->ring.sampleRate();
+}
+
+size_t TtsAudioStream::Read(const float** samples, int timeout_ms) {
+    ShmRing& ring = impl_->ring;
+    if (!ring.waitReadable(timeout_ms)) {
+        return 0;  // 超时
+    }
+    size_t num_samples = ring.readable() / sizeof(float);
+    *samples = num_samples > 0 ? reinterpret_cast<const float*>(ring.readPtr()) : nullptr;
+    return num_samples;
+}
+
+void TtsAudioStream::Consume(size_t num_samples) {
+    impl_->ring.consume(num_samples * sizeof(float));
+}
+
+std::shared_ptr<TtsEngineResult> TtsAudioStream::ReadAll() {
+    auto result = std::make_shared<TtsEngineResult>();
+    auto& impl = *result->impl_;
+
+    const float* samples = nullptr;
+    size_t n;
+    while ((n = Read(&samples)) > 0) {
+        impl.audio_float.insert(impl.audio_float.end(), samples, samples + n);
+        Consume(n);
+    }
+
+    impl.sample_rate = GetSampleRate();
+    impl.duration_ms = impl.sample_rate > 0
+        ? static_cast<int>(impl.audio_float.size() * 1000 / impl.sample_rate) : 0;
+    impl.success = IsSuccess();
+    impl.message = impl.success ? "Success" : GetMessage();
+    return result;
+}
+
+bool TtsAudioStream::IsFinished() const {
+    return impl_->ring.closed() && impl_->ring.readable() < sizeof(float);
+}
+
+bool TtsAudioStream::IsSuccess() const {
+    return impl_->ring.valid() && impl_->ring.status() != ShmStreamStatus::FAILED;
+}
+
+std::string TtsAudioStream::GetMessage() const {
+    return impl_->ring.message();
+}
+
+}  // namespace Evo
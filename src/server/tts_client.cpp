@@ -0,0 +1,231 @@
+#include "tts_server.hpp"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "internal/server/server_protocol.hpp"
+#include "internal/tts_result_impl.hpp"
+
+namespace Evo {
+
+using tts::server::MessageType;
+using tts::server::RequestHeader;
+using tts::server::ResponseHeader;
+using tts::server::ResponseStatus;
+using tts::server::WireWorkerStats;
+
+// =============================================================================
+// TtsClient::Impl
+// =============================================================================
+
+struct TtsClient::Impl {
+    std::string socket_path;
+    int fd = -1;
+
+    bool connect() {
+        if (fd >= 0) {
+            return true;
+        }
+
+        sockaddr_un addr {};
+        if (socket_path.size() >= sizeof(addr.sun_path)) {
+            return false;
+        }
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            return false;
+        }
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    /**
+     * @brief 发送请求并读取响应
+     * @return 成功返回 true; 传输失败时关闭连接
+     */
+    bool roundTrip(MessageType type, const std::string& text, float speech_rate,
+                   ResponseHeader& header, std::vector<uint8_t>& payload) {
+        if (!connect()) {
+            return false;
+        }
+
+        RequestHeader req;
+        req.type = static_cast<uint16_t>(type);
+        req.payload_size = static_cast<uint32_t>(text.size());
+        req.speech_rate = speech_rate;
+
+        bool ok = tts::server::writeFully(fd, &req, sizeof(req)) &&
+                  (text.empty() || tts::server::writeFully(fd, text.data(), text.size())) &&
+                  tts::server::readFully(fd, &header, sizeof(header)) &&
+                  header.magic == tts::server::kProtocolMagic;
+        if (ok) {
+            payload.resize(header.payload_size);
+            ok = payload.empty() || tts::server::readFully(fd, payload.data(), payload.size());
+        }
+        if (!ok) {
+            close();
+        }
+        return ok;
+    }
+};
+
+// =============================================================================
+// TtsClient 实现
+// =============================================================================
+
+TtsClient::TtsClient(const std::string& socket_path)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->socket_path = socket_path;
+}
+
+TtsClient::~TtsClient() {
+    impl_->close();
+}
+
+bool TtsClient::Connect() {
+    return impl_->connect();
+}
+
+void TtsClient::Close() {
+    impl_->close();
+}
+
+bool TtsClient::IsConnected() const {
+    return impl_->fd >= 0;
+}
+
+std::shared_ptr<TtsEngineResult> TtsClient::Call(const std::string& text, float speech_rate) {
+    auto result = std::make_shared<TtsEngineResult>();
+
+    if (text.size() > tts::server::kMaxTextPayload) {
+        result->impl_->message = "Text too long";
+        return result;
+    }
+
+    ResponseHeader header;
+    std::vector<uint8_t> payload;
+    if (!impl_->roundTrip(MessageType::SYNTHESIZE, text, speech_rate, header, payload)) {
+        result->impl_->message = "Failed to communicate with server: " + impl_->socket_path;
+        return result;
+    }
+
+    if (header.status != static_cast<int32_t>(ResponseStatus::OK)) {
+        result->impl_->message.assign(payload.begin(), payload.end());
+        return result;
+    }
+
+    const int16_t* pcm = reinterpret_cast<const int16_t*>(payload.data());
+    size_t num_samples = payload.size() / sizeof(int16_t);
+
+    auto& impl = *result->impl_;
+    impl.audio_float.resize(num_samples);
+    for (size_t i = 0; i < num_samples; ++i) {
+        impl.audio_float[i] = static_cast<float>(pcm[i]) / 32768.0f;
+    }
+    impl.sample_rate = static_cast<int>(header.sample_rate);
+    impl.duration_ms = impl.sample_rate > 0
+        ? static_cast<int>(num_samples * 1000 / impl.sample_rate) : 0;
+    impl.processing_time_ms = static_cast<int>(header.processing_time_ms);
+    impl.success = true;
+    impl.message = "Success";
+    return result;
+}
+
+std::shared_ptr<TtsAudioStream> TtsClient::CallStream(const std::string& text, float speech_rate) {
+    if (text.size() > tts::server::kMaxTextPayload || !impl_->connect()) {
+        return nullptr;
+    }
+
+    RequestHeader req;
+    req.type = static_cast<uint16_t>(MessageType::SYNTHESIZE_SHM);
+    req.payload_size = static_cast<uint32_t>(text.size());
+    req.speech_rate = speech_rate;
+
+    int fds[3] = {-1, -1, -1};
+    int num_fds = 0;
+    ResponseHeader header;
+    bool ok = tts::server::writeFully(impl_->fd, &req, sizeof(req)) &&
+              tts::server::writeFully(impl_->fd, text.data(), text.size()) &&
+              tts::server::readResponseWithFds(impl_->fd, header, fds, 3, num_fds) &&
+              header.magic == tts::server::kProtocolMagic;
+
+    if (ok && header.status != static_cast<int32_t>(ResponseStatus::OK)) {
+        // 错误响应: 丢弃错误信息, 连接仍可复用
+        std::vector<uint8_t> message(header.payload_size);
+        ok = message.empty() || tts::server::readFully(impl_->fd, message.data(), message.size());
+        for (int i = 0; i < num_fds; ++i) {
+            ::close(fds[i]);
+        }
+        if (!ok) {
+            impl_->close();
+        }
+        return nullptr;
+    }
+
+    if (!ok || num_fds != 3) {
+        for (int i = 0; i < num_fds; ++i) {
+            ::close(fds[i]);
+        }
+        impl_->close();
+        return nullptr;
+    }
+
+    AudioStreamHandle handle;
+    handle.memfd = fds[0];
+    handle.data_fd = fds[1];
+    handle.space_fd = fds[2];
+    return TtsAudioStream::Attach(handle);
+}
+
+std::vector<WorkerStats> TtsClient::GetWorkerStats() {
+    std::vector<WorkerStats> stats;
+
+    ResponseHeader header;
+    std::vector<uint8_t> payload;
+    if (!impl_->roundTrip(MessageType::STATS, std::string(), 0.0f, header, payload) ||
+        header.status != static_cast<int32_t>(ResponseStatus::OK)) {
+        return stats;
+    }
+
+    size_t count = payload.size() / sizeof(WireWorkerStats);
+    for (size_t i = 0; i < count; ++i) {
+        WireWorkerStats w;
+        std::memcpy(&w, payload.data() + i * sizeof(WireWorkerStats), sizeof(w));
+
+        WorkerStats s;
+        s.index = w.index;
+        s.pid = w.pid;
+        s.alive = w.alive != 0;
+        s.restarts = w.restarts;
+        s.requests = w.requests;
+        s.failures = w.failures;
+        s.audio_ms = w.audio_ms;
+        s.busy_ms = w.busy_ms;
+        s.text_bytes = w.text_bytes;
+        s.last_active_ms = w.last_active_ms;
+        stats.push_back(s);
+    }
+    return stats;
+}
+
+}  // namespace Evo
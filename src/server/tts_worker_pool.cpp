@@ -0,0 +1,571 @@
+#include "tts_server.hpp"
+
+#include <errno.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "internal/server/server_protocol.hpp"
+#include "internal/server/shm_ring.hpp"
+
+namespace Evo {
+
+namespace {
+
+using tts::server::MessageType;
+using tts::server::RequestHeader;
+using tts::server::ResponseHeader;
+using tts::server::ResponseStatus;
+using tts::server::ShmRing;
+using tts::server::ShmStreamStatus;
+using tts::server::WireWorkerStats;
+
+int64_t nowUnixMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// =============================================================================
+// 共享统计区 (MAP_SHARED 匿名映射, fork 后父子进程可见)
+// =============================================================================
+
+struct WorkerSlot {
+    std::atomic<int32_t> pid;
+    std::atomic<int32_t> restarts;
+    std::atomic<uint64_t> requests;
+    std::atomic<uint64_t> failures;
+    std::atomic<uint64_t> audio_ms;
+    std::atomic<uint64_t> busy_ms;
+    std::atomic<uint64_t> text_bytes;
+    std::atomic<int64_t> last_active_ms;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared-memory stats require lock-free 64-bit atomics");
+
+/**
+ * 流式回调: 把每个音频块写入共享内存环形缓冲区
+ */
+class ShmStreamWriter : public TtsResultCallback {
+public:
+    ShmStreamWriter(ShmRing& ring, int conn) : ring_(ring), conn_(conn) {}
+
+    void OnEvent(std::shared_ptr<TtsEngineResult> result) override {
+        if (aborted_ || !result) {
+            return;
+        }
+        auto audio = result->GetAudioFloat();
+        if (!ring_.write(audio.data(), audio.size() * sizeof(float), conn_)) {
+            aborted_ = true;
+            return;
+        }
+        audio_ms_ += static_cast<uint64_t>(result->GetDurationMs());
+    }
+
+    void OnComplete() override {
+        ring_.close(ShmStreamStatus::COMPLETED);
+    }
+
+    void OnError(const std::string& message) override {
+        failed_ = true;
+        ring_.close(ShmStreamStatus::FAILED, message);
+    }
+
+    bool aborted() const { return aborted_; }
+    bool failed() const { return failed_ || aborted_; }
+    uint64_t audioMs() const { return audio_ms_; }
+
+private:
+    ShmRing& ring_;
+    int conn_;
+    bool aborted_ = false;
+    bool failed_ = false;
+    uint64_t audio_ms_ = 0;
+};
+
+}  // namespace
+
+// =============================================================================
+// TtsWorkerPool::Impl
+// =============================================================================
+
+struct TtsWorkerPool::Impl {
+    TtsConfig config;
+    WorkerPoolConfig pool_config;
+    int num_workers = 1;
+
+    std::unique_ptr<TtsEngine> engine;
+    int listen_fd = -1;
+    WorkerSlot* slots = nullptr;
+    size_t slots_bytes = 0;
+
+    std::atomic<bool> running{false};
+    std::atomic<bool> stop_requested{false};
+
+    // -------------------------------------------------------------------------
+    // 初始化
+    // -------------------------------------------------------------------------
+
+    bool createSocket() {
+        const std::string& path = pool_config.socket_path;
+        sockaddr_un addr {};
+        if (path.size() >= sizeof(addr.sun_path)) {
+            std::cerr << "[WorkerPool] Socket path too long: " << path << std::endl;
+            return false;
+        }
+
+        listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd < 0) {
+            std::cerr << "[WorkerPool] socket() failed: " << strerror(errno) << std::endl;
+            return false;
+        }
+
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(path.c_str());
+
+        if (bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            std::cerr << "[WorkerPool] bind(" << path << ") failed: " << strerror(errno) << std::endl;
+            close(listen_fd);
+            listen_fd = -1;
+            return false;
+        }
+        if (listen(listen_fd, pool_config.listen_backlog) < 0) {
+            std::cerr << "[WorkerPool] listen() failed: " << strerror(errno) << std::endl;
+            close(listen_fd);
+            listen_fd = -1;
+            return false;
+        }
+        return true;
+    }
+
+    bool createSharedStats() {
+        slots_bytes = sizeof(WorkerSlot) * num_workers;
+        void* mem = mmap(nullptr, slots_bytes, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED) {
+            std::cerr << "[WorkerPool] mmap() for stats failed: " << strerror(errno) << std::endl;
+            return false;
+        }
+        slots = static_cast<WorkerSlot*>(mem);
+        for (int i = 0; i < num_workers; ++i) {
+            new (&slots[i]) WorkerSlot();
+            slots[i].pid.store(0);
+            slots[i].restarts.store(0);
+            slots[i].requests.store(0);
+            slots[i].failures.store(0);
+            slots[i].audio_ms.store(0);
+            slots[i].busy_ms.store(0);
+            slots[i].text_bytes.store(0);
+            slots[i].last_active_ms.store(0);
+        }
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // 工作进程
+    // -------------------------------------------------------------------------
+
+    bool spawnWorker(int index) {
+        // fork 前刷新输出缓冲, 避免子进程重复输出
+        std::cout.flush();
+        std::cerr.flush();
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            std::cerr << "[WorkerPool] fork() failed: " << strerror(errno) << std::endl;
+            return false;
+        }
+        if (pid == 0) {
+            workerMain(index);
+            _exit(0);
+        }
+        slots[index].pid.store(static_cast<int32_t>(pid));
+        return true;
+    }
+
+    [[noreturn]] void workerMain(int index) {
+        signal(SIGINT, SIG_DFL);
+        signal(SIGTERM, SIG_DFL);
+        signal(SIGPIPE, SIG_IGN);
+
+        while (true) {
+            int conn = accept(listen_fd, nullptr, nullptr);
+            if (conn < 0) {
+                if (errno == EINTR || errno == ECONNABORTED) continue;
+                std::cerr << "[WorkerPool] worker " << index << " accept() failed: "
+                          << strerror(errno) << std::endl;
+                _exit(1);
+            }
+            serveConnection(index, conn);
+            close(conn);
+        }
+    }
+
+    void serveConnection(int index, int conn) {
+        WorkerSlot& slot = slots[index];
+
+        while (true) {
+            RequestHeader req;
+            if (!tts::server::readFully(conn, &req, sizeof(req))) {
+                return;  // 客户端断开
+            }
+            if (req.magic != tts::server::kProtocolMagic ||
+                req.version != tts::server::kProtocolVersion ||
+                req.payload_size > tts::server::kMaxTextPayload) {
+                tts::server::sendError(conn, ResponseStatus::BAD_REQUEST, "Bad request header");
+                return;
+            }
+
+            std::string text(req.payload_size, '\0');
+            if (req.payload_size > 0 && !tts::server::readFully(conn, &text[0], text.size())) {
+                return;
+            }
+
+            auto type = static_cast<MessageType>(req.type);
+            bool ok = true;
+            switch (type) {
+                case MessageType::PING: {
+                    ResponseHeader resp;
+                    resp.worker_index = index;
+                    ok = tts::server::sendResponse(conn, resp, nullptr, 0);
+                    break;
+                }
+                case MessageType::STATS: {
+                    auto wire = collectWireStats();
+                    ResponseHeader resp;
+                    resp.worker_index = index;
+                    ok = tts::server::sendResponse(conn, resp, wire.data(),
+                                                   wire.size() * sizeof(WireWorkerStats));
+                    break;
+                }
+                case MessageType::SYNTHESIZE:
+                    ok = handleSynthesize(index, slot, conn, text, req.speech_rate);
+                    break;
+                case MessageType::SYNTHESIZE_SHM:
+                    ok = handleSynthesizeShm(index, slot, conn, text, req.speech_rate);
+                    break;
+                default:
+                    ok = tts::server::sendError(conn, ResponseStatus::BAD_REQUEST, "Unknown message type");
+                    break;
+            }
+            if (!ok) {
+                return;
+            }
+        }
+    }
+
+    bool handleSynthesize(int index, WorkerSlot& slot, int conn,
+                          const std::string& text, float speech_rate) {
+        auto start = std::chrono::steady_clock::now();
+
+        // 每个工作进程独占自己的引擎副本, 语速覆盖只影响本次请求
+        float default_rate = config.speech_rate;
+        bool override_rate = speech_rate > 0.0f && speech_rate != default_rate;
+        if (override_rate) {
+            engine->SetSpeed(speech_rate);
+        }
+        auto result = engine->Call(text);
+        if (override_rate) {
+            engine->SetSpeed(default_rate);
+        }
+
+        auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        slot.requests.fetch_add(1);
+        slot.text_bytes.fetch_add(text.size());
+        slot.busy_ms.fetch_add(static_cast<uint64_t>(elapsed_ms));
+        slot.last_active_ms.store(nowUnixMs());
+
+        if (!result || !result->IsSuccess()) {
+            slot.failures.fetch_add(1);
+            return tts::server::sendError(conn, ResponseStatus::SYNTHESIS_FAILED,
+                result ? result->GetMessage() : "Synthesis failed");
+        }
+
+        slot.audio_ms.fetch_add(static_cast<uint64_t>(result->GetDurationMs()));
+
+        auto pcm = result->GetAudioInt16();
+        ResponseHeader resp;
+        resp.status = static_cast<int32_t>(ResponseStatus::OK);
+        resp.sample_rate = static_cast<uint32_t>(result->GetSampleRate());
+        resp.processing_time_ms = static_cast<uint32_t>(elapsed_ms);
+        resp.worker_index = index;
+        return tts::server::sendResponse(conn, resp, pcm.data(), pcm.size() * sizeof(int16_t));
+    }
+
+    bool handleSynthesizeShm(int index, WorkerSlot& slot, int conn,
+                             const std::string& text, float speech_rate) {
+        auto start = std::chrono::steady_clock::now();
+
+        ShmRing ring;
+        if (!ring.create(pool_config.stream_buffer_bytes, engine->GetSampleRate())) {
+            return tts::server::sendError(conn, ResponseStatus::UNSUPPORTED,
+                "Shared-memory streams are not available on this platform");
+        }
+
+        // 先把句柄交给客户端, 再开始合成, 客户端可以边合成边读取
+        ResponseHeader resp;
+        resp.status = static_cast<int32_t>(ResponseStatus::OK);
+        resp.sample_rate = static_cast<uint32_t>(engine->GetSampleRate());
+        resp.worker_index = index;
+        int fds[3] = {ring.memfd(), ring.dataFd(), ring.spaceFd()};
+        if (!tts::server::sendResponseWithFds(conn, resp, fds, 3)) {
+            return false;
+        }
+
+        float default_rate = config.speech_rate;
+        bool override_rate = speech_rate > 0.0f && speech_rate != default_rate;
+        if (override_rate) {
+            engine->SetSpeed(speech_rate);
+        }
+        auto writer = std::make_shared<ShmStreamWriter>(ring, conn);
+        engine->StreamingCall(text, writer);
+        if (override_rate) {
+            engine->SetSpeed(default_rate);
+        }
+
+        auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        slot.requests.fetch_add(1);
+        slot.text_bytes.fetch_add(text.size());
+        slot.busy_ms.fetch_add(static_cast<uint64_t>(elapsed_ms));
+        slot.last_active_ms.store(nowUnixMs());
+        if (writer->failed()) {
+            slot.failures.fetch_add(1);
+        } else {
+            slot.audio_ms.fetch_add(writer->audioMs());
+        }
+
+        // 客户端已断开时结束该连接
+        return !writer->aborted();
+    }
+
+    std::vector<WireWorkerStats> collectWireStats() const {
+        std::vector<WireWorkerStats> wire(num_workers);
+        for (int i = 0; i < num_workers; ++i) {
+            const WorkerSlot& s = slots[i];
+            int32_t pid = s.pid.load();
+            wire[i].index = i;
+            wire[i].pid = pid;
+            wire[i].alive = (pid > 0 && kill(pid, 0) == 0) ? 1 : 0;
+            wire[i].restarts = s.restarts.load();
+            wire[i].requests = s.requests.load();
+            wire[i].failures = s.failures.load();
+            wire[i].audio_ms = s.audio_ms.load();
+            wire[i].busy_ms = s.busy_ms.load();
+            wire[i].text_bytes = s.text_bytes.load();
+            wire[i].last_active_ms = s.last_active_ms.load();
+        }
+        return wire;
+    }
+
+    int findSlotByPid(pid_t pid) const {
+        for (int i = 0; i < num_workers; ++i) {
+            if (slots[i].pid.load() == pid) return i;
+        }
+        return -1;
+    }
+
+    // -------------------------------------------------------------------------
+    // 清理
+    // -------------------------------------------------------------------------
+
+    void terminateWorkers() {
+        if (!slots) return;
+        for (int i = 0; i < num_workers; ++i) {
+            int32_t pid = slots[i].pid.load();
+            if (pid > 0) {
+                kill(pid, SIGTERM);
+            }
+        }
+        for (int i = 0; i < num_workers; ++i) {
+            int32_t pid = slots[i].pid.load();
+            if (pid > 0) {
+                waitpid(pid, nullptr, 0);
+                slots[i].pid.store(0);
+            }
+        }
+    }
+
+    void release() {
+        terminateWorkers();
+        if (listen_fd >= 0) {
+            close(listen_fd);
+            listen_fd = -1;
+            unlink(pool_config.socket_path.c_str());
+        }
+        if (slots) {
+            munmap(slots, slots_bytes);
+            slots = nullptr;
+        }
+        engine.reset();
+        running.store(false);
+    }
+};
+
+// =============================================================================
+// TtsWorkerPool 实现
+// =============================================================================
+
+TtsWorkerPool::TtsWorkerPool(const TtsConfig& config, const WorkerPoolConfig& pool_config)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->config = config;
+    impl_->pool_config = pool_config;
+
+    int workers = pool_config.num_workers;
+    if (workers <= 0) {
+        workers = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    impl_->num_workers = workers > 0 ? workers : 1;
+}
+
+TtsWorkerPool::~TtsWorkerPool() {
+    impl_->release();
+}
+
+bool TtsWorkerPool::Start() {
+    if (impl_->running.load()) {
+        return true;
+    }
+
+    // fork 后 ORT 线程池不可用: 主进程内只允许单线程推理, 且启动前不得创建任何线程
+    TtsConfig engine_config = impl_->config;
+    engine_config.num_threads = 1;
+    engine_config.idle_trim_ms = 0;
+    engine_config.idle_unload_ms = 0;
+    engine_config.batch_window_ms = 0;  // 工作进程逐个处理请求, 批处理无收益
+    engine_config.preload_async = false;  // 预加载在 fork 前同步完成, 缓存随写时复制共享
+
+    impl_->engine = std::make_unique<TtsEngine>(engine_config);
+    if (!impl_->engine->IsInitialized()) {
+        std::cerr << "[WorkerPool] Engine initialization failed" << std::endl;
+        impl_->engine.reset();
+        return false;
+    }
+
+    if (!impl_->createSocket() || !impl_->createSharedStats()) {
+        impl_->release();
+        return false;
+    }
+
+    for (int i = 0; i < impl_->num_workers; ++i) {
+        if (!impl_->spawnWorker(i)) {
+            impl_->release();
+            return false;
+        }
+    }
+
+    impl_->stop_requested.store(false);
+    impl_->running.store(true);
+    std::cout << "[WorkerPool] " << impl_->num_workers << " workers listening on "
+              << impl_->pool_config.socket_path << std::endl;
+    return true;
+}
+
+void TtsWorkerPool::Run() {
+    if (!impl_->running.load()) {
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto restart_delay = std::chrono::milliseconds(impl_->pool_config.restart_delay_ms);
+    // 空槽位 (进程已退出或 fork 失败) 最早的重启时间
+    std::vector<Clock::time_point> restart_at(impl_->num_workers);
+
+    while (!impl_->stop_requested.load()) {
+        int status = 0;
+        pid_t pid = waitpid(-1, &status, WNOHANG);
+        if (pid > 0) {
+            int index = impl_->findSlotByPid(pid);
+            if (index < 0) {
+                continue;
+            }
+            impl_->slots[index].pid.store(0);
+
+            if (impl_->stop_requested.load()) {
+                break;
+            }
+
+            if (WIFSIGNALED(status)) {
+                std::cerr << "[WorkerPool] worker " << index << " (pid " << pid
+                          << ") killed by signal " << WTERMSIG(status) << ", restarting" << std::endl;
+            } else {
+                std::cerr << "[WorkerPool] worker " << index << " (pid " << pid
+                          << ") exited with status " << WEXITSTATUS(status) << ", restarting" << std::endl;
+            }
+            restart_at[index] = Clock::now() + restart_delay;
+            continue;  // 先回收其他已退出的进程
+        }
+
+        // 每轮检查空槽位: fork 失败的槽位间隔 restart_delay_ms 后重试, 不会一直空着
+        const auto now = Clock::now();
+        for (int i = 0; i < impl_->num_workers; ++i) {
+            if (impl_->slots[i].pid.load() != 0 || now < restart_at[i]) {
+                continue;
+            }
+            if (impl_->spawnWorker(i)) {
+                impl_->slots[i].restarts.fetch_add(1);
+            } else {
+                std::cerr << "[WorkerPool] worker " << i << " restart failed, retrying in "
+                          << impl_->pool_config.restart_delay_ms << " ms" << std::endl;
+                restart_at[i] = now + restart_delay;
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    impl_->release();
+}
+
+void TtsWorkerPool::Stop() {
+    impl_->stop_requested.store(true);
+}
+
+bool TtsWorkerPool::IsRunning() const {
+    return impl_->running.load();
+}
+
+int TtsWorkerPool::GetNumWorkers() const {
+    return impl_->num_workers;
+}
+
+std::vector<WorkerStats> TtsWorkerPool::GetStats() const {
+    std::vector<WorkerStats> stats;
+    if (!impl_->slots) {
+        return stats;
+    }
+    for (const auto& w : impl_->collectWireStats()) {
+        WorkerStats s;
+        s.index = w.index;
+        s.pid = w.pid;
+        s.alive = w.alive != 0;
+        s.restarts = w.restarts;
+        s.requests = w.requests;
+        s.failures = w.failures;
+        s.audio_ms = w.audio_ms;
+        s.busy_ms = w.busy_ms;
+        s.text_bytes = w.text_bytes;
+        s.last_active_ms = w.last_active_ms;
+        stats.push_back(s);
+    }
+    return stats;
+}
+
+}  // namespace Evo
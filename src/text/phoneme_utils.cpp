@@ -1,5 +1,11 @@
 #include "internal/text/phoneme_utils.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -60,5 +66,86 @@ std::string convertToGruutEnUs(const std::string& ipa) {
     return text;
 }
 
+// =============================================================================
+// espeak-ng G2P
+// =============================================================================
+
+bool isEspeakNgAvailable() {
+    std::string command = "echo 'test' | espeak-ng -q --ipa=3 2>/dev/null";
+
+    std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(command.c_str(), "r"), pclose);
+    if (!pipe) {
+        return false;
+    }
+
+    char buffer[128];
+    std::string result;
+    if (fgets(buffer, sizeof(buffer), pipe.get()) != nullptr) {
+        result += buffer;
+    }
+
+    int exit_status = pclose(pipe.release());
+    return exit_status == 0 && !result.empty();
+}
+
+std::string espeakToIpa(const std::string& text, const std::string& voice, int ipa_mode) {
+    if (text.empty()) {
+        return "";
+    }
+
+    // 语音名来自配置文件, 只允许字母、数字与 -_+ 以免注入 shell 命令
+    bool voice_valid = !voice.empty() && std::all_of(voice.begin(), voice.end(), [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '+';
+    });
+    if (!voice_valid) {
+        std::cerr << "Error: Invalid espeak-ng voice: '" << voice << "'" << std::endl;
+        return "";
+    }
+
+    // 转义单引号
+    std::string escaped_text = text;
+    std::string::size_type pos = 0;
+    while ((pos = escaped_text.find("'", pos)) != std::string::npos) {
+        escaped_text.replace(pos, 1, "'\"'\"'");
+        pos += 5;
+    }
+
+    std::string ipa_flag = ipa_mode > 0 ? "--ipa=" + std::to_string(ipa_mode) : "--ipa";
+    std::string command = "echo '" + escaped_text + "' | espeak-ng -q " + ipa_flag + " -v " + voice;
+
+    std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(command.c_str(), "r"), pclose);
+    if (!pipe) {
+        std::cerr << "Error: Failed to run espeak-ng command" << std::endl;
+        return "";
+    }
+
+    char buffer[4096];
+    std::string result;
+    while (fgets(buffer, sizeof(buffer), pipe.get()) != nullptr) {
+        result += buffer;
+    }
+
+    int exit_status = pclose(pipe.release());
+    if (exit_status != 0) {
+        return "";
+    }
+
+    // 清理结果 - 移除换行符和多余空白
+    result.erase(std::remove_if(result.begin(), result.end(),
+        [](char c) { return c == '\n' || c == '\r'; }), result.end());
+
+    // 替换多个连续空格为单个空格
+    static const std::regex multi_space("\\s+");
+    result = std::regex_replace(result, multi_space, " ");
+
+    // 去除首尾空白
+    size_t start = result.find_first_not_of(" \t");
+    if (start == std::string::npos) {
+        return "";
+    }
+    size_t end = result.find_last_not_of(" \t");
+    return result.substr(start, end - start + 1);
+}
+
 }  // namespace text
 }  // namespace tts
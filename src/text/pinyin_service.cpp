@@ -0,0 +1,40 @@
+#include "internal/text/pinyin_service.hpp"
+
+#include <cpp-pinyin/G2pglobal.h>
+#include <cpp-pinyin/Pinyin.h>
+
+#include <filesystem>  // NOLINT(build/c++17)
+#include <iostream>
+#include <stdexcept>
+
+#include "internal/text/frontend_context.hpp"
+
+namespace fs = std::filesystem;
+
+namespace tts {
+namespace text {
+
+std::shared_ptr<const Pinyin::Pinyin> acquirePinyinConverter(const std::string& dict_dir) {
+    static SharedResourceCache<Pinyin::Pinyin> cache;
+
+    std::error_code ec;
+    std::string key = fs::weakly_canonical(fs::path(dict_dir), ec).string();
+    if (ec || key.empty()) {
+        key = dict_dir;
+    }
+
+    // 加载在缓存锁内进行: 词典路径是 cpp-pinyin 的全局状态，设置路径与构造
+    // 转换器必须串行，且同一目录并发获取时只加载一次
+    return cache.get(key, [&]() -> std::shared_ptr<const Pinyin::Pinyin> {
+        if (!fs::is_directory(dict_dir)) {
+            throw std::runtime_error("cpp-pinyin dictionary not found: " + dict_dir);
+        }
+        Pinyin::setDictionaryPath(fs::path(dict_dir));
+        auto converter = std::make_shared<const Pinyin::Pinyin>();
+        std::cout << "cpp-pinyin dictionary loaded from: " << dict_dir << std::endl;
+        return converter;
+    });
+}
+
+}  // namespace text
+}  // namespace tts
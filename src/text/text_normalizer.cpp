@@ -163,7 +163,7 @@ TextNormalizer::~TextNormalizer() {}
 // 主入口
 // =============================================================================
 
-std::string TextNormalizer::normalize(const std::string& text, Language lang) {
+std::string TextNormalizer::normalize(const std::string& text, Language lang) const {
     if (text.empty()) return text;
 
     Language effective_lang = (lang == Language::AUTO) ? default_lang_ : lang;
@@ -191,7 +191,7 @@ void TextNormalizer::setDefaultLanguage(Language lang) {
 // 公式规范化
 // =============================================================================
 
-std::string TextNormalizer::normalizeFormulas(const std::string& text, Language lang) {
+std::string TextNormalizer::normalizeFormulas(const std::string& text, Language lang) const {
     std::string result;
     auto chars = splitUtf8(text);
 
@@ -256,9 +256,9 @@ std::string TextNormalizer::normalizeFormulas(const std::string& text, Language
 // 数字规范化
 // =============================================================================
 
-std::string TextNormalizer::normalizeNumbers(const std::string& text, Language lang) {
+std::string TextNormalizer::normalizeNumbers(const std::string& text, Language lang) const {
     // 正则匹配数字 (整数、小数、科学计数法)
-    std::regex num_regex(R"((\d+\.?\d*(?:[eE][+-]?\d+)?))");
+    static const std::regex num_regex(R"((\d+\.?\d*(?:[eE][+-]?\d+)?))");
 
     std::string result;
     std::sregex_iterator it(text.begin(), text.end(), num_regex);
@@ -337,7 +337,7 @@ std::string TextNormalizer::normalizeNumbers(const std::string& text, Language l
 // 货币规范化
 // =============================================================================
 
-std::string TextNormalizer::normalizeCurrency(const std::string& text, Language lang) {
+std::string TextNormalizer::normalizeCurrency(const std::string& text, Language lang) const {
     std::string result;
     auto chars = splitUtf8(text);
 
@@ -393,7 +393,7 @@ std::string TextNormalizer::normalizeCurrency(const std::string& text, Language
     }
 
     // 处理货币后缀 (如 "100元", "50块")
-    std::regex currency_suffix_regex(R"((\d+(?:\.\d+)?)\s*(元|块|块钱|美元|美金|人民币))");
+    static const std::regex currency_suffix_regex(R"((\d+(?:\.\d+)?)\s*(元|块|块钱|美元|美金|人民币))");
     std::smatch match;
     std::string temp = result;
     result.clear();
@@ -442,11 +442,11 @@ std::string TextNormalizer::normalizeCurrency(const std::string& text, Language
 // 日期时间规范化
 // =============================================================================
 
-std::string TextNormalizer::normalizeDateTime(const std::string& text, Language lang) {
+std::string TextNormalizer::normalizeDateTime(const std::string& text, Language lang) const {
     std::string result = text;
 
     // 匹配日期格式: YYYY-MM-DD 或 YYYY/MM/DD 或 YYYY年MM月DD日
-    std::regex date_regex(R"((\d{4})[-/年](\d{1,2})[-/月](\d{1,2})日?)");
+    static const std::regex date_regex(R"((\d{4})[-/年](\d{1,2})[-/月](\d{1,2})日?)");
     std::smatch match;
     std::string temp;
     std::sregex_iterator it(result.begin(), result.end(), date_regex);
@@ -482,7 +482,7 @@ std::string TextNormalizer::normalizeDateTime(const std::string& text, Language
     result = temp;
 
     // 匹配时间格式: HH:MM 或 HH:MM:SS
-    std::regex time_regex(R"((\d{1,2}):(\d{2})(?::(\d{2}))?)");
+    static const std::regex time_regex(R"((\d{1,2}):(\d{2})(?::(\d{2}))?)");
     temp.clear();
     it = std::sregex_iterator(result.begin(), result.end(), time_regex);
     last_pos = 0;
@@ -530,7 +530,7 @@ std::string TextNormalizer::normalizeDateTime(const std::string& text, Language
     result = temp;
 
     // 匹配年份格式: N年 (4位数字+年)
-    std::regex year_regex(R"((\d{4})年)");
+    static const std::regex year_regex(R"((\d{4})年)");
     temp.clear();
     it = std::sregex_iterator(result.begin(), result.end(), year_regex);
     last_pos = 0;
@@ -556,20 +556,35 @@ std::string TextNormalizer::normalizeDateTime(const std::string& text, Language
 // 单位规范化
 // =============================================================================
 
-std::string TextNormalizer::normalizeUnits(const std::string& text, Language lang) {
+namespace {
+
+using UnitPattern = std::pair<std::regex, std::pair<std::string, std::string>>;
+
+// 数字+单位正则, 按单位长度从长到短排序 (避免短单位先匹配), 只编译一次
+const std::vector<UnitPattern>& unitPatterns() {
+    static const std::vector<UnitPattern> patterns = [] {
+        std::vector<std::pair<std::string, std::pair<std::string, std::string>>> sorted_units(
+            UNITS.begin(), UNITS.end());
+        std::sort(sorted_units.begin(), sorted_units.end(),
+            [](const auto& a, const auto& b) {
+                return a.first.length() > b.first.length();
+            });
+
+        std::vector<UnitPattern> result;
+        for (const auto& [unit, names] : sorted_units) {
+            result.emplace_back(std::regex("(\\d+\\.?\\d*)" + std::string("(") + unit + ")"), names);
+        }
+        return result;
+    }();
+    return patterns;
+}
+
+}  // namespace
+
+std::string TextNormalizer::normalizeUnits(const std::string& text, Language lang) const {
     std::string result = text;
 
-    // 按单位长度从长到短排序，避免短单位先匹配
-    std::vector<std::pair<std::string, std::pair<std::string, std::string>>> sorted_units(
-        UNITS.begin(), UNITS.end());
-    std::sort(sorted_units.begin(), sorted_units.end(),
-        [](const auto& a, const auto& b) {
-            return a.first.length() > b.first.length();
-        });
-
-    for (const auto& [unit, names] : sorted_units) {
-        // 匹配数字+单位
-        std::regex unit_regex("(\\d+\\.?\\d*)" + std::string("(") + unit + ")");
+    for (const auto& [unit_regex, names] : unitPatterns()) {
         std::string temp;
         std::smatch match;
         std::sregex_iterator it(result.begin(), result.end(), unit_regex);
@@ -610,12 +625,12 @@ std::string TextNormalizer::normalizeUnits(const std::string& text, Language lan
 // 电话号码规范化
 // =============================================================================
 
-std::string TextNormalizer::normalizePhoneNumbers(const std::string& text, Language lang) {
+std::string TextNormalizer::normalizePhoneNumbers(const std::string& text, Language lang) const {
     // 匹配电话号码格式
     // - 11位数字 (如 13812345678)
     // - 带分隔符 (如 138-1234-5678, 138 1234 5678)
     // - 固话 (如 021-12345678, 010-12345678)
-    std::regex phone_regex(
+    static const std::regex phone_regex(
         R"(\b(1[3-9]\d{9})\b)"
         R"(|\b(1[3-9]\d[-\s]?\d{4}[-\s]?\d{4})\b)"
         R"(|\b(\d{3,4}[-\s]?\d{7,8})\b)");
@@ -654,8 +669,8 @@ std::string TextNormalizer::normalizePhoneNumbers(const std::string& text, Langu
 // 百分比规范化
 // =============================================================================
 
-std::string TextNormalizer::normalizePercentages(const std::string& text, Language lang) {
-    std::regex percent_regex(R"((\d+\.?\d*)%)");
+std::string TextNormalizer::normalizePercentages(const std::string& text, Language lang) const {
+    static const std::regex percent_regex(R"((\d+\.?\d*)%)");
 
     std::string result;
     std::sregex_iterator it(text.begin(), text.end(), percent_regex);
@@ -1035,7 +1050,7 @@ bool TextNormalizer::isDate(const std::string& text, size_t pos) const {
     if (pos + 10 > text.length()) return false;
 
     std::string substr = text.substr(pos, 10);
-    std::regex date_regex(R"(\d{4}[-/]\d{2}[-/]\d{2})");
+    static const std::regex date_regex(R"(\d{4}[-/]\d{2}[-/]\d{2})");
     return std::regex_match(substr, date_regex);
 }
 
@@ -1044,7 +1059,7 @@ bool TextNormalizer::isTime(const std::string& text, size_t pos) const {
     if (pos + 5 > text.length()) return false;
 
     std::string substr = text.substr(pos, 8);
-    std::regex time_regex(R"(\d{1,2}:\d{2}(:\d{2})?)");
+    static const std::regex time_regex(R"(\d{1,2}:\d{2}(:\d{2})?)");
     return std::regex_match(substr, time_regex);
 }
 
@@ -1057,7 +1072,7 @@ bool TextNormalizer::isPercentage(const std::string& text, size_t pos, size_t le
 
 bool TextNormalizer::isScore(const std::string& text, size_t pos) const {
     // 检查 N:N 格式
-    std::regex score_regex(R"(\d+:\d+)");
+    static const std::regex score_regex(R"(\d+:\d+)");
     std::smatch match;
     std::string substr = text.substr(pos);
     return std::regex_search(substr, match, score_regex) && match.position() == 0;
@@ -1065,18 +1080,176 @@ bool TextNormalizer::isScore(const std::string& text, size_t pos) const {
 
 bool TextNormalizer::isRange(const std::string& text, size_t pos) const {
     // 检查 N-N 格式
-    std::regex range_regex(R"(\d+-\d+)");
+    static const std::regex range_regex(R"(\d+-\d+)");
     std::smatch match;
     std::string substr = text.substr(pos);
     return std::regex_search(substr, match, range_regex) && match.position() == 0;
 }
 
+// =============================================================================
+// StreamingTextNormalizer
+// =============================================================================
+
+namespace {
+
+// 数字内部的连接符: 后面再跟数字时与前面的数字构成同一个记号
+// (小数、千位分隔、时间/比分、范围/电话/日期、分数、中文日期)
+bool isNumberConnector(const std::string& ch) {
+    return ch == "." || ch == "," || ch == ":" || ch == "-" || ch == "/" ||
+           ch == " " || ch == "年" || ch == "月";
+}
+
+// 可能出现在数字之前并改变其读法的字符 (货币符号、负号)
+bool isNumberPrefix(const std::string& ch) {
+    return CURRENCY_SYMBOLS.count(ch) > 0 || ch == "-" || ch == "−" || ch == "+";
+}
+
+// 数字后的文本是否仍可能继续构成同一记号
+bool canContinueNumber(const std::string& tail) {
+    size_t start = tail.find_first_not_of(' ');
+    if (start == std::string::npos) {
+        return true;  // 空或只有空格 (如 "100 " 之后可能是 "元")
+    }
+    std::string rest = tail.substr(start);
+
+    // 单个连接符 ("3." / "14:" / "2024年") 或科学计数法 ("1e" / "1e-")
+    if (start == 0 && isNumberConnector(rest)) {
+        return true;
+    }
+    if (start == 0 && (rest == "e" || rest == "E" || rest == "e+" || rest == "e-" ||
+                       rest == "E+" || rest == "E-")) {
+        return true;
+    }
+
+    // 是否为某个更长单位/货币后缀的前缀 ("k" -> "km", "km" -> "km/h", "块" -> "块钱")
+    auto extendsKey = [&rest](const std::string& key) {
+        return key.size() > rest.size() && key.compare(0, rest.size(), rest) == 0;
+    };
+    if (start == 0) {
+        for (const auto& entry : UNITS) {
+            if (extendsKey(entry.first)) return true;
+        }
+    }
+    for (const auto& entry : CURRENCY_SUFFIXES) {
+        if (extendsKey(entry.first)) return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+StreamingTextNormalizer::StreamingTextNormalizer(Language lang) : lang_(lang) {}
+
+size_t StreamingTextNormalizer::stablePrefixLength(const std::vector<std::string>& chars) const {
+    const size_t n = chars.size();
+
+    // 末尾的货币符号 / 负号: 后面可能紧跟数字
+    size_t prefix_run = 0;
+    while (prefix_run < n && isNumberPrefix(chars[n - 1 - prefix_run])) {
+        prefix_run++;
+    }
+
+    size_t last_digit = n;
+    for (size_t i = n; i > 0; --i) {
+        if (isDigit(chars[i - 1])) {
+            last_digit = i - 1;
+            break;
+        }
+    }
+    if (last_digit == n) {
+        return n - prefix_run;
+    }
+
+    std::string tail;
+    for (size_t i = last_digit + 1; i < n; ++i) {
+        tail += chars[i];
+    }
+    if (!canContinueNumber(tail)) {
+        return n - prefix_run;
+    }
+
+    // 数字可能继续: 向前找到整个数字记号的起点 (含连接符与前缀符号)
+    size_t start = last_digit;
+    while (start > 0) {
+        if (isDigit(chars[start - 1])) {
+            start--;
+        } else if (start > 1 && isNumberConnector(chars[start - 1]) && isDigit(chars[start - 2])) {
+            start -= 2;
+        } else {
+            break;
+        }
+    }
+    if (start > 0 && isNumberPrefix(chars[start - 1])) {
+        start--;
+    }
+    return start;
+}
+
+std::string StreamingTextNormalizer::push(const std::string& fragment) {
+    pending_ += fragment;
+
+    size_t complete = completeUtf8Length(pending_);
+    auto chars = splitUtf8(pending_.substr(0, complete));
+    size_t stable = stablePrefixLength(chars);
+    if (stable == 0) {
+        return "";
+    }
+
+    std::string committed;
+    for (size_t i = 0; i < stable; ++i) {
+        committed += chars[i];
+    }
+    pending_.erase(0, committed.size());
+    return normalizeCommitted(committed);
+}
+
+std::string StreamingTextNormalizer::flush() {
+    std::string remaining;
+    remaining.swap(pending_);
+    return normalizeCommitted(remaining);
+}
+
+void StreamingTextNormalizer::reset() {
+    pending_.clear();
+    context_.clear();
+}
+
+std::string StreamingTextNormalizer::normalizeCommitted(const std::string& text) {
+    if (text.empty()) {
+        return text;
+    }
+
+    // 带上已输出文本的末尾一起规范化, 再去掉上下文自身的结果;
+    // 上下文的结果受新文本影响 (不再是前缀) 时退回单独规范化
+    std::string result;
+    bool with_context = false;
+    if (!context_.empty()) {
+        const std::string context_only = normalizer_.normalize(context_, lang_);
+        std::string combined = normalizer_.normalize(context_ + text, lang_);
+        if (combined.compare(0, context_only.size(), context_only) == 0) {
+            result = combined.substr(context_only.size());
+            with_context = true;
+        }
+    }
+    if (!with_context) {
+        result = normalizer_.normalize(text, lang_);
+    }
+
+    auto chars = splitUtf8(context_ + text);
+    const size_t keep = std::min(chars.size(), kContextChars);
+    context_.clear();
+    for (size_t i = chars.size() - keep; i < chars.size(); ++i) {
+        context_ += chars[i];
+    }
+    return result;
+}
+
 // =============================================================================
 // 便捷函数
 // =============================================================================
 
 std::string normalizeText(const std::string& text, Language lang) {
-    static TextNormalizer normalizer;
+    static const TextNormalizer normalizer;
     return normalizer.normalize(text, lang);
 }
 
@@ -39,6 +39,30 @@ std::vector<std::string> splitUtf8(const std::string& str) {
     return result;
 }
 
+size_t utf8Length(const std::string& str) {
+    size_t length = 0;
+    for (unsigned char c : str) {
+        if ((c & 0xC0) != 0x80) {
+            ++length;
+        }
+    }
+    return length;
+}
+
+size_t completeUtf8Length(const std::string& str) {
+    const size_t n = str.size();
+    for (size_t back = 1; back <= 4 && back <= n; ++back) {
+        unsigned char c = static_cast<unsigned char>(str[n - back]);
+        if ((c & 0xC0) == 0x80) {
+            continue;  // 后续字节
+        }
+        size_t len = (c & 0x80) == 0 ? 1 : (c & 0xE0) == 0xC0 ? 2 :
+                     (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 1;
+        return back < len ? n - back : n;
+    }
+    return n;
+}
+
 // =============================================================================
 // 字符类型判断
 // =============================================================================
@@ -142,5 +166,124 @@ std::string mapPunctuation(const std::string& punct,
     return "";  // No mapping found
 }
 
+// =============================================================================
+// 分句
+// =============================================================================
+
+std::vector<std::string> splitSentences(const std::string& text) {
+    static const std::unordered_set<std::string> terminators = {
+        "。", "！", "？", "；", "…", "!", "?", ";", "\n"
+    };
+    static const std::unordered_set<std::string> closers = {
+        "”", "’", "」", "』", "）", ")", "\"", "'", "】", "》"
+    };
+
+    auto trim = [](const std::string& s) {
+        size_t begin = s.find_first_not_of(" \t\r\n");
+        if (begin == std::string::npos) {
+            return std::string();
+        }
+        size_t end = s.find_last_not_of(" \t\r\n");
+        return s.substr(begin, end - begin + 1);
+    };
+
+    std::vector<std::string> sentences;
+    auto flush = [&](const std::string& current) {
+        std::string sentence = trim(current);
+        if (sentence.empty()) {
+            return;
+        }
+        // 只含标点的片段 (如 "……" 或单独的引号) 没有可朗读内容, 并入前一句
+        bool has_content = false;
+        for (const auto& ch : splitUtf8(sentence)) {
+            if (!isPunctuation(ch) && !closers.count(ch) && !terminators.count(ch) &&
+                ch != " " && ch != "\t") {
+                has_content = true;
+                break;
+            }
+        }
+        if (!has_content && !sentences.empty()) {
+            sentences.back() += sentence;
+        } else {
+            sentences.push_back(sentence);
+        }
+    };
+
+    const std::vector<std::string> chars = splitUtf8(text);
+    std::string current;
+    for (size_t i = 0; i < chars.size(); ++i) {
+        const std::string& ch = chars[i];
+        current += ch;
+
+        bool is_end = terminators.count(ch) > 0;
+        if (ch == ".") {
+            is_end = (i + 1 == chars.size()) || chars[i + 1] == " " ||
+                     chars[i + 1] == "\n" || chars[i + 1] == "\t";
+        }
+        if (!is_end) {
+            continue;
+        }
+
+        // 连续的句末标点 ("！？"、"...") 与随后的右引号/括号归入本句
+        while (i + 1 < chars.size() &&
+               (terminators.count(chars[i + 1]) || closers.count(chars[i + 1]) || chars[i + 1] == ".") &&
+               chars[i + 1] != "\n") {
+            current += chars[++i];
+        }
+        flush(current);
+        current.clear();
+    }
+    flush(current);
+
+    return sentences;
+}
+
+std::vector<size_t> findSentenceEnds(const std::string& text, bool at_eof) {
+    static const std::unordered_set<std::string> terminators = {
+        "。", "！", "？", "；", "…", "!", "?", ";", "\n"
+    };
+    static const std::unordered_set<std::string> closers = {
+        "”", "’", "」", "』", "）", ")", "\"", "'", "】", "》"
+    };
+
+    // 只在完整的 UTF-8 字符上判断, 截断的尾部字符留给下一块
+    const std::vector<std::string> chars = splitUtf8(text.substr(0, completeUtf8Length(text)));
+
+    std::vector<size_t> ends;
+    size_t pos = 0;
+    for (size_t i = 0; i < chars.size(); ++i) {
+        const std::string& ch = chars[i];
+        pos += ch.size();
+
+        bool is_end = terminators.count(ch) > 0;
+        if (ch == ".") {
+            if (i + 1 == chars.size()) {
+                is_end = at_eof;
+            } else {
+                is_end = chars[i + 1] == " " || chars[i + 1] == "\n" || chars[i + 1] == "\t";
+            }
+        }
+        if (!is_end) {
+            continue;
+        }
+
+        while (i + 1 < chars.size() &&
+               (terminators.count(chars[i + 1]) || closers.count(chars[i + 1]) || chars[i + 1] == ".") &&
+               chars[i + 1] != "\n") {
+            pos += chars[++i].size();
+        }
+        // 句末标点后紧接块尾: 可能还有右引号或后续标点, 等待下一块
+        if (i + 1 == chars.size() && !at_eof) {
+            break;
+        }
+        ends.push_back(pos);
+    }
+
+    if (at_eof && !text.empty() && (ends.empty() || ends.back() < text.size())) {
+        ends.push_back(text.size());
+    }
+    return ends;
+}
+
 }  // namespace text
 }  // namespace tts
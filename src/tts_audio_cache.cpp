@@ -0,0 +1,319 @@
+#include "internal/tts_audio_cache.hpp"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <system_error>
+#include <utility>
+
+namespace fs = std::filesystem;
+
+namespace tts {
+
+namespace {
+
+// 磁盘文件格式: magic | version | sample_rate | key 长度 | key | 样本数 | float 样本
+constexpr char kFileMagic[4] = {'E', 'V', 'A', 'C'};
+constexpr uint32_t kFileVersion = 1;
+
+// FNV-1a 64 位哈希, 用作文件名
+uint64_t hashKey(const std::string& key) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string trim(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin, end - begin + 1);
+}
+
+}  // namespace
+
+// =============================================================================
+// 构造
+// =============================================================================
+
+AudioCache::AudioCache(const AudioCacheConfig& config)
+    : config_(config) {
+    if (!config_.disk_dir.empty()) {
+        std::error_code ec;
+        fs::create_directories(config_.disk_dir, ec);
+        if (ec) {
+            std::cerr << "[AudioCache] Failed to create cache directory " << config_.disk_dir
+                      << ": " << ec.message() << ", disk tier disabled" << std::endl;
+            config_.disk_dir.clear();
+        }
+    }
+}
+
+// =============================================================================
+// 查找与写入
+// =============================================================================
+
+AudioCache::Source AudioCache::lookup(const std::string& key, AudioChunk& audio) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second);
+            audio.samples = it->second->samples;
+            audio.sample_rate = it->second->sample_rate;
+            return Source::MEMORY;
+        }
+    }
+
+    if (config_.disk_dir.empty()) {
+        return Source::MISS;
+    }
+
+    // 磁盘读取不持锁, 并发读同一条目时后写入的覆盖前者, 内容相同
+    Entry entry;
+    if (!readFromDisk(key, entry)) {
+        return Source::MISS;
+    }
+    audio.samples = entry.samples;
+    audio.sample_rate = entry.sample_rate;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertLocked(std::move(entry));
+    return Source::DISK;
+}
+
+void AudioCache::insert(const std::string& key, const AudioChunk& audio) {
+    if (audio.isEmpty()) {
+        return;
+    }
+
+    Entry entry;
+    entry.key = key;
+    entry.samples = audio.samples;
+    entry.sample_rate = audio.sample_rate;
+
+    if (!config_.disk_dir.empty()) {
+        writeToDisk(entry);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertLocked(std::move(entry));
+}
+
+size_t AudioCache::memoryBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_;
+}
+
+size_t AudioCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
+
+void AudioCache::insertLocked(Entry entry) {
+    // 超过整个预算的条目不进入内存层 (磁盘层仍保留)
+    if (entry.bytes() > config_.max_bytes) {
+        return;
+    }
+
+    auto it = index_.find(entry.key);
+    if (it != index_.end()) {
+        bytes_ -= it->second->bytes();
+        lru_.erase(it->second);
+        index_.erase(it);
+    }
+
+    bytes_ += entry.bytes();
+    lru_.push_front(std::move(entry));
+    index_[lru_.front().key] = lru_.begin();
+
+    while (bytes_ > config_.max_bytes && !lru_.empty()) {
+        auto& victim = lru_.back();
+        bytes_ -= victim.bytes();
+        index_.erase(victim.key);
+        lru_.pop_back();
+    }
+}
+
+// =============================================================================
+// 磁盘层
+// =============================================================================
+
+std::string AudioCache::diskPath(const std::string& key) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.pcm",
+                  static_cast<unsigned long long>(hashKey(key)));
+    return (fs::path(config_.disk_dir) / name).string();
+}
+
+bool AudioCache::readFromDisk(const std::string& key, Entry& entry) const {
+    std::ifstream file(diskPath(key), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version = 0;
+    int32_t sample_rate = 0;
+    uint32_t key_size = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&sample_rate), sizeof(sample_rate));
+    file.read(reinterpret_cast<char*>(&key_size), sizeof(key_size));
+    if (!file || std::string(magic, 4) != std::string(kFileMagic, 4) ||
+        version != kFileVersion || key_size != key.size()) {
+        return false;
+    }
+
+    // 校验完整键, 排除哈希冲突
+    std::string stored_key(key_size, '\0');
+    file.read(&stored_key[0], key_size);
+    if (!file || stored_key != key) {
+        return false;
+    }
+
+    uint64_t num_samples = 0;
+    file.read(reinterpret_cast<char*>(&num_samples), sizeof(num_samples));
+    if (!file || num_samples == 0) {
+        return false;
+    }
+
+    // 样本数与文件剩余长度不符说明文件损坏
+    auto data_begin = file.tellg();
+    file.seekg(0, std::ios::end);
+    auto data_bytes = static_cast<uint64_t>(file.tellg() - data_begin);
+    file.seekg(data_begin);
+    if (data_bytes != num_samples * sizeof(float)) {
+        return false;
+    }
+
+    entry.samples.resize(static_cast<size_t>(num_samples));
+    file.read(reinterpret_cast<char*>(entry.samples.data()),
+              static_cast<std::streamsize>(num_samples * sizeof(float)));
+    if (!file) {
+        return false;
+    }
+
+    entry.key = key;
+    entry.sample_rate = sample_rate;
+    return true;
+}
+
+void AudioCache::writeToDisk(const Entry& entry) const {
+    // 先写临时文件再改名, 读方不会看到写了一半的文件; 临时文件名含进程号,
+    // 多个工作进程共用同一缓存目录时互不干扰
+    static std::atomic<uint64_t> tmp_counter{0};
+    std::string path = diskPath(entry.key);
+    std::string tmp_path = path + ".tmp" + std::to_string(getpid()) + "." +
+                           std::to_string(tmp_counter.fetch_add(1));
+
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return;
+        }
+        int32_t sample_rate = entry.sample_rate;
+        uint32_t key_size = static_cast<uint32_t>(entry.key.size());
+        uint64_t num_samples = entry.samples.size();
+        file.write(kFileMagic, sizeof(kFileMagic));
+        file.write(reinterpret_cast<const char*>(&kFileVersion), sizeof(kFileVersion));
+        file.write(reinterpret_cast<const char*>(&sample_rate), sizeof(sample_rate));
+        file.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+        file.write(entry.key.data(), key_size);
+        file.write(reinterpret_cast<const char*>(&num_samples), sizeof(num_samples));
+        file.write(reinterpret_cast<const char*>(entry.samples.data()),
+                   static_cast<std::streamsize>(num_samples * sizeof(float)));
+        if (!file) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(tmp_path, path, ec);
+    if (ec) {
+        std::remove(tmp_path.c_str());
+    }
+}
+
+// =============================================================================
+// 预加载清单
+// =============================================================================
+
+ErrorInfo loadPromptManifest(const std::string& path, std::vector<PromptEntry>& entries) {
+    entries.clear();
+
+    std::ifstream file(path);
+    if (!file) {
+        return ErrorInfo::error(ErrorCode::MODEL_NOT_FOUND, "Cannot open prompt manifest: " + path);
+    }
+
+    std::string line;
+    int line_number = 0;
+    while (std::getline(file, line)) {
+        ++line_number;
+        std::string content = trim(line);
+        if (content.empty() || content[0] == '#') {
+            continue;
+        }
+
+        // 文本与选项以 TAB 分隔
+        std::vector<std::string> fields;
+        std::stringstream ss(content);
+        std::string field;
+        while (std::getline(ss, field, '\t')) {
+            fields.push_back(trim(field));
+        }
+
+        PromptEntry entry;
+        entry.text = fields[0];
+        if (entry.text.empty()) {
+            continue;
+        }
+
+        for (size_t i = 1; i < fields.size(); ++i) {
+            if (fields[i].empty()) {
+                continue;
+            }
+            size_t eq = fields[i].find('=');
+            std::string name = eq == std::string::npos ? fields[i] : trim(fields[i].substr(0, eq));
+            std::string value = eq == std::string::npos ? "" : trim(fields[i].substr(eq + 1));
+
+            char* end = nullptr;
+            bool valid = !value.empty();
+            if (valid && name == "speed") {
+                entry.speed = std::strtof(value.c_str(), &end);
+                valid = *end == '\0' && entry.speed > 0.0f;
+            } else if (valid && name == "speaker") {
+                entry.speaker_id = static_cast<int>(std::strtol(value.c_str(), &end, 10));
+                valid = *end == '\0' && entry.speaker_id >= 0;
+            } else {
+                valid = false;
+            }
+
+            if (!valid) {
+                return ErrorInfo::error(ErrorCode::INVALID_CONFIG,
+                    "Invalid option '" + fields[i] + "' in " + path + ":" + std::to_string(line_number));
+            }
+        }
+
+        entries.push_back(std::move(entry));
+    }
+
+    return ErrorInfo::ok();
+}
+
+}  // namespace tts
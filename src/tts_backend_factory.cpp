@@ -8,6 +8,7 @@
 #include "internal/backends/matcha/matcha_en_backend.hpp"
 #include "internal/backends/matcha/matcha_zh_backend.hpp"
 #include "internal/backends/matcha/matcha_zh_en_backend.hpp"
+#include "internal/backends/piper/piper_backend.hpp"
 
 namespace tts {
 
@@ -29,9 +30,11 @@ std::unique_ptr<ITtsBackend> TtsBackendFactory::create(BackendType type) {
         case BackendType::KOKORO:
             return std::make_unique<KokoroBackend>();
 
-        case BackendType::COSYVOICE:
         case BackendType::VITS:
         case BackendType::PIPER:
+            return std::make_unique<PiperBackend>(type);
+
+        case BackendType::COSYVOICE:
         case BackendType::CUSTOM:
             // 这些后端尚未实现
             return nullptr;
@@ -47,6 +50,8 @@ bool TtsBackendFactory::isAvailable(BackendType type) {
         case BackendType::MATCHA_EN:
         case BackendType::MATCHA_ZH_EN:
         case BackendType::KOKORO:
+        case BackendType::VITS:
+        case BackendType::PIPER:
             return true;
 
         default:
@@ -59,7 +64,9 @@ std::vector<BackendType> TtsBackendFactory::getAvailableBackends() {
         BackendType::MATCHA_ZH,
         BackendType::MATCHA_EN,
         BackendType::MATCHA_ZH_EN,
-        BackendType::KOKORO
+        BackendType::KOKORO,
+        BackendType::VITS,
+        BackendType::PIPER
     };
 }
 
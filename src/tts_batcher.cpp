@@ -0,0 +1,207 @@
+#include "internal/tts_batcher.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "internal/text/text_utils.hpp"
+
+namespace tts {
+
+namespace {
+
+SynthesisResult failedResult(ErrorCode code, const std::string& message) {
+    SynthesisResult result;
+    result.success = false;
+    result.error = ErrorInfo::error(code, message);
+    return result;
+}
+
+}  // namespace
+
+// =============================================================================
+// 构造与析构
+// =============================================================================
+
+DynamicBatcher::DynamicBatcher(const BatcherConfig& config, BatchRunner runner)
+    : config_(config)
+    , runner_(std::move(runner)) {
+    config_.window_ms = std::max(config_.window_ms, 0);
+    config_.max_batch_size = std::max(config_.max_batch_size, 1);
+    config_.max_batch_chars = std::max(config_.max_batch_chars, 1);
+    last_arrival_ = Clock::now() - std::chrono::milliseconds(config_.window_ms + 1);
+    thread_ = std::thread(&DynamicBatcher::dispatchLoop, this);
+}
+
+DynamicBatcher::~DynamicBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+// =============================================================================
+// 提交请求
+// =============================================================================
+
+SynthesisResult DynamicBatcher::submit(const std::string& text, int speaker_id, float speed) {
+    auto request = std::make_shared<Request>();
+    request->text = text;
+    request->speaker_id = speaker_id;
+    request->speed = speed;
+    request->length = text::utf8Length(text);
+    request->arrival = Clock::now();
+    auto future = request->promise.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_) {
+            return failedResult(ErrorCode::INTERNAL_ERROR, "Batcher stopped");
+        }
+        // 没有在途批次、没有排队请求、最近一个窗口内也无其他请求: 视为空闲, 立即执行
+        request->immediate = !busy_ && queue_.empty() &&
+            request->arrival - last_arrival_ > std::chrono::milliseconds(config_.window_ms);
+        last_arrival_ = request->arrival;
+        queue_.push_back(request);
+    }
+    cv_.notify_all();
+
+    return future.get();
+}
+
+// =============================================================================
+// 调度线程
+// =============================================================================
+
+void DynamicBatcher::dispatchLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+        if (stop_) {
+            break;
+        }
+
+        // 窗口从队首请求的到达时间算起; 上一批执行期间积累的请求通常已超过窗口
+        auto head = queue_.front();
+        if (!head->immediate && !batchReady()) {
+            auto deadline = head->arrival + std::chrono::milliseconds(config_.window_ms);
+            cv_.wait_until(lock, deadline, [this]() { return stop_ || batchReady(); });
+            if (stop_) {
+                break;
+            }
+        }
+
+        auto batch = takeBatch();
+        busy_ = true;
+        lock.unlock();
+        runBatch(batch);
+        lock.lock();
+        busy_ = false;
+    }
+
+    // 停止时未执行的请求直接失败返回
+    for (auto& request : queue_) {
+        request->promise.set_value(failedResult(ErrorCode::INTERNAL_ERROR, "Batcher stopped"));
+    }
+    queue_.clear();
+}
+
+bool DynamicBatcher::batchReady() const {
+    if (queue_.size() >= static_cast<size_t>(config_.max_batch_size)) {
+        return true;
+    }
+    size_t max_length = 0;
+    for (const auto& request : queue_) {
+        max_length = std::max(max_length, request->length);
+    }
+    return max_length * queue_.size() >= static_cast<size_t>(config_.max_batch_chars);
+}
+
+std::vector<std::shared_ptr<DynamicBatcher::Request>> DynamicBatcher::takeBatch() {
+    // 队首请求总是入批 (保证先到先服务), 其余按与其长度的差距从小到大挑选,
+    // 长度相差超过一倍的不合并, 避免短请求为填充付出过多计算; 语速不同的不能同批推理
+    std::vector<std::shared_ptr<Request>> batch;
+    batch.push_back(queue_.front());
+    queue_.pop_front();
+
+    const size_t head_length = std::max<size_t>(batch.front()->length, 1);
+    std::vector<size_t> candidates(queue_.size());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        candidates[i] = i;
+    }
+    auto distance = [&](size_t i) {
+        size_t length = queue_[i]->length;
+        return length > head_length ? length - head_length : head_length - length;
+    };
+    std::stable_sort(candidates.begin(), candidates.end(),
+        [&](size_t a, size_t b) { return distance(a) < distance(b); });
+
+    size_t max_length = head_length;
+    std::vector<bool> taken(queue_.size(), false);
+    for (size_t i : candidates) {
+        if (batch.size() >= static_cast<size_t>(config_.max_batch_size)) {
+            break;
+        }
+        size_t length = std::max<size_t>(queue_[i]->length, 1);
+        if (queue_[i]->speed != batch.front()->speed ||
+            length > head_length * 2 || head_length > length * 2) {
+            continue;
+        }
+        size_t new_max = std::max(max_length, length);
+        if (new_max * (batch.size() + 1) > static_cast<size_t>(config_.max_batch_chars)) {
+            continue;
+        }
+        max_length = new_max;
+        taken[i] = true;
+        batch.push_back(queue_[i]);
+    }
+
+    // 未入批的请求保持原有顺序
+    std::deque<std::shared_ptr<Request>> remaining;
+    for (size_t i = 0; i < queue_.size(); ++i) {
+        if (!taken[i]) {
+            remaining.push_back(std::move(queue_[i]));
+        }
+    }
+    queue_.swap(remaining);
+
+    return batch;
+}
+
+void DynamicBatcher::runBatch(const std::vector<std::shared_ptr<Request>>& batch) {
+    std::vector<std::string> texts;
+    std::vector<int> speaker_ids;
+    texts.reserve(batch.size());
+    speaker_ids.reserve(batch.size());
+    for (const auto& request : batch) {
+        texts.push_back(request->text);
+        speaker_ids.push_back(request->speaker_id);
+    }
+
+    std::vector<SynthesisResult> results;
+    std::string error_message;
+    try {
+        runner_(texts, speaker_ids, batch.front()->speed, results);
+        if (results.size() != batch.size()) {
+            error_message = "Batch result count mismatch";
+        }
+    } catch (const std::exception& e) {
+        error_message = std::string("Batch synthesis failed: ") + e.what();
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (error_message.empty()) {
+            batch[i]->promise.set_value(std::move(results[i]));
+        } else {
+            batch[i]->promise.set_value(failedResult(ErrorCode::SYNTHESIS_FAILED, error_message));
+        }
+    }
+}
+
+}  // namespace tts
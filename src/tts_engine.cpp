@@ -1,16 +1,45 @@
 #include "tts_api.hpp"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <cerrno>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <istream>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "internal/backends/tts_backend.hpp"
+#include "internal/tts_audio_cache.hpp"
+#include "internal/tts_batcher.hpp"
+#include "internal/tts_fair_scheduler.hpp"
+#include "internal/tts_result_impl.hpp"
+#include "internal/tts_single_flight.hpp"
+#include "internal/text/text_utils.hpp"
+#include "tts_sink.hpp"
 
 namespace Evo {
 
@@ -18,17 +47,6 @@ namespace Evo {
 // TtsEngineResult 实现
 // =============================================================================
 
-struct TtsEngineResult::Impl {
-    std::vector<float> audio_float;
-    int sample_rate = 22050;
-    int duration_ms = 0;
-    int processing_time_ms = 0;
-    bool success = false;
-    bool is_sentence_end = false;
-    std::string message;
-    std::string request_id;
-};
-
 TtsEngineResult::TtsEngineResult() : impl_(std::make_unique<Impl>()) {}
 TtsEngineResult::~TtsEngineResult() = default;
 
@@ -60,6 +78,10 @@ std::vector<int16_t> TtsEngineResult::GetAudioInt16() const {
     return result;
 }
 
+const std::vector<float>& TtsEngineResult::GetAudioFloatRef() const {
+    return impl_->audio_float;
+}
+
 std::string TtsEngineResult::GetTimestamp() const {
     return "{}";  // 未实现时间戳
 }
@@ -153,6 +175,71 @@ bool TtsEngineResult::SaveToFile(const std::string& file_path) const {
     return file.good();
 }
 
+// =============================================================================
+// CallbackAdapter - 后端音频块 -> TtsResultCallback
+// =============================================================================
+
+class CallbackAdapter : public tts::ITtsCallback {
+public:
+    explicit CallbackAdapter(std::shared_ptr<TtsResultCallback> callback)
+        : callback_(std::move(callback))
+        , start_time_(std::chrono::steady_clock::now()) {}
+
+    void onAudioChunk(const tts::AudioChunk& chunk) override {
+        auto result = std::make_shared<TtsEngineResult>();
+        result->impl_->audio_float = chunk.samples;
+        result->impl_->sample_rate = chunk.sample_rate;
+        result->impl_->duration_ms = chunk.getDurationMs();
+        result->impl_->processing_time_ms = static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start_time_).count());
+        result->impl_->success = true;
+        result->impl_->is_sentence_end = chunk.is_final;
+        callback_->OnEvent(result);
+    }
+
+    bool isCancelled() const override {
+        return callback_->IsCancelled();
+    }
+
+private:
+    std::shared_ptr<TtsResultCallback> callback_;
+    std::chrono::steady_clock::time_point start_time_;
+};
+
+// =============================================================================
+// ChunkCollector - 拼接音频块 (可转发给下游回调)
+// =============================================================================
+
+class ChunkCollector : public tts::ITtsCallback {
+public:
+    explicit ChunkCollector(tts::ITtsCallback* downstream = nullptr)
+        : downstream_(downstream) {}
+
+    void onAudioChunk(const tts::AudioChunk& chunk) override {
+        samples_.insert(samples_.end(), chunk.samples.begin(), chunk.samples.end());
+        if (chunk.sample_rate > 0) {
+            sample_rate_ = chunk.sample_rate;
+        }
+        if (downstream_) {
+            downstream_->onAudioChunk(chunk);
+        }
+    }
+
+    bool isCancelled() const override {
+        return downstream_ && downstream_->isCancelled();
+    }
+
+    tts::AudioChunk audio() const {
+        return tts::AudioChunk::fromFloat(samples_, sample_rate_, true);
+    }
+
+private:
+    tts::ITtsCallback* downstream_;
+    std::vector<float> samples_;
+    int sample_rate_ = 0;
+};
+
 // =============================================================================
 // TtsEngine 实现
 // =============================================================================
@@ -177,43 +264,1259 @@ static tts::BackendType convertBackendType(BackendType type) {
     }
 }
 
+// 把空闲内存归还系统 (glibc 不会主动收缩堆)
+static void releaseHeapToSystem() {
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+// 丢弃模型文件的页缓存, 让内核可以立即回收
+static void dropPageCache(const std::vector<std::string>& files) {
+#if defined(__linux__)
+    for (const auto& path : files) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+    }
+#else
+    (void)files;
+#endif
+}
+
+static int64_t steadyNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 模型文件的大小、修改时间与内容哈希, 用于检测文件是否被替换
+struct ModelFileStamp {
+    std::string path;
+    int64_t size = -1;
+    int64_t mtime_ns = -1;
+    uint64_t content_hash = 0;          // 首尾各 1 MB 的 FNV-1a (保留修改时间的复制也能识别)
+
+    bool operator==(const ModelFileStamp& other) const {
+        return path == other.path && size == other.size && mtime_ns == other.mtime_ns &&
+               content_hash == other.content_hash;
+    }
+};
+
+static uint64_t fnv1a(uint64_t hash, const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// 只读首尾各 1 MB: ONNX 的图结构在文件头, 权重变化通常波及文件尾; 整个文件哈希代价过高
+static uint64_t hashFileEnds(const std::string& path, int64_t size) {
+    constexpr int64_t kWindow = 1024 * 1024;
+    uint64_t hash = 1469598103934665603ULL;
+    std::ifstream file(path, std::ios::binary);
+    if (!file || size < 0) {
+        return hash;
+    }
+    std::vector<char> buffer(static_cast<size_t>(std::min(size, kWindow)));
+    auto hash_at = [&](int64_t offset) {
+        file.seekg(offset);
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        hash = fnv1a(hash, buffer.data(), static_cast<size_t>(file.gcount()));
+    };
+    hash_at(0);
+    if (size > kWindow) {
+        hash_at(std::max(size - kWindow, kWindow));
+    }
+    return hash;
+}
+
+static ModelFileStamp stampModelFile(const std::string& path) {
+    ModelFileStamp stamp;
+    stamp.path = path;
+    struct stat st;
+    if (stat(path.c_str(), &st) == 0) {
+        stamp.size = static_cast<int64_t>(st.st_size);
+#if defined(__APPLE__)
+        stamp.mtime_ns = static_cast<int64_t>(st.st_mtimespec.tv_sec) * 1000000000LL + st.st_mtimespec.tv_nsec;
+#else
+        stamp.mtime_ns = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+        stamp.content_hash = hashFileEnds(path, stamp.size);
+    }
+    return stamp;
+}
+
+// Reload 不改变的引擎级参数 (批处理、缓存、空闲策略在构造时启动)
+static void keepEngineSettings(const TtsConfig& from, TtsConfig& to) {
+    to.idle_trim_ms = from.idle_trim_ms;
+    to.idle_unload_ms = from.idle_unload_ms;
+    to.batch_window_ms = from.batch_window_ms;
+    to.max_batch_size = from.max_batch_size;
+    to.max_batch_chars = from.max_batch_chars;
+    to.coalesce_requests = from.coalesce_requests;
+    to.tenant_scheduling = from.tenant_scheduling;
+    to.cache_max_mb = from.cache_max_mb;
+    to.cache_dir = from.cache_dir;
+    to.preload_manifest = from.preload_manifest;
+    to.preload_async = from.preload_async;
+    to.engine_tag = from.engine_tag;
+}
+
+// 长文档的分块读取: 返回读到的字节数, 0 表示结尾, -1 表示出错
+using ReadFn = std::function<int64_t(char*, size_t)>;
+
+// 读取并丢弃 count 字节 (不可定位的输入续合成时使用)
+static bool discardInput(const ReadFn& read_fn, uint64_t count) {
+    std::vector<char> buffer(64 * 1024);
+    while (count > 0) {
+        int64_t n = read_fn(buffer.data(), static_cast<size_t>(std::min<uint64_t>(count, buffer.size())));
+        if (n <= 0) {
+            return false;
+        }
+        count -= static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+// 没有句末标点的超长文本的切分点: [begin, begin + max_bytes] 内最后一个逗号/分号/空白之后,
+// 都没有时退到 UTF-8 字符边界。调用方保证 begin + max_bytes < text.size()
+static size_t findForcedSplit(const std::string& text, size_t begin, size_t max_bytes) {
+    static const char* const kBreaks[] = {"\xEF\xBC\x8C", "\xE3\x80\x81", "\xEF\xBC\x9B",  // ，、；
+                                          ",", ";", " ", "\n", "\t"};
+    const size_t limit = begin + max_bytes;
+    size_t best = 0;
+    for (const char* brk : kBreaks) {
+        const size_t len = std::strlen(brk);
+        if (limit < begin + len) {
+            continue;
+        }
+        size_t pos = text.rfind(brk, limit - len);
+        if (pos != std::string::npos && pos >= begin) {
+            best = std::max(best, pos + len);
+        }
+    }
+    if (best > begin) {
+        return best;
+    }
+
+    size_t cut = limit;
+    while (cut > begin && (static_cast<unsigned char>(text[cut]) & 0xC0) == 0x80) {
+        --cut;
+    }
+    return cut > begin ? cut : limit;
+}
+
+static bool isBlankText(const std::string& text) {
+    return text.find_first_not_of(" \t\r\n") == std::string::npos;
+}
+
 struct TtsEngine::Impl {
-    std::unique_ptr<tts::ITtsBackend> backend;
-    TtsConfig config;
+    TtsConfig config;                                   // 构造时的配置, 之后只读 (引擎级参数以此为准)
     bool initialized = false;
 
-    bool init(const TtsConfig& cfg) {
-        config = cfg;
+    // -------------------------------------------------------------------------
+    // 模型代
+    // -------------------------------------------------------------------------
+    //
+    // 一代 = 一份模型配置及由它加载的后端。请求持有当前代的引用与共享锁;
+    // 释放缓存、卸载、重新加载持有该代的独占锁。Reload 在调用线程上构建并
+    // 预热下一代, 然后原子换入: 新请求立即使用新一代, 在途请求在旧一代上
+    // 完成, 最后一个请求结束时旧一代随引用计数释放。
+    //
+    // 语速、说话人、音量保存在各代的 config 中: Set* 同时持有 mutex (独占) 与
+    // settings_mutex 修改, 持有租约或 settings_mutex 即可读取。其余字段构建后不变。
+
+    struct Generation {
+        TtsConfig config;                               // 本代的配置
+        std::unique_ptr<tts::ITtsBackend> backend;      // 卸载后为空, 下一次请求时重新加载
+        std::shared_mutex mutex;
+        mutable std::mutex settings_mutex;
+
+        // 后端信息缓存 (卸载后仍可查询)
+        std::string engine_name = "Unknown";
+        int sample_rate = 0;
+        int num_speakers = 1;
+        bool per_request_speaker = false;               // 后端可在同一会话内按请求切换说话人
+        std::string cache_prefix;                       // 影响音频的配置参数, 作为缓存键与合并键前缀
+        std::vector<ModelFileStamp> model_files;        // 首次加载时的模型文件
+
+        // 动态批处理 (batch_window_ms > 0 时启用): 每代一个, 一批只含同一代的请求。
+        // 最后声明, 析构时最先停止调度线程
+        std::unique_ptr<tts::DynamicBatcher> batcher;
+    };
+
+    /// 后端租约: 持有某一代的引用与共享锁, 租约期间该代的后端不会被释放
+    struct BackendLease {
+        std::shared_ptr<Generation> generation;
+        std::shared_lock<std::shared_mutex> lock;
+
+        bool owns_lock() const { return lock.owns_lock(); }
+        tts::ITtsBackend* operator->() const { return generation->backend.get(); }
+    };
+
+    mutable std::mutex generation_mutex;                // 保护 generation 指针
+    std::shared_ptr<Generation> generation;
+    std::mutex reload_mutex;                            // 串行化 Reload
+
+    std::shared_ptr<Generation> current() const {
+        std::lock_guard<std::mutex> lock(generation_mutex);
+        return generation;
+    }
 
-        // 创建后端
-        auto backend_type = convertBackendType(cfg.backend);
-        backend = tts::TtsBackendFactory::create(backend_type);
-        if (!backend) {
+    /// 请求开始时的快照: 缓存键、合并键与合成使用同一代、同一组参数,
+    /// 不受请求期间 Reload 与 Set* 的影响
+    struct RequestContext {
+        std::shared_ptr<Generation> generation;
+        float speed = 1.0f;
+        int speaker_id = 0;                             // 本请求的说话人
+        int default_speaker_id = 0;                     // 快照时的默认说话人
+    };
+
+    /// @param speaker_id 本请求的说话人, 负数表示默认说话人
+    RequestContext requestContext(int speaker_id = -1) const {
+        RequestContext ctx;
+        ctx.generation = current();
+        std::lock_guard<std::mutex> lock(ctx.generation->settings_mutex);
+        ctx.speed = ctx.generation->config.speech_rate;
+        ctx.default_speaker_id = ctx.generation->config.speaker_id;
+        ctx.speaker_id = speaker_id >= 0 ? speaker_id : ctx.default_speaker_id;
+        return ctx;
+    }
+
+    // -------------------------------------------------------------------------
+    // 空闲策略
+    // -------------------------------------------------------------------------
+    //
+    // 空闲线程按 idle_trim_ms / idle_unload_ms 逐级释放当前代的资源,
+    // 下一次请求 (或 Prewake) 时透明地重新加载。
+
+    std::atomic<ResidencyState> residency{ResidencyState::UNLOADED};
+    std::atomic<int64_t> last_active_ms{0};
+    std::atomic<int> active_requests{0};
+
+    std::thread idle_thread;
+    std::mutex idle_mutex;
+    std::condition_variable idle_cv;
+    bool idle_stop = false;
+    bool prewake_requested = false;
+
+    // 按租户公平调度 (tenant_scheduling 时启用)
+    std::unique_ptr<tts::FairScheduler> scheduler;
+
+    // 相同请求合并执行 (coalesce_requests 时启用)
+    tts::SingleFlight single_flight;
+
+    // -------------------------------------------------------------------------
+    // 音频缓存与预加载
+    // -------------------------------------------------------------------------
+    //
+    // cache_max_mb > 0 时启用。预加载线程逐条合成清单中的提示音写入缓存,
+    // 有实时请求在处理时暂停, 不与实时请求争抢推理资源。
+
+    std::unique_ptr<tts::AudioCache> audio_cache;
+
+    std::thread preload_thread;
+    mutable std::mutex preload_mutex;
+    std::condition_variable preload_cv;
+    bool preload_stop = false;
+    PreloadProgress preload_progress;
+
+    /// 请求作用域: 标记活跃, 阻止空闲线程在请求期间释放资源
+    struct RequestScope {
+        explicit RequestScope(Impl& impl) : impl_(impl) {
+            impl_.active_requests.fetch_add(1);
+            impl_.last_active_ms.store(steadyNowMs());
+        }
+        ~RequestScope() {
+            impl_.last_active_ms.store(steadyNowMs());
+            if (impl_.active_requests.fetch_sub(1) == 1) {
+                impl_.preload_cv.notify_all();
+            }
+        }
+        Impl& impl_;
+    };
+
+    ~Impl() {
+        stopPreload();
+        if (generation) {
+            generation->batcher.reset();
+        }
+        stopIdleThread();
+    }
+
+    static tts::TtsConfig makeInternalConfig(const TtsConfig& config) {
+        tts::TtsConfig internal_config;
+        internal_config.backend = convertBackendType(config.backend);
+        internal_config.model_dir = config.model_dir;
+        internal_config.voice = config.voice;
+        internal_config.speaker_id = config.speaker_id;
+        internal_config.speech_rate = config.speech_rate;
+        internal_config.sample_rate = config.sample_rate;
+        internal_config.target_rms = config.target_rms;
+        internal_config.compression_ratio = config.compression_ratio;
+        internal_config.use_rms_norm = config.use_rms_norm;
+        internal_config.remove_clicks = config.remove_clicks;
+        internal_config.trim_silence = config.trim_silence;
+        internal_config.silence_threshold_db = config.silence_threshold_db;
+        internal_config.sentence_gap_ms = config.sentence_gap_ms;
+        internal_config.stream_chunk_frames = config.stream_chunk_frames;
+        internal_config.frontend_lookahead = config.frontend_lookahead;
+        internal_config.token_buckets = config.token_buckets;
+        internal_config.mel_frame_buckets = config.mel_frame_buckets;
+        internal_config.vocoder_istft = config.vocoder_istft;
+        internal_config.num_threads = config.num_threads;
+        internal_config.execution_providers = config.execution_providers;
+        internal_config.provider_options = config.provider_options;
+        internal_config.enable_warmup = config.enable_warmup;
+        internal_config.model_prefetch = config.model_prefetch;
+        internal_config.model_mlock = config.model_mlock;
+        internal_config.model_huge_pages = config.model_huge_pages;
+        internal_config.shared_allocator = config.shared_allocator;
+        internal_config.arena_max_mb = config.arena_max_mb;
+        internal_config.engine_tag = config.engine_tag;
+        return internal_config;
+    }
+
+    /// 按该代的配置创建并初始化后端 (调用方持有该代的独占锁, 或该代尚未发布)
+    static bool loadBackend(Generation& gen) {
+        auto new_backend = tts::TtsBackendFactory::create(convertBackendType(gen.config.backend));
+        if (!new_backend) {
             std::cerr << "Failed to create TTS backend" << std::endl;
             return false;
         }
 
-        // 转换配置
-        tts::TtsConfig internal_config;
-        internal_config.backend = backend_type;
-        internal_config.model_dir = cfg.model_dir;
-        internal_config.voice = cfg.voice;
-        internal_config.speaker_id = cfg.speaker_id;
-        internal_config.speech_rate = cfg.speech_rate;
-        internal_config.sample_rate = cfg.sample_rate;
-        internal_config.num_threads = cfg.num_threads;
-        internal_config.enable_warmup = cfg.enable_warmup;
-
-        // 初始化
-        auto error = backend->initialize(internal_config);
+        auto error = new_backend->initialize(makeInternalConfig(gen.config));
         if (!error.isOk()) {
             std::cerr << "Failed to initialize TTS backend: " << error.message << std::endl;
             return false;
         }
 
+        gen.engine_name = new_backend->getName();
+        gen.sample_rate = new_backend->getSampleRate();
+        gen.num_speakers = new_backend->getNumSpeakers();
+        gen.per_request_speaker = new_backend->supportsPerRequestSpeaker();
+        if (gen.model_files.empty()) {
+            for (const auto& path : new_backend->getModelFiles()) {
+                gen.model_files.push_back(stampModelFile(path));
+            }
+        }
+        gen.backend = std::move(new_backend);
+        return true;
+    }
+
+    /// 创建并加载新的一代 (尚未发布, 不影响在途请求)
+    static std::shared_ptr<Generation> buildGeneration(const TtsConfig& gen_config) {
+        auto gen = std::make_shared<Generation>();
+        gen->config = gen_config;
+        if (!loadBackend(*gen)) {
+            return nullptr;
+        }
+        buildCachePrefix(*gen);
+        return gen;
+    }
+
+    bool init(const TtsConfig& cfg) {
+        config = cfg;
+        if (config.engine_tag.empty()) {
+            static std::atomic<int> engine_counter{0};
+            config.engine_tag = "engine-" + std::to_string(engine_counter.fetch_add(1));
+        }
+
+        generation = buildGeneration(config);
+        if (!generation) {
+            return false;
+        }
+
+        residency.store(ResidencyState::RESIDENT);
+        last_active_ms.store(steadyNowMs());
         initialized = true;
+
+        if (config.idle_trim_ms > 0 || config.idle_unload_ms > 0) {
+            startIdleThread();
+        }
+        if (config.batch_window_ms > 0) {
+            startBatcher(generation);
+        }
+        if (config.tenant_scheduling) {
+            // 批处理时同时放行一批句子, 由批处理器合并; 否则后端逐句执行
+            scheduler = std::make_unique<tts::FairScheduler>(
+                config.batch_window_ms > 0 ? config.max_batch_size : 1);
+        }
+
+        if (config.cache_max_mb > 0) {
+            startCache();
+        }
+        if (!config.preload_manifest.empty() && audio_cache) {
+            startPreload();
+        } else {
+            if (!config.preload_manifest.empty()) {
+                std::cerr << "[TtsEngine] preload_manifest ignored: audio cache disabled (cache_max_mb = 0)"
+                          << std::endl;
+            }
+            preload_progress.finished = true;
+        }
         return true;
     }
+
+    // -------------------------------------------------------------------------
+    // 音频缓存与预加载
+    // -------------------------------------------------------------------------
+
+    void startCache() {
+        tts::AudioCacheConfig cache_config;
+        cache_config.max_bytes = static_cast<size_t>(config.cache_max_mb) * 1024 * 1024;
+        cache_config.disk_dir = config.cache_dir;
+        audio_cache = std::make_unique<tts::AudioCache>(cache_config);
+    }
+
+    static void buildCachePrefix(Generation& gen) {
+        // 磁盘缓存跨进程、跨配置复用, 键中需包含所有影响输出音频的参数
+        const TtsConfig& c = gen.config;
+        char params[160];
+        std::snprintf(params, sizeof(params), "|%d|%.3f|%.3f|%d%d%d|%.1f|%d|",
+                      gen.sample_rate, c.target_rms, c.compression_ratio,
+                      c.use_rms_norm ? 1 : 0, c.remove_clicks ? 1 : 0,
+                      c.trim_silence ? 1 : 0, c.silence_threshold_db,
+                      c.sentence_gap_ms);
+        // 同一路径上原地替换的模型文件 (TryReloadIfChanged) 得到不同的前缀, 不会命中旧权重的音频
+        uint64_t files_hash = 1469598103934665603ULL;
+        for (const auto& stamp : gen.model_files) {
+            files_hash = fnv1a(files_hash, &stamp.size, sizeof(stamp.size));
+            files_hash = fnv1a(files_hash, &stamp.mtime_ns, sizeof(stamp.mtime_ns));
+            files_hash = fnv1a(files_hash, &stamp.content_hash, sizeof(stamp.content_hash));
+        }
+        char files[24];
+        std::snprintf(files, sizeof(files), "%016llx|", static_cast<unsigned long long>(files_hash));
+        gen.cache_prefix = std::string(tts::backendTypeToString(convertBackendType(c.backend))) +
+                           "|" + c.model + "|" + c.voice + params + files;
+    }
+
+    /// 合成方式: 流式分块解码的音频与整段合成不逐样本相同, 两者不共享缓存与合并
+    enum class SynthesisMode { OFFLINE, STREAMING };
+
+    /// 缓存键以请求所在代为前缀: Reload 换入新模型后不会命中旧模型的音频
+    static std::string cacheKey(const RequestContext& ctx, const std::string& text,
+                                SynthesisMode mode = SynthesisMode::OFFLINE) {
+        char params[48];
+        std::snprintf(params, sizeof(params), "%s%d|%.3f|",
+                      mode == SynthesisMode::STREAMING ? "stream|" : "", ctx.speaker_id, ctx.speed);
+        return ctx.generation->cache_prefix + params + text;
+    }
+
+    void startPreload() {
+        std::vector<tts::PromptEntry> entries;
+        auto error = tts::loadPromptManifest(config.preload_manifest, entries);
+        if (!error.isOk()) {
+            std::cerr << "[TtsEngine] " << error.message << std::endl;
+            preload_progress.finished = true;
+            return;
+        }
+
+        preload_progress.total = static_cast<int>(entries.size());
+        if (config.preload_async) {
+            preload_stop = false;
+            preload_thread = std::thread(&Impl::preloadLoop, this, std::move(entries));
+        } else {
+            preloadLoop(std::move(entries));
+        }
+    }
+
+    void stopPreload() {
+        {
+            std::lock_guard<std::mutex> lock(preload_mutex);
+            preload_stop = true;
+        }
+        preload_cv.notify_all();
+        if (preload_thread.joinable()) {
+            preload_thread.join();
+        }
+    }
+
+    void preloadLoop(std::vector<tts::PromptEntry> entries) {
+        auto start_time = std::chrono::steady_clock::now();
+
+        for (const auto& entry : entries) {
+            {
+                // 让位于实时请求: 有请求在处理时暂停, 最后一个请求结束时被唤醒
+                std::unique_lock<std::mutex> lock(preload_mutex);
+                while (!preload_stop && active_requests.load() > 0) {
+                    preload_cv.wait_for(lock, std::chrono::milliseconds(100));
+                }
+                if (preload_stop) {
+                    break;
+                }
+            }
+
+            bool from_cache = false;
+            bool ok = preloadEntry(entry, from_cache);
+
+            std::lock_guard<std::mutex> lock(preload_mutex);
+            ++preload_progress.completed;
+            if (!ok) {
+                ++preload_progress.failed;
+            } else if (from_cache) {
+                ++preload_progress.from_cache;
+            } else {
+                ++preload_progress.synthesized;
+            }
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time);
+        std::lock_guard<std::mutex> lock(preload_mutex);
+        preload_progress.finished = true;
+        std::cout << "[TtsEngine] Preloaded " << preload_progress.completed << "/"
+                  << preload_progress.total << " prompts in " << elapsed.count() << "ms ("
+                  << preload_progress.synthesized << " synthesized, "
+                  << preload_progress.from_cache << " cached, "
+                  << preload_progress.failed << " failed)" << std::endl;
+    }
+
+    /// 预加载一条提示音: 已在缓存 (内存或磁盘) 中则跳过, 否则合成后写入缓存
+    bool preloadEntry(const tts::PromptEntry& entry, bool& from_cache) {
+        RequestContext ctx = requestContext(entry.speaker_id);
+        if (entry.speed > 0.0f) {
+            ctx.speed = entry.speed;
+        }
+        const std::string key = cacheKey(ctx, entry.text);
+
+        tts::AudioChunk cached;
+        if (audio_cache->lookup(key, cached) != tts::AudioCache::Source::MISS) {
+            from_cache = true;
+            return true;
+        }
+
+        tts::SynthesisResult result;
+        auto error = synthesizeDirect(ctx, entry.text, result);
+        if (!error.isOk()) {
+            std::cerr << "[TtsEngine] Preload failed for \"" << entry.text << "\": "
+                      << error.message << std::endl;
+            return false;
+        }
+        audio_cache->insert(key, result.audio);
+        return true;
+    }
+
+    /// 说话人与快照时的默认说话人不同且后端不能在同一会话内按请求切换
+    static bool needsSpeakerSwitch(const RequestContext& ctx) {
+        return ctx.speaker_id != ctx.default_speaker_id && !ctx.generation->per_request_speaker;
+    }
+
+    /// 后端当前的语速与默认说话人可以直接合成该请求 (调用方持有该代的租约)
+    static bool backendMatches(const Generation& gen, float speed, int speaker_id) {
+        return gen.config.speech_rate == speed &&
+               (speaker_id == gen.config.speaker_id || gen.per_request_speaker);
+    }
+
+    /// 在请求所在代上合成; 快照之后 Set* 修改了语速或默认说话人时改为临时切换
+    tts::ErrorInfo synthesizeDirect(const RequestContext& ctx, const std::string& text,
+                                    tts::SynthesisResult& result) {
+        {
+            auto lease = acquireBackend(ctx.generation);
+            if (!lease.owns_lock()) {
+                return tts::ErrorInfo::error(tts::ErrorCode::NOT_INITIALIZED,
+                                             "Failed to reload TTS backend");
+            }
+            const Generation& gen = *lease.generation;
+            if (backendMatches(gen, ctx.speed, ctx.speaker_id)) {
+                if (ctx.speaker_id == gen.config.speaker_id) {
+                    return lease->synthesize(text, result);
+                }
+                return lease->synthesizeWithSpeaker(text, ctx.speaker_id, result);
+            }
+        }
+        return synthesizeSwitched(ctx.generation, text, ctx.speed, ctx.speaker_id, result);
+    }
+
+    /// 语速/说话人与该代的设置不同且后端不能按请求切换: 持独占锁临时切换,
+    /// 实时请求最多等待这一条
+    tts::ErrorInfo synthesizeSwitched(const std::shared_ptr<Generation>& gen, const std::string& text,
+                                      float speed, int speaker_id, tts::SynthesisResult& result) {
+        if (!reload(gen)) {
+            return tts::ErrorInfo::error(tts::ErrorCode::NOT_INITIALIZED, "Failed to reload TTS backend");
+        }
+        std::unique_lock<std::shared_mutex> lock(gen->mutex);
+        auto& backend = gen->backend;
+        if (!backend) {
+            return tts::ErrorInfo::error(tts::ErrorCode::NOT_INITIALIZED, "TTS backend unloaded");
+        }
+        const float default_speed = gen->config.speech_rate;
+        const int default_speaker_id = gen->config.speaker_id;
+        tts::ErrorInfo error = backend->setSpeed(speed);
+        if (error.isOk() && speaker_id != default_speaker_id) {
+            error = backend->setSpeaker(speaker_id);
+        }
+        if (error.isOk()) {
+            error = backend->synthesize(text, result);
+        }
+        backend->setSpeed(default_speed);
+        backend->setSpeaker(default_speaker_id);
+        return error;
+    }
+
+    // -------------------------------------------------------------------------
+    // 动态批处理
+    // -------------------------------------------------------------------------
+
+    /// 为该代创建批处理器 (该代发布之前调用)
+    void startBatcher(const std::shared_ptr<Generation>& gen) {
+        tts::BatcherConfig batcher_config;
+        batcher_config.window_ms = config.batch_window_ms;
+        batcher_config.max_batch_size = config.max_batch_size;
+        batcher_config.max_batch_chars = config.max_batch_chars;
+        // 提交者在等待结果期间持有该代的引用, 批次执行时该代必然存在
+        std::weak_ptr<Generation> weak_gen = gen;
+        gen->batcher = std::make_unique<tts::DynamicBatcher>(batcher_config,
+            [this, weak_gen](const std::vector<std::string>& texts, const std::vector<int>& speaker_ids,
+                             float speed, std::vector<tts::SynthesisResult>& results) {
+                runBatch(weak_gen.lock(), texts, speaker_ids, speed, results);
+            });
+    }
+
+    /// 批处理线程调用: 一次 synthesizeBatch 处理整批请求
+    void runBatch(const std::shared_ptr<Generation>& gen, const std::vector<std::string>& texts,
+                  const std::vector<int>& speaker_ids, float speed,
+                  std::vector<tts::SynthesisResult>& results) {
+        auto error = gen ? synthesizeBatchOn(gen, texts, speaker_ids, speed, results)
+                         : tts::ErrorInfo::error(tts::ErrorCode::NOT_INITIALIZED, "Model released");
+        if (!error.isOk()) {
+            results.assign(texts.size(), tts::SynthesisResult());
+            for (auto& result : results) {
+                result.success = false;
+                result.error = error;
+            }
+        }
+    }
+
+    /// 在指定代上以同一语速批量合成 (动态批处理与 CallMany 分组共用);
+    /// 请求快照之后 Set* 修改了语速或默认说话人时逐条临时切换。
+    /// 只有整批失败时返回错误, 单条失败记录在 results 中
+    tts::ErrorInfo synthesizeBatchOn(const std::shared_ptr<Generation>& gen,
+                                     const std::vector<std::string>& texts,
+                                     const std::vector<int>& speaker_ids, float speed,
+                                     std::vector<tts::SynthesisResult>& results) {
+        {
+            auto lease = acquireBackend(gen);
+            if (!lease.owns_lock()) {
+                return tts::ErrorInfo::error(tts::ErrorCode::NOT_INITIALIZED,
+                                             "Failed to reload TTS backend");
+            }
+            const bool matches = std::all_of(speaker_ids.begin(), speaker_ids.end(),
+                [&](int speaker_id) { return backendMatches(*gen, speed, speaker_id); });
+            if (matches) {
+                return gen->per_request_speaker ? lease->synthesizeBatch(texts, speaker_ids, results)
+                                                : lease->synthesizeBatch(texts, results);
+            }
+        }
+
+        results.assign(texts.size(), tts::SynthesisResult());
+        for (size_t i = 0; i < texts.size(); ++i) {
+            auto error = synthesizeSwitched(gen, texts[i], speed, speaker_ids[i], results[i]);
+            if (!error.isOk()) {
+                results[i].success = false;
+                results[i].error = error;
+            }
+        }
+        return tts::ErrorInfo::ok();
+    }
+
+    // -------------------------------------------------------------------------
+    // 合成 (缓存未命中时)
+    // -------------------------------------------------------------------------
+
+    /// 整段合成 (经批处理器或直接调用后端), 成功后写入缓存
+    tts::ErrorInfo synthesizeOnce(const RequestContext& ctx, const std::string& text,
+                                  const std::string& cache_key, tts::SynthesisResult& result) {
+        tts::ErrorInfo error = tts::ErrorInfo::ok();
+        if (needsSpeakerSwitch(ctx)) {
+            error = synthesizeSwitched(ctx.generation, text, ctx.speed, ctx.speaker_id, result);
+        } else if (ctx.generation->batcher) {
+            // 与并发请求合并为一批执行 (空闲时立即执行); 多说话人模型的不同说话人可同批
+            result = ctx.generation->batcher->submit(text, ctx.speaker_id, ctx.speed);
+            if (!result.success) {
+                error = result.error;
+            }
+        } else {
+            error = synthesizeDirect(ctx, text, result);
+        }
+
+        if (error.isOk() && audio_cache) {
+            audio_cache->insert(cache_key, result.audio);
+        }
+        return error;
+    }
+
+    /// 按租户公平调度的合成: 文本按句切分, 每句排队等待调度后经 synthesizeOnce 执行;
+    /// 未启用调度时直接整段合成
+    tts::ErrorInfo synthesizeScheduled(const std::string& tenant, const RequestContext& ctx,
+                                       const std::string& text, const std::string& cache_key,
+                                       tts::SynthesisResult& result) {
+        if (!scheduler) {
+            return synthesizeOnce(ctx, text, cache_key, result);
+        }
+
+        tts::FairScheduler::RequestScope request(*scheduler, tenant);
+        std::vector<std::string> sentences;
+        for (auto& sentence : tts::text::splitSentences(text)) {
+            if (!isBlankText(sentence)) {
+                sentences.push_back(std::move(sentence));
+            }
+        }
+        if (sentences.size() <= 1) {
+            tts::FairScheduler::SegmentScope segment(*scheduler, tenant,
+                                                     static_cast<double>(tts::text::utf8Length(text)));
+            auto error = synthesizeOnce(ctx, text, cache_key, result);
+            segment.setAudioMs(result.audio.getDurationMs());
+            return error;
+        }
+
+        // 句间插入 sentence_gap_ms 静音, 与流式合成一致
+        const auto& gen = ctx.generation;
+        result = tts::SynthesisResult();
+        result.audio.sample_rate = gen->sample_rate;
+        result.audio.is_final = true;
+        const size_t gap_samples = static_cast<size_t>(std::max(gen->config.sentence_gap_ms, 0)) *
+                                   static_cast<size_t>(std::max(gen->sample_rate, 0)) / 1000;
+        for (const auto& sentence : sentences) {
+            const std::string sentence_key = cacheKey(ctx, sentence);
+            tts::SynthesisResult part;
+            if (!audio_cache ||
+                audio_cache->lookup(sentence_key, part.audio) == tts::AudioCache::Source::MISS) {
+                tts::FairScheduler::SegmentScope segment(*scheduler, tenant,
+                                                         static_cast<double>(tts::text::utf8Length(sentence)));
+                auto error = synthesizeOnce(ctx, sentence, sentence_key, part);
+                segment.setAudioMs(part.audio.getDurationMs());
+                if (!error.isOk()) {
+                    return error;
+                }
+            }
+            if (part.audio.samples.empty()) {
+                continue;
+            }
+            if (!result.audio.samples.empty()) {
+                result.audio.samples.insert(result.audio.samples.end(), gap_samples, 0.0f);
+            }
+            result.audio.sample_rate = part.audio.sample_rate;
+            result.audio.samples.insert(result.audio.samples.end(),
+                                        part.audio.samples.begin(), part.audio.samples.end());
+        }
+
+        result.audio_duration_ms = result.audio.getDurationMs();
+        result.success = true;
+        if (audio_cache) {
+            audio_cache->insert(cache_key, result.audio);
+        }
+        return tts::ErrorInfo::ok();
+    }
+
+    /// 一组文本一次批量推理 (CallMany 的直接路径), 缓存命中的条目不进入推理;
+    /// 只有整批失败时返回错误, 单条失败记录在 results 中
+    tts::ErrorInfo synthesizeGroup(const RequestContext& ctx, const std::vector<std::string>& texts,
+                                   std::vector<tts::SynthesisResult>& results) {
+        results.assign(texts.size(), tts::SynthesisResult());
+        std::vector<std::string> keys(texts.size());
+        std::vector<std::string> miss_texts;
+        std::vector<size_t> miss_index;
+        for (size_t i = 0; i < texts.size(); ++i) {
+            keys[i] = cacheKey(ctx, texts[i]);
+            if (audio_cache &&
+                audio_cache->lookup(keys[i], results[i].audio) != tts::AudioCache::Source::MISS) {
+                results[i].audio_duration_ms = results[i].audio.getDurationMs();
+                results[i].success = true;
+            } else {
+                miss_texts.push_back(texts[i]);
+                miss_index.push_back(i);
+            }
+        }
+        if (miss_texts.empty()) {
+            return tts::ErrorInfo::ok();
+        }
+
+        std::vector<tts::SynthesisResult> synthesized;
+        auto error = synthesizeBatchOn(ctx.generation, miss_texts,
+                                       std::vector<int>(miss_texts.size(), ctx.speaker_id), ctx.speed,
+                                       synthesized);
+        if (!error.isOk()) {
+            return error;
+        }
+        for (size_t j = 0; j < miss_index.size() && j < synthesized.size(); ++j) {
+            const size_t i = miss_index[j];
+            results[i] = std::move(synthesized[j]);
+            if (results[i].success && audio_cache) {
+                audio_cache->insert(keys[i], results[i].audio);
+            }
+        }
+        return tts::ErrorInfo::ok();
+    }
+
+    /// 流式合成, 音频块依次交给 sink; 完整结束后把拼接的音频写入缓存
+    tts::ErrorInfo synthesizeStream(const RequestContext& ctx, const std::string& text,
+                                    const std::string& cache_key, tts::ITtsCallback& sink) {
+        auto lease = acquireBackend(ctx.generation);
+        if (!lease.owns_lock()) {
+            return tts::ErrorInfo::error(tts::ErrorCode::NOT_INITIALIZED,
+                                         "Failed to reload TTS backend");
+        }
+        // 快照之后 Set* 修改了语速或说话人: 按新设置合成, 但不写入旧设置的缓存键
+        const bool cacheable = lease.generation->config.speech_rate == ctx.speed &&
+                               lease.generation->config.speaker_id == ctx.speaker_id;
+
+        // 后端每解码完一块即输出, 不等待整句完成
+        ChunkCollector collector(&sink);
+        auto error = lease->synthesizeStreaming(text, collector);
+        if (error.isOk() && audio_cache && cacheable) {
+            audio_cache->insert(cache_key, collector.audio());
+        }
+        return error;
+    }
+
+    // -------------------------------------------------------------------------
+    // 长文档合成
+    // -------------------------------------------------------------------------
+    //
+    // 读取线程分块读入并分句, 放入有界队列 (合成跟不上时阻塞读取); 调用线程
+    // 每次取出至多 max_batch_size 句, 一次 synthesizeBatch 合成后按顺序写入 sink。
+    // 每句合成时才租用后端, 写盘期间不持有锁, 不阻塞空闲释放与热重载。
+
+    struct DocumentSegment {
+        std::string text;
+        uint64_t end_offset = 0;    // 句子结束位置 (输入中的字节偏移)
+    };
+
+    /// @param seeked 输入已定位到 start_offset (否则读取丢弃前 start_offset 字节)
+    DocumentProgress synthesizeDocument(const ReadFn& read_fn, bool seeked, AudioSink& sink,
+                                        const DocumentOptions& options) {
+        DocumentProgress progress;
+        progress.byte_offset = options.start_offset;
+        progress.audio_samples = options.start_audio_samples;
+
+        if (!initialized) {
+            progress.success = false;
+            progress.message = "Engine not initialized";
+            return progress;
+        }
+        if (!seeked && !discardInput(read_fn, options.start_offset)) {
+            progress.success = false;
+            progress.message = "Input is shorter than start_offset";
+            return progress;
+        }
+
+        {
+            auto lease = acquireBackend(current());
+            if (!lease.owns_lock()) {
+                progress.success = false;
+                progress.message = "Failed to reload TTS backend";
+                return progress;
+            }
+            progress.sample_rate = lease.generation->sample_rate;
+        }
+        if (!sink.Open(progress.sample_rate)) {
+            progress.success = false;
+            progress.message = "Failed to open audio sink";
+            return progress;
+        }
+
+        // 文档整体计为租户的一个在途请求, 每批句子参与公平调度
+        std::unique_ptr<tts::FairScheduler::RequestScope> tenant_request;
+        if (scheduler) {
+            tenant_request = std::make_unique<tts::FairScheduler::RequestScope>(*scheduler, options.tenant_id);
+        }
+
+        std::deque<DocumentSegment> queue;
+        std::mutex queue_mutex;
+        std::condition_variable queue_cv;
+        bool reader_done = false;
+        bool stop = false;
+        std::string read_error;
+
+        const size_t max_pending = static_cast<size_t>(std::max(options.max_pending_sentences, 1));
+        const size_t chunk_bytes = std::max<size_t>(options.read_chunk_bytes, 1);
+        const size_t max_sentence = std::max<size_t>(options.max_sentence_bytes, 64);
+
+        std::thread reader([&]() {
+            auto push = [&](std::string text, uint64_t end_offset) {
+                std::unique_lock<std::mutex> lock(queue_mutex);
+                queue_cv.wait(lock, [&] { return stop || queue.size() < max_pending; });
+                if (stop) {
+                    return false;
+                }
+                queue.push_back({std::move(text), end_offset});
+                queue_cv.notify_all();
+                return true;
+            };
+            std::string pending;
+            uint64_t pending_offset = options.start_offset;     // pending[0] 在输入中的位置
+            // 从 pending[begin] 起切出至多 max_sentence 字节的片段, 直到 [begin, end) 不超过 max_sentence
+            auto push_until = [&](size_t& begin, size_t end) {
+                while (end - begin > max_sentence) {
+                    size_t cut = findForcedSplit(pending, begin, max_sentence);
+                    if (!push(pending.substr(begin, cut - begin), pending_offset + cut)) {
+                        return false;
+                    }
+                    begin = cut;
+                }
+                return true;
+            };
+
+            std::vector<char> buffer(chunk_bytes);
+            bool eof = false;
+            bool ok = true;
+            while (ok && !eof) {
+                int64_t n = read_fn(buffer.data(), buffer.size());
+                if (n < 0) {
+                    std::lock_guard<std::mutex> lock(queue_mutex);
+                    read_error = "Failed to read input";
+                    break;
+                }
+                eof = n == 0;
+                pending.append(buffer.data(), static_cast<size_t>(n));
+
+                // 句子跨块时留在 pending 中, 等下一块补全
+                size_t begin = 0;
+                for (size_t end : tts::text::findSentenceEnds(pending, eof)) {
+                    ok = push_until(begin, end) &&
+                         push(pending.substr(begin, end - begin), pending_offset + end);
+                    begin = end;
+                    if (!ok) {
+                        break;
+                    }
+                }
+                // 迟迟没有句末标点的文本也要切开, pending 的长度有上限
+                ok = ok && push_until(begin, pending.size());
+                pending.erase(0, begin);
+                pending_offset += begin;
+            }
+
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            reader_done = true;
+            queue_cv.notify_all();
+        });
+
+        auto stop_reader = [&]() {
+            {
+                std::lock_guard<std::mutex> lock(queue_mutex);
+                stop = true;
+            }
+            queue_cv.notify_all();
+            reader.join();
+        };
+
+        auto fail = [&progress](const std::string& message) {
+            progress.success = false;
+            progress.message = message;
+        };
+
+        const size_t batch_size = static_cast<size_t>(std::max(config.max_batch_size, 1));
+        bool stopped = false;
+        try {
+            while (progress.success) {
+                std::vector<DocumentSegment> batch;
+                {
+                    std::unique_lock<std::mutex> lock(queue_mutex);
+                    queue_cv.wait(lock, [&] { return !queue.empty() || reader_done; });
+                    while (!queue.empty() && batch.size() < batch_size) {
+                        batch.push_back(std::move(queue.front()));
+                        queue.pop_front();
+                    }
+                    queue_cv.notify_all();
+                }
+                if (batch.empty()) {
+                    break;
+                }
+
+                // 只有空白的片段不合成, 只推进位置
+                std::vector<std::string> texts;
+                std::vector<size_t> text_index;
+                size_t batch_chars = 0;
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    if (!isBlankText(batch[i].text)) {
+                        texts.push_back(batch[i].text);
+                        text_index.push_back(i);
+                        batch_chars += tts::text::utf8Length(batch[i].text);
+                    }
+                }
+
+                std::vector<tts::SynthesisResult> results;
+                int gap_ms = 0;
+                if (!texts.empty()) {
+                    std::unique_ptr<tts::FairScheduler::SegmentScope> segment;
+                    if (scheduler) {
+                        segment = std::make_unique<tts::FairScheduler::SegmentScope>(
+                            *scheduler, options.tenant_id, static_cast<double>(batch_chars));
+                    }
+                    RequestScope scope(*this);
+                    auto lease = acquireBackend(current());
+                    if (!lease.owns_lock()) {
+                        fail("Failed to reload TTS backend");
+                        break;
+                    }
+                    if (lease.generation->sample_rate != progress.sample_rate) {
+                        fail("Sample rate changed during document synthesis");
+                        break;
+                    }
+                    gap_ms = lease.generation->config.sentence_gap_ms;
+                    auto error = lease->synthesizeBatch(texts, results);
+                    if (!error.isOk()) {
+                        fail(error.message);
+                        break;
+                    }
+                    if (segment) {
+                        int64_t batch_audio_ms = 0;
+                        for (const auto& result : results) {
+                            batch_audio_ms += result.audio.getDurationMs();
+                        }
+                        segment->setAudioMs(batch_audio_ms);
+                    }
+                }
+
+                // 句间静音放在句子之前 (文档开头除外), 续合成的音频与一次合成完全一致
+                const std::vector<float> gap(
+                    static_cast<size_t>(std::max(gap_ms, 0)) * progress.sample_rate / 1000, 0.0f);
+                size_t next_text = 0;
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    if (next_text < text_index.size() && text_index[next_text] == i) {
+                        const auto& result = results[next_text++];
+                        if (!result.success) {
+                            fail(result.error.message);
+                            break;
+                        }
+                        const auto& samples = result.audio.samples;
+                        if (!samples.empty()) {
+                            const bool with_gap = progress.audio_samples > 0 && !gap.empty();
+                            if ((with_gap && !sink.Write(gap.data(), gap.size())) ||
+                                !sink.Write(samples.data(), samples.size())) {
+                                fail("Failed to write audio sink");
+                                break;
+                            }
+                            progress.audio_samples += (with_gap ? gap.size() : 0) + samples.size();
+                        }
+                        ++progress.sentences;
+                    }
+                    progress.byte_offset = batch[i].end_offset;
+                }
+
+                if (progress.success && options.on_progress && !options.on_progress(progress)) {
+                    stopped = true;
+                    break;
+                }
+            }
+        } catch (...) {
+            stop_reader();
+            sink.Close();
+            throw;
+        }
+
+        stop_reader();
+        if (progress.success && !read_error.empty()) {
+            fail(read_error);
+        }
+        if (!sink.Close() && progress.success) {
+            fail("Failed to close audio sink");
+        }
+        progress.finished = progress.success && !stopped;
+        if (progress.finished && options.on_progress) {
+            options.on_progress(progress);
+        }
+        return progress;
+    }
+
+    // -------------------------------------------------------------------------
+    // 驻留状态切换
+    // -------------------------------------------------------------------------
+
+    /// 租用指定代的后端, 已卸载时先重新加载; 失败返回未持有锁的租约
+    BackendLease acquireBackend(const std::shared_ptr<Generation>& gen) {
+        while (true) {
+            BackendLease lease;
+            lease.generation = gen;
+            lease.lock = std::shared_lock<std::shared_mutex>(lease.generation->mutex);
+            if (lease.generation->backend) {
+                // 推理会重新填充 arena, 状态回到 RESIDENT 并重新开始空闲计时
+                if (residency.exchange(ResidencyState::RESIDENT) != ResidencyState::RESIDENT) {
+                    idle_cv.notify_all();
+                }
+                return lease;
+            }
+            lease.lock.unlock();
+            if (!reload(gen)) {
+                return BackendLease();
+            }
+        }
+    }
+
+    /// 重新加载已卸载的一代 (驻留恢复, 配置不变)
+    bool reload(const std::shared_ptr<Generation>& gen) {
+        std::unique_lock<std::shared_mutex> lock(gen->mutex);
+        if (gen->backend) {
+            return true;
+        }
+
+        auto start_time = std::chrono::steady_clock::now();
+        if (!loadBackend(*gen)) {
+            return false;
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time);
+        std::cout << "[TtsEngine] Backend reloaded in " << elapsed.count() << "ms" << std::endl;
+
+        residency.store(ResidencyState::RESIDENT);
+        idle_cv.notify_all();
+        return true;
+    }
+
+    void release(ResidencyState level) {
+        if (level == ResidencyState::RESIDENT) {
+            return;
+        }
+
+        auto gen = current();
+        std::unique_lock<std::shared_mutex> lock(gen->mutex);
+        auto& backend = gen->backend;
+        if (!backend) {
+            return;
+        }
+
+        if (level == ResidencyState::TRIMMED) {
+            if (residency.load() == ResidencyState::RESIDENT) {
+                backend->trimMemory();
+            }
+            releaseHeapToSystem();
+            residency.store(ResidencyState::TRIMMED);
+            return;
+        }
+
+        // 销毁整个后端对象: ORT 会话、分词器、词典、拼音数据一并释放
+        auto model_files = backend->getModelFiles();
+        backend->shutdown();
+        backend.reset();
+        dropPageCache(model_files);
+        releaseHeapToSystem();
+        residency.store(ResidencyState::UNLOADED);
+    }
+
+    // -------------------------------------------------------------------------
+    // 热重载
+    // -------------------------------------------------------------------------
+
+    bool reloadModel(const TtsConfig& new_config) {
+        std::lock_guard<std::mutex> reload_lock(reload_mutex);
+
+        TtsConfig next = new_config;
+        keepEngineSettings(config, next);
+
+        // 在调用线程上构建并预热, 期间请求继续使用当前代 (及其批处理器)
+        auto start_time = std::chrono::steady_clock::now();
+        auto next_generation = buildGeneration(next);
+        if (!next_generation) {
+            std::cerr << "[TtsEngine] Reload failed, keeping the current model" << std::endl;
+            return false;
+        }
+        if (config.batch_window_ms > 0) {
+            startBatcher(next_generation);
+        }
+
+        std::shared_ptr<Generation> old_generation;
+        {
+            std::lock_guard<std::mutex> lock(generation_mutex);
+            old_generation = std::move(generation);
+            generation = next_generation;
+        }
+        residency.store(ResidencyState::RESIDENT);
+        last_active_ms.store(steadyNowMs());
+        idle_cv.notify_all();
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time);
+        std::cout << "[TtsEngine] Model reloaded in " << elapsed.count() << "ms" << std::endl;
+
+        // 旧一代在最后一个在途请求释放租约时销毁 (没有在途请求时即在此处)
+        old_generation.reset();
+        releaseHeapToSystem();
+        return true;
+    }
+
+    /// 当前代加载时记录的模型文件是否已被替换 (大小或修改时间变化)
+    bool modelFilesChanged() const {
+        auto gen = current();
+        for (const auto& stamp : gen->model_files) {
+            if (!(stampModelFile(stamp.path) == stamp)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // -------------------------------------------------------------------------
+    // 空闲线程
+    // -------------------------------------------------------------------------
+
+    void startIdleThread() {
+        std::lock_guard<std::mutex> lock(idle_mutex);
+        if (idle_thread.joinable()) {
+            return;
+        }
+        idle_stop = false;
+        idle_thread = std::thread(&Impl::idleLoop, this);
+    }
+
+    void stopIdleThread() {
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex);
+            idle_stop = true;
+        }
+        idle_cv.notify_all();
+        if (idle_thread.joinable()) {
+            idle_thread.join();
+        }
+    }
+
+    void idleLoop() {
+        std::unique_lock<std::mutex> lock(idle_mutex);
+        while (!idle_stop) {
+            if (prewake_requested) {
+                prewake_requested = false;
+                lock.unlock();
+                reload(current());
+                lock.lock();
+                continue;
+            }
+
+            // 根据当前状态确定下一级释放目标
+            ResidencyState state = residency.load();
+            int64_t threshold_ms = 0;
+            ResidencyState target = state;
+            if (state == ResidencyState::RESIDENT && config.idle_trim_ms > 0) {
+                threshold_ms = config.idle_trim_ms;
+                target = ResidencyState::TRIMMED;
+            } else if (state != ResidencyState::UNLOADED && config.idle_unload_ms > 0) {
+                threshold_ms = config.idle_unload_ms;
+                target = ResidencyState::UNLOADED;
+            }
+
+            if (threshold_ms == 0) {
+                idle_cv.wait(lock);
+                continue;
+            }
+
+            int64_t idle_ms = steadyNowMs() - last_active_ms.load();
+            if (active_requests.load() > 0) {
+                idle_cv.wait_for(lock, std::chrono::milliseconds(threshold_ms));
+                continue;
+            }
+            if (idle_ms < threshold_ms) {
+                idle_cv.wait_for(lock, std::chrono::milliseconds(threshold_ms - idle_ms));
+                continue;
+            }
+
+            lock.unlock();
+            release(target);
+            lock.lock();
+        }
+    }
 };
 
 TtsEngine::TtsEngine(BackendType backend, const std::string& model_dir)
@@ -251,9 +1554,164 @@ TtsEngine::~TtsEngine() = default;
 
 std::shared_ptr<TtsEngineResult> TtsEngine::Call(const std::string& text,
                                                 const TtsConfig& config) {
-    auto result = std::make_shared<TtsEngineResult>();
+    return Call(text, -1);
+}
 
-    if (!impl_->initialized || !impl_->backend) {
+std::shared_ptr<TtsEngineResult> TtsEngine::Call(const std::string& text, int speaker_id) {
+    return CallAs(std::string(), text, speaker_id);
+}
+
+std::vector<std::shared_ptr<TtsEngineResult>> TtsEngine::CallMany(const std::vector<std::string>& texts,
+                                                                 int max_workers) {
+    std::vector<std::shared_ptr<TtsEngineResult>> results(texts.size());
+    CallMany(texts, [&results](size_t index, std::shared_ptr<TtsEngineResult> result) {
+        results[index] = std::move(result);
+    }, max_workers);
+    return results;
+}
+
+void TtsEngine::CallMany(const std::vector<std::string>& texts,
+                         const std::function<void(size_t, std::shared_ptr<TtsEngineResult>)>& on_result,
+                         int max_workers) {
+    if (texts.empty()) {
+        return;
+    }
+
+    std::mutex callback_mutex;
+    auto deliver = [&](size_t index, std::shared_ptr<TtsEngineResult> result) {
+        std::lock_guard<std::mutex> lock(callback_mutex);
+        on_result(index, std::move(result));
+    };
+    auto failed = [](const std::string& message) {
+        auto result = std::make_shared<TtsEngineResult>();
+        result->impl_->success = false;
+        result->impl_->message = message;
+        return result;
+    };
+
+    if (!impl_->initialized) {
+        for (size_t i = 0; i < texts.size(); ++i) {
+            deliver(i, failed("Engine not initialized"));
+        }
+        return;
+    }
+
+    // 批处理器或租户调度器会合并/排队并发请求, 逐条经 Call 提交即可;
+    // 否则按长度排序后分组, 组内长度相近, 填充浪费小
+    const bool batching = impl_->config.batch_window_ms > 0;
+    const bool direct = !batching && !impl_->scheduler;
+    std::vector<std::vector<size_t>> groups;
+    if (direct) {
+        std::vector<size_t> order(texts.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::vector<size_t> lengths(texts.size());
+        for (size_t i = 0; i < texts.size(); ++i) {
+            lengths[i] = tts::text::utf8Length(texts[i]);
+        }
+        std::stable_sort(order.begin(), order.end(),
+            [&lengths](size_t a, size_t b) { return lengths[a] < lengths[b]; });
+        const size_t group_size = static_cast<size_t>(std::max(impl_->config.max_batch_size, 1));
+        for (size_t begin = 0; begin < order.size(); begin += group_size) {
+            groups.emplace_back(order.begin() + begin,
+                                order.begin() + std::min(order.size(), begin + group_size));
+        }
+    } else {
+        for (size_t i = 0; i < texts.size(); ++i) {
+            groups.push_back({i});
+        }
+    }
+
+    int workers = max_workers > 0 ? max_workers
+                                  : (batching ? std::max(impl_->config.max_batch_size, 1) : 1);
+    workers = static_cast<int>(std::min<size_t>(static_cast<size_t>(workers), groups.size()));
+
+    // 所有分组使用同一份设置快照
+    const Impl::RequestContext ctx = impl_->requestContext();
+    std::atomic<size_t> next_group{0};
+    auto run_groups = [&]() {
+        for (size_t g = next_group.fetch_add(1); g < groups.size(); g = next_group.fetch_add(1)) {
+            const auto& group = groups[g];
+            if (!direct) {
+                deliver(group.front(), Call(texts[group.front()]));
+                continue;
+            }
+
+            auto start_time = std::chrono::high_resolution_clock::now();
+            std::vector<std::string> group_texts;
+            for (size_t i : group) {
+                group_texts.push_back(texts[i]);
+            }
+            std::vector<tts::SynthesisResult> group_results;
+            tts::ErrorInfo error = tts::ErrorInfo::ok();
+            {
+                Impl::RequestScope scope(*impl_);
+                error = impl_->synthesizeGroup(ctx, group_texts, group_results);
+            }
+            auto elapsed_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::high_resolution_clock::now() - start_time).count());
+
+            for (size_t j = 0; j < group.size(); ++j) {
+                if (!error.isOk()) {
+                    deliver(group[j], failed(error.message));
+                    continue;
+                }
+                auto& synthesis_result = group_results[j];
+                if (!synthesis_result.success) {
+                    deliver(group[j], failed(synthesis_result.error.message));
+                    continue;
+                }
+                auto result = std::make_shared<TtsEngineResult>();
+                result->impl_->audio_float = std::move(synthesis_result.audio.samples);
+                result->impl_->sample_rate = synthesis_result.audio.sample_rate;
+                result->impl_->duration_ms = static_cast<int>(synthesis_result.audio_duration_ms);
+                result->impl_->processing_time_ms = elapsed_ms;
+                result->impl_->success = true;
+                result->impl_->is_sentence_end = true;
+                deliver(group[j], std::move(result));
+            }
+        }
+    };
+
+    // 异常不能逃出工作线程 (std::terminate): 记录第一个异常, 停止分发新组, 汇合后在调用线程重新抛出
+    std::mutex error_mutex;
+    std::exception_ptr first_error;
+    auto work = [&]() {
+        try {
+            run_groups();
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!first_error) {
+                    first_error = std::current_exception();
+                }
+            }
+            next_group.store(groups.size());
+        }
+    };
+
+    std::vector<std::thread> threads;
+    try {
+        for (int i = 1; i < workers; ++i) {
+            threads.emplace_back(work);
+        }
+    } catch (const std::system_error&) {
+        // 无法创建更多线程时由已启动的线程与调用线程完成全部分组
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+std::shared_ptr<TtsEngineResult> TtsEngine::CallAs(const std::string& tenant_id, const std::string& text,
+                                                  int speaker_id) {
+    auto result = std::make_shared<TtsEngineResult>();
+    if (!impl_->initialized) {
         result->impl_->success = false;
         result->impl_->message = "Engine not initialized";
         return result;
@@ -261,8 +1719,52 @@ std::shared_ptr<TtsEngineResult> TtsEngine::Call(const std::string& text,
 
     auto start_time = std::chrono::high_resolution_clock::now();
 
+    // 缓存命中直接返回, 不占用后端
+    const Impl::RequestContext ctx = impl_->requestContext(speaker_id);
+    const std::string cache_key = Impl::cacheKey(ctx, text);
+    if (impl_->audio_cache) {
+        tts::AudioChunk cached;
+        if (impl_->audio_cache->lookup(cache_key, cached) != tts::AudioCache::Source::MISS) {
+            result->impl_->audio_float = std::move(cached.samples);
+            result->impl_->sample_rate = cached.sample_rate;
+            result->impl_->duration_ms = static_cast<int>(
+                result->impl_->audio_float.size() * 1000 / std::max(cached.sample_rate, 1));
+            result->impl_->processing_time_ms = static_cast<int>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::high_resolution_clock::now() - start_time).count());
+            result->impl_->success = true;
+            result->impl_->is_sentence_end = true;
+            return result;
+        }
+    }
+
+    Impl::RequestScope scope(*impl_);
+
     tts::SynthesisResult synthesis_result;
-    auto error = impl_->backend->synthesize(text, synthesis_result);
+    tts::ErrorInfo error = tts::ErrorInfo::ok();
+    if (impl_->config.coalesce_requests) {
+        // 相同文本的并发请求挂到同一次合成上, 只合成一次。
+        // 启用租户调度时合成按领头请求的租户排队计费, 只合并同一租户的请求,
+        // 否则其他租户的请求会绕过自己的配额与公平调度
+        std::string flight_key = cache_key;
+        if (impl_->scheduler) {
+            flight_key = std::to_string(tenant_id.size()) + ":" + tenant_id + "|" + cache_key;
+        }
+        ChunkCollector collector;
+        error = impl_->single_flight.run(flight_key, collector, [&](tts::ITtsCallback& sink) {
+            tts::SynthesisResult leader_result;
+            auto leader_error = impl_->synthesizeScheduled(tenant_id, ctx, text, cache_key, leader_result);
+            if (leader_error.isOk()) {
+                leader_result.audio.is_final = true;
+                sink.onAudioChunk(leader_result.audio);
+            }
+            return leader_error;
+        });
+        synthesis_result.audio = collector.audio();
+        synthesis_result.audio_duration_ms = synthesis_result.audio.getDurationMs();
+    } else {
+        error = impl_->synthesizeScheduled(tenant_id, ctx, text, cache_key, synthesis_result);
+    }
 
     auto end_time = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
@@ -294,21 +1796,53 @@ bool TtsEngine::CallToFile(const std::string& text, const std::string& file_path
 void TtsEngine::StreamingCall(const std::string& text,
     std::shared_ptr<TtsResultCallback> callback,
     const TtsConfig& config) {
-    if (callback) {
-        callback->OnOpen();
+    if (!callback) {
+        return;
     }
 
-    auto result = Call(text, config);
+    callback->OnOpen();
 
-    if (callback) {
-        if (result && result->IsSuccess()) {
-            callback->OnEvent(result);
+    if (!impl_->initialized) {
+        callback->OnError("Engine not initialized");
+        callback->OnClose();
+        return;
+    }
+
+    // 缓存命中时整段一次输出 (只命中此前流式合成的结果)
+    const Impl::RequestContext ctx = impl_->requestContext();
+    const std::string cache_key = Impl::cacheKey(ctx, text, Impl::SynthesisMode::STREAMING);
+    CallbackAdapter adapter(callback);
+    if (impl_->audio_cache) {
+        tts::AudioChunk cached;
+        if (impl_->audio_cache->lookup(cache_key, cached) != tts::AudioCache::Source::MISS) {
+            cached.is_final = true;
+            adapter.onAudioChunk(cached);
             callback->OnComplete();
+            callback->OnClose();
+            return;
+        }
+    }
+
+    tts::ErrorInfo error = tts::ErrorInfo::ok();
+    {
+        Impl::RequestScope scope(*impl_);
+        auto stream = [&](tts::ITtsCallback& sink) {
+            return impl_->synthesizeStream(ctx, text, cache_key, sink);
+        };
+        if (impl_->config.coalesce_requests) {
+            // 相同文本的并发请求共享一次合成, 每个订阅者按顺序收到全部音频块
+            error = impl_->single_flight.run(cache_key, adapter, stream);
         } else {
-            callback->OnError(result ? result->GetMessage() : "Synthesis failed");
+            error = stream(adapter);
         }
-        callback->OnClose();
     }
+
+    if (error.isOk()) {
+        callback->OnComplete();
+    } else {
+        callback->OnError(error.message);
+    }
+    callback->OnClose();
 }
 
 std::shared_ptr<TtsEngine::DuplexStream> TtsEngine::StartDuplexStream(
@@ -318,29 +1852,189 @@ std::shared_ptr<TtsEngine::DuplexStream> TtsEngine::StartDuplexStream(
     return nullptr;
 }
 
+DocumentProgress TtsEngine::SynthesizeStream(std::istream& input, AudioSink& sink,
+                                             const DocumentOptions& options) {
+    auto read_fn = [&input](char* buffer, size_t size) -> int64_t {
+        input.read(buffer, static_cast<std::streamsize>(size));
+        return input.bad() ? -1 : static_cast<int64_t>(input.gcount());
+    };
+    // 续合成: 可定位的流直接跳到 start_offset, 否则由 synthesizeDocument 读取丢弃
+    bool seeked = options.start_offset == 0;
+    if (!seeked) {
+        seeked = !input.seekg(static_cast<std::streamoff>(options.start_offset), std::ios::cur).fail();
+        if (!seeked) {
+            input.clear();
+        }
+    }
+    return impl_->synthesizeDocument(read_fn, seeked, sink, options);
+}
+
+DocumentProgress TtsEngine::SynthesizeStream(int fd, AudioSink& sink, const DocumentOptions& options) {
+    auto read_fn = [fd](char* buffer, size_t size) -> int64_t {
+        while (true) {
+            ssize_t n = ::read(fd, buffer, size);
+            if (n >= 0 || errno != EINTR) {
+                return static_cast<int64_t>(n);
+            }
+        }
+    };
+    // 管道与套接字不能 lseek, 读取丢弃
+    bool seeked = options.start_offset == 0 ||
+        lseek(fd, static_cast<off_t>(options.start_offset), SEEK_CUR) != static_cast<off_t>(-1);
+    return impl_->synthesizeDocument(read_fn, seeked, sink, options);
+}
+
 void TtsEngine::SetSpeed(float speed) {
-    impl_->config.speech_rate = speed;
-    if (impl_->backend) {
-        impl_->backend->setSpeed(speed);
+    auto gen = impl_->current();
+    if (!gen) {
+        return;
+    }
+    // 修改后端状态与配置, 需等待在途请求结束 (它们持有共享锁读取这些字段)
+    std::unique_lock<std::shared_mutex> lock(gen->mutex);
+    std::lock_guard<std::mutex> settings_lock(gen->settings_mutex);
+    gen->config.speech_rate = speed;
+    if (gen->backend) {
+        gen->backend->setSpeed(speed);
     }
 }
 
 void TtsEngine::SetSpeaker(int speaker_id) {
-    impl_->config.speaker_id = speaker_id;
-    if (impl_->backend) {
-        impl_->backend->setSpeaker(speaker_id);
+    auto gen = impl_->current();
+    if (!gen) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> lock(gen->mutex);
+    std::lock_guard<std::mutex> settings_lock(gen->settings_mutex);
+    gen->config.speaker_id = speaker_id;
+    if (gen->backend) {
+        gen->backend->setSpeaker(speaker_id);
     }
 }
 
 void TtsEngine::SetVolume(int volume) {
-    impl_->config.volume = volume;
-    if (impl_->backend) {
-        impl_->backend->setVolume(volume / 100.0f);
+    auto gen = impl_->current();
+    if (!gen) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> lock(gen->mutex);
+    std::lock_guard<std::mutex> settings_lock(gen->settings_mutex);
+    gen->config.volume = volume;
+    if (gen->backend) {
+        gen->backend->setVolume(volume / 100.0f);
     }
 }
 
 TtsConfig TtsEngine::GetConfig() const {
-    return impl_->config;
+    auto gen = impl_->current();
+    if (!gen) {
+        return impl_->config;
+    }
+    std::lock_guard<std::mutex> lock(gen->settings_mutex);
+    return gen->config;
+}
+
+ResidencyState TtsEngine::GetResidencyState() const {
+    return impl_->residency.load();
+}
+
+void TtsEngine::Prewake() {
+    if (!impl_->initialized) {
+        return;
+    }
+    impl_->last_active_ms.store(steadyNowMs());
+    if (impl_->residency.load() != ResidencyState::UNLOADED) {
+        return;
+    }
+
+    impl_->startIdleThread();
+    {
+        std::lock_guard<std::mutex> lock(impl_->idle_mutex);
+        impl_->prewake_requested = true;
+    }
+    impl_->idle_cv.notify_all();
+}
+
+void TtsEngine::ReleaseResources(ResidencyState level) {
+    if (!impl_->initialized) {
+        return;
+    }
+    impl_->release(level);
+    impl_->idle_cv.notify_all();
+}
+
+bool TtsEngine::Reload(const TtsConfig& config) {
+    if (!impl_->initialized) {
+        return false;
+    }
+    return impl_->reloadModel(config);
+}
+
+bool TtsEngine::TryReloadIfChanged() {
+    if (!impl_->initialized || !impl_->modelFilesChanged()) {
+        return false;
+    }
+    std::cout << "[TtsEngine] Model files changed, reloading" << std::endl;
+    return impl_->reloadModel(GetConfig());
+}
+
+PreloadProgress TtsEngine::GetPreloadProgress() const {
+    std::lock_guard<std::mutex> lock(impl_->preload_mutex);
+    return impl_->preload_progress;
+}
+
+ModelMemoryStats TtsEngine::GetModelMemoryStats() const {
+    ModelMemoryStats stats;
+    // 只读取统计, 已卸载时不触发重新加载
+    auto gen = impl_->current();
+    if (!gen) {
+        return stats;
+    }
+    std::shared_lock<std::shared_mutex> lock(gen->mutex);
+    if (!gen->backend) {
+        return stats;
+    }
+    tts::ModelMemoryStats backend_stats = gen->backend->getMemoryStats();
+    stats.mapped_bytes = backend_stats.mapped_bytes;
+    stats.resident_bytes = backend_stats.resident_bytes;
+    stats.locked_bytes = backend_stats.locked_bytes;
+    return stats;
+}
+
+void TtsEngine::SetTenantQuota(const std::string& tenant_id, const TenantQuota& quota) {
+    if (!impl_->scheduler) {
+        std::cerr << "[TtsEngine] SetTenantQuota ignored: tenant_scheduling disabled" << std::endl;
+        return;
+    }
+    tts::TenantLimits limits;
+    limits.weight = quota.weight;
+    limits.max_in_flight = quota.max_in_flight;
+    limits.audio_seconds_per_second = quota.audio_seconds_per_second;
+    limits.audio_burst_seconds = quota.audio_burst_seconds;
+    impl_->scheduler->setLimits(tenant_id, limits);
+}
+
+std::vector<TenantStats> TtsEngine::GetTenantStats() const {
+    std::vector<TenantStats> stats;
+    if (!impl_->scheduler) {
+        return stats;
+    }
+    for (const auto& counters : impl_->scheduler->stats()) {
+        TenantStats s;
+        s.tenant_id = counters.tenant;
+        s.weight = counters.weight;
+        s.in_flight = counters.in_flight;
+        s.waiting_requests = counters.waiting_requests;
+        s.queued_segments = counters.queued_segments;
+        s.throttled = counters.throttled;
+        s.requests = counters.requests;
+        s.segments = counters.segments;
+        s.audio_ms = counters.audio_ms;
+        s.busy_ms = counters.busy_ms;
+        s.wait_ms = counters.wait_ms;
+        s.max_wait_ms = counters.max_wait_ms;
+        stats.push_back(s);
+    }
+    return stats;
 }
 
 bool TtsEngine::IsInitialized() const {
@@ -348,28 +2042,28 @@ bool TtsEngine::IsInitialized() const {
 }
 
 std::string TtsEngine::GetEngineName() const {
-    if (impl_->backend) {
-        return impl_->backend->getName();
+    if (!impl_->initialized) {
+        return "Unknown";
     }
-    return "Unknown";
+    return impl_->current()->engine_name;
 }
 
 BackendType TtsEngine::GetBackendType() const {
-    return impl_->config.backend;
+    return GetConfig().backend;
 }
 
 int TtsEngine::GetNumSpeakers() const {
-    if (impl_->backend) {
-        return impl_->backend->getNumSpeakers();
+    if (!impl_->initialized) {
+        return 1;
     }
-    return 1;
+    return impl_->current()->num_speakers;
 }
 
 int TtsEngine::GetSampleRate() const {
-    if (impl_->backend) {
-        return impl_->backend->getSampleRate();
+    if (impl_->initialized && impl_->current()->sample_rate > 0) {
+        return impl_->current()->sample_rate;
     }
-    return impl_->config.sample_rate;
+    return GetConfig().sample_rate;
 }
 
 std::string TtsEngine::GetLastRequestId() const {
@@ -0,0 +1,231 @@
+#include "internal/tts_fair_scheduler.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace tts {
+
+// =============================================================================
+// 配额
+// =============================================================================
+
+FairScheduler::FairScheduler(int max_concurrent, std::chrono::milliseconds idle_ttl)
+    : max_concurrent_(std::max(max_concurrent, 1))
+    , idle_ttl_(idle_ttl)
+    , last_eviction_(Clock::now()) {}
+
+void FairScheduler::setLimits(const std::string& tenant, const TenantLimits& limits) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Tenant& t = tenantLocked(tenant);
+        t.configured = true;
+        t.limits = limits;
+        t.limits.weight = limits.weight > 0.0 ? limits.weight : 1.0;
+        t.tokens = std::min(t.tokens, t.limits.audio_burst_seconds);
+    }
+    // 放宽的配额可能让等待者立即可执行
+    cv_.notify_all();
+}
+
+FairScheduler::Tenant& FairScheduler::tenantLocked(const std::string& name) {
+    const auto now = Clock::now();
+    evictIdleLocked(now);
+
+    auto it = tenants_.find(name);
+    if (it != tenants_.end()) {
+        return it->second;
+    }
+    Tenant& t = tenants_[name];
+    t.tokens = t.limits.audio_burst_seconds;
+    t.refilled = now;
+    t.last_active = now;
+    t.finish_tag = virtual_time_;
+    t.counters.tenant = name;
+    return t;
+}
+
+void FairScheduler::evictIdleLocked(Clock::time_point now) {
+    if (now - last_eviction_ < idle_ttl_ / 4) {
+        return;
+    }
+    last_eviction_ = now;
+
+    // 有等待者、排队片段或执行中片段的租户仍被其他线程引用, 不能移除
+    for (auto it = tenants_.begin(); it != tenants_.end();) {
+        const Tenant& t = it->second;
+        const bool idle = !t.configured && t.queue.empty() && t.running == 0 &&
+                          t.counters.in_flight == 0 && t.counters.waiting_requests == 0;
+        if (idle && now - t.last_active >= idle_ttl_) {
+            it = tenants_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void FairScheduler::refillLocked(Tenant& tenant, Clock::time_point now) {
+    const double rate = tenant.limits.audio_seconds_per_second;
+    if (rate > 0.0) {
+        const double elapsed = std::chrono::duration<double>(now - tenant.refilled).count();
+        tenant.tokens = std::min(tenant.limits.audio_burst_seconds, tenant.tokens + elapsed * rate);
+    }
+    tenant.refilled = now;
+}
+
+std::vector<TenantCounters> FairScheduler::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<TenantCounters> result;
+    result.reserve(tenants_.size());
+    for (const auto& entry : tenants_) {
+        TenantCounters counters = entry.second.counters;
+        counters.weight = entry.second.limits.weight;
+        counters.queued_segments = static_cast<int>(entry.second.queue.size());
+        counters.throttled = entry.second.limits.audio_seconds_per_second > 0.0 &&
+                             entry.second.tokens < 0.0;
+        result.push_back(std::move(counters));
+    }
+    return result;
+}
+
+// =============================================================================
+// 请求准入
+// =============================================================================
+
+void FairScheduler::enterRequest(const std::string& tenant) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    Tenant& t = tenantLocked(tenant);
+    ++t.counters.waiting_requests;
+    cv_.wait(lock, [&t]() {
+        return t.limits.max_in_flight <= 0 || t.counters.in_flight < t.limits.max_in_flight;
+    });
+    --t.counters.waiting_requests;
+    ++t.counters.in_flight;
+}
+
+void FairScheduler::leaveRequest(const std::string& tenant) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Tenant& t = tenantLocked(tenant);
+        --t.counters.in_flight;
+        ++t.counters.requests;
+        t.last_active = Clock::now();
+    }
+    cv_.notify_all();
+}
+
+// =============================================================================
+// 片段调度
+// =============================================================================
+
+FairScheduler::Waiter* FairScheduler::pickLocked(Clock::time_point now, Clock::time_point& retry_at) {
+    Waiter* best = nullptr;
+    retry_at = Clock::time_point::max();
+    for (auto& entry : tenants_) {
+        Tenant& t = entry.second;
+        if (t.queue.empty()) {
+            continue;
+        }
+        refillLocked(t, now);
+        const double rate = t.limits.audio_seconds_per_second;
+        if (rate > 0.0 && t.tokens < 0.0) {
+            // 配额为负: 余额补回到 0 之前不调度该租户
+            auto wait = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(-t.tokens / rate));
+            retry_at = std::min(retry_at, now + wait + std::chrono::milliseconds(1));
+            continue;
+        }
+        Waiter* head = t.queue.front();
+        if (!best || head->start_tag < best->start_tag ||
+            (head->start_tag == best->start_tag && head->seq < best->seq)) {
+            best = head;
+        }
+    }
+    return best;
+}
+
+void FairScheduler::acquireSegment(const std::string& tenant, double cost) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto enqueued = Clock::now();
+    Tenant& t = tenantLocked(tenant);
+
+    Waiter waiter;
+    waiter.seq = next_seq_++;
+    waiter.start_tag = std::max(virtual_time_, t.finish_tag);
+    t.finish_tag = waiter.start_tag + std::max(cost, 1.0) / t.limits.weight;
+    t.queue.push_back(&waiter);
+
+    while (true) {
+        const auto now = Clock::now();
+        Clock::time_point retry_at;
+        if (running_ < max_concurrent_ && pickLocked(now, retry_at) == &waiter) {
+            break;
+        }
+        if (retry_at != Clock::time_point::max()) {
+            cv_.wait_until(lock, retry_at);
+        } else {
+            cv_.wait(lock);
+        }
+    }
+
+    t.queue.pop_front();
+    virtual_time_ = std::max(virtual_time_, waiter.start_tag);
+    ++running_;
+    ++t.running;
+
+    const auto wait_ms = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - enqueued).count());
+    t.counters.wait_ms += wait_ms;
+    t.counters.max_wait_ms = std::max(t.counters.max_wait_ms, wait_ms);
+
+    // 同租户的下一个片段可能已成为可执行的队首
+    cv_.notify_all();
+}
+
+void FairScheduler::releaseSegment(const std::string& tenant, int64_t audio_ms, int64_t busy_ms) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Tenant& t = tenantLocked(tenant);
+        const auto now = Clock::now();
+        --running_;
+        --t.running;
+        t.last_active = now;
+        refillLocked(t, now);
+        if (t.limits.audio_seconds_per_second > 0.0) {
+            t.tokens -= static_cast<double>(std::max<int64_t>(audio_ms, 0)) / 1000.0;
+        }
+        ++t.counters.segments;
+        t.counters.audio_ms += static_cast<uint64_t>(std::max<int64_t>(audio_ms, 0));
+        t.counters.busy_ms += static_cast<uint64_t>(std::max<int64_t>(busy_ms, 0));
+    }
+    cv_.notify_all();
+}
+
+// =============================================================================
+// 作用域
+// =============================================================================
+
+FairScheduler::RequestScope::RequestScope(FairScheduler& scheduler, const std::string& tenant)
+    : scheduler_(scheduler)
+    , tenant_(tenant) {
+    scheduler_.enterRequest(tenant_);
+}
+
+FairScheduler::RequestScope::~RequestScope() {
+    scheduler_.leaveRequest(tenant_);
+}
+
+FairScheduler::SegmentScope::SegmentScope(FairScheduler& scheduler, const std::string& tenant, double cost)
+    : scheduler_(scheduler)
+    , tenant_(tenant) {
+    scheduler_.acquireSegment(tenant_, cost);
+    start_ = std::chrono::steady_clock::now();
+}
+
+FairScheduler::SegmentScope::~SegmentScope() {
+    auto busy_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_).count();
+    scheduler_.releaseSegment(tenant_, audio_ms_, static_cast<int64_t>(busy_ms));
+}
+
+}  // namespace tts
@@ -0,0 +1,234 @@
+#include "internal/tts_model_memory.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+namespace tts {
+
+namespace {
+
+// 小于此大小的新增区域不跟踪 (一般是零散分配, 不是权重或 arena)
+constexpr size_t kMinRegionBytes = 2 * 1024 * 1024;
+
+struct Range {
+    uintptr_t begin;
+    uintptr_t end;
+};
+
+#if defined(__linux__)
+
+// 读取当前进程的私有可写匿名映射
+//
+// 与不可访问映射 (---p) 相邻的区域不计入: 线程栈下方是保护页, glibc 各线程的 malloc
+// 堆尾部是未启用的保留区。加载期间 ORT 创建线程池、其他线程首次 malloc 都会产生
+// 这类映射, 它们不是权重或 arena
+std::vector<Range> readAnonymousRanges() {
+    std::vector<Range> ranges;
+    std::vector<Range> guards;
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line)) {
+        std::istringstream iss(line);
+        std::string address, perms, offset, device, path;
+        uint64_t inode = 0;
+        iss >> address >> perms >> offset >> device >> inode >> path;
+        size_t dash = address.find('-');
+        if (inode != 0 || !path.empty() || perms.size() < 4 || dash == std::string::npos) {
+            continue;
+        }
+        Range range;
+        range.begin = static_cast<uintptr_t>(std::stoull(address.substr(0, dash), nullptr, 16));
+        range.end = static_cast<uintptr_t>(std::stoull(address.substr(dash + 1), nullptr, 16));
+        if (perms.compare(0, 3, "---") == 0) {
+            guards.push_back(range);
+        } else if (perms[0] == 'r' && perms[1] == 'w' && perms[3] == 'p') {
+            ranges.push_back(range);
+        }
+    }
+
+    auto adjacent_to_guard = [&guards](const Range& range) {
+        return std::any_of(guards.begin(), guards.end(), [&range](const Range& guard) {
+            return guard.end == range.begin || guard.begin == range.end;
+        });
+    };
+    ranges.erase(std::remove_if(ranges.begin(), ranges.end(), adjacent_to_guard), ranges.end());
+    std::sort(ranges.begin(), ranges.end(),
+              [](const Range& a, const Range& b) { return a.begin < b.begin; });
+    return ranges;
+}
+
+// 同一时刻只跟踪一个加载过程: 并发初始化的多个引擎不会把彼此的权重计入自己的区域
+std::mutex& trackMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// after 中不被 before 覆盖的部分 (相邻映射会被内核合并, 因此按区间相减而不是比较起始地址)
+std::vector<Range> subtractRanges(const std::vector<Range>& after, const std::vector<Range>& before) {
+    std::vector<Range> added;
+    for (const auto& range : after) {
+        uintptr_t cursor = range.begin;
+        for (const auto& old : before) {
+            if (old.end <= cursor || old.begin >= range.end) {
+                continue;
+            }
+            if (old.begin > cursor) {
+                added.push_back({cursor, old.begin});
+            }
+            cursor = std::max(cursor, old.end);
+            if (cursor >= range.end) {
+                break;
+            }
+        }
+        if (cursor < range.end) {
+            added.push_back({cursor, range.end});
+        }
+    }
+    return added;
+}
+
+#endif
+
+}  // namespace
+
+// =============================================================================
+// 构造
+// =============================================================================
+
+ModelMemory::ModelMemory(const ModelMemoryConfig& config)
+    : config_(config) {}
+
+void ModelMemory::reset(const ModelMemoryConfig& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_ = config;
+    regions_.clear();
+}
+
+// =============================================================================
+// 预读
+// =============================================================================
+
+void ModelMemory::prefetch(const std::vector<std::string>& files) const {
+#if defined(__linux__)
+    if (!config_.prefetch) {
+        return;
+    }
+    for (const auto& path : files) {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            continue;
+        }
+        posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        close(fd);
+    }
+#else
+    (void)files;
+#endif
+}
+
+// =============================================================================
+// 跟踪加载期间的分配
+// =============================================================================
+
+void ModelMemory::track(const std::function<void()>& load) {
+#if defined(__linux__)
+    // 未启用大页与锁定时也跟踪区域, 供 stats() 报告驻留情况
+    std::vector<Range> added;
+    {
+        std::lock_guard<std::mutex> track_lock(trackMutex());
+        std::vector<Range> before = readAnonymousRanges();
+        load();
+        added = subtractRanges(readAnonymousRanges(), before);
+    }
+
+    static std::atomic<bool> lock_warned{false};
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& range : added) {
+        size_t bytes = range.end - range.begin;
+        if (bytes < kMinRegionBytes) {
+            continue;
+        }
+        void* addr = reinterpret_cast<void*>(range.begin);
+
+        Region region;
+        region.begin = range.begin;
+        region.end = range.end;
+
+#if defined(MADV_HUGEPAGE)
+        if (config_.huge_pages) {
+            madvise(addr, bytes, MADV_HUGEPAGE);
+        }
+#endif
+        if (config_.lock) {
+            if (mlock(addr, bytes) == 0) {
+                region.locked = true;
+            } else if (!lock_warned.exchange(true)) {
+                std::cerr << "[ModelMemory] mlock failed: " << strerror(errno)
+                          << " (check RLIMIT_MEMLOCK), weights stay evictable" << std::endl;
+            }
+        }
+        regions_.push_back(region);
+    }
+#else
+    load();
+#endif
+}
+
+void ModelMemory::trackInference(bool shared_arena, const std::function<void()>& run) {
+    if (shared_arena) {
+        run();
+        return;
+    }
+    track(run);
+}
+
+// =============================================================================
+// 统计
+// =============================================================================
+
+ModelMemoryStats ModelMemory::stats() const {
+    ModelMemoryStats stats;
+#if defined(__linux__)
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<unsigned char> pages;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = regions_.begin();
+    while (it != regions_.end()) {
+        size_t bytes = it->end - it->begin;
+        pages.resize((bytes + page_size - 1) / page_size);
+        // 区域已被释放 (如 arena 收缩) 时 mincore 返回 ENOMEM, 不再跟踪
+        if (mincore(reinterpret_cast<void*>(it->begin), bytes, pages.data()) != 0) {
+            it = regions_.erase(it);
+            continue;
+        }
+
+        size_t resident_pages = 0;
+        for (unsigned char page : pages) {
+            resident_pages += page & 1;
+        }
+        stats.mapped_bytes += bytes;
+        stats.resident_bytes += resident_pages * page_size;
+        if (it->locked) {
+            stats.locked_bytes += bytes;
+        }
+        ++it;
+    }
+#endif
+    return stats;
+}
+
+}  // namespace tts
@@ -0,0 +1,197 @@
+#include "internal/tts_ort_env.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+namespace tts {
+
+namespace {
+
+// 创建 Ort::Env 时暂时抑制 stderr, 避免 ONNX schema 警告
+Ort::Env createQuietEnv() {
+    int stderr_fd = dup(STDERR_FILENO);
+    int devnull_fd = open("/dev/null", O_WRONLY);
+    dup2(devnull_fd, STDERR_FILENO);
+
+    struct Restore {
+        int stderr_fd;
+        int devnull_fd;
+        ~Restore() {
+            dup2(stderr_fd, STDERR_FILENO);
+            close(stderr_fd);
+            close(devnull_fd);
+        }
+    } restore{stderr_fd, devnull_fd};
+
+    return Ort::Env(ORT_LOGGING_LEVEL_WARNING, "EvoTTS");
+}
+
+std::string toLower(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return s;
+}
+
+// SpaceMIT EP 以独立库提供, 默认库名 (可用选项 library 覆盖)
+constexpr const char* kSpacemitLibrary = "libspacemit_ep.so";
+
+/// 向会话选项注册一个 EP, 无法加载时抛出 Ort::Exception
+void appendProvider(Ort::SessionOptions& options, const std::string& name,
+                    const std::map<std::string, std::string>& provider_options) {
+    if (name == "spacemit") {
+        // 加载 EP 库, 其余选项作为会话配置项传入
+        std::string library = kSpacemitLibrary;
+        for (const auto& [key, value] : provider_options) {
+            if (key == "library") {
+                library = value;
+            } else {
+                options.AddConfigEntry(key.c_str(), value.c_str());
+            }
+        }
+        options.RegisterCustomOpsLibrary(library.c_str());
+        return;
+    }
+
+    std::unordered_map<std::string, std::string> ort_options(provider_options.begin(), provider_options.end());
+    // ORT 通用注册接口使用 EP 的规范名称
+    static const std::unordered_map<std::string, std::string> kCanonicalNames = {
+        {"xnnpack", "XNNPACK"},
+        {"qnn", "QNN"},
+        {"snpe", "SNPE"},
+        {"openvino", "OpenVINO"},
+        {"azure", "AZURE"},
+    };
+    auto it = kCanonicalNames.find(name);
+    options.AppendExecutionProvider(it != kCanonicalNames.end() ? it->second : name, ort_options);
+}
+
+std::string joinNames(const std::vector<std::string>& names) {
+    std::string joined;
+    for (const auto& name : names) {
+        joined += name + " -> ";
+    }
+    return joined + "cpu";
+}
+
+}  // namespace
+
+// =============================================================================
+// 获取共享环境
+// =============================================================================
+
+std::shared_ptr<OrtEnvironment> OrtEnvironment::acquire(const OrtEnvConfig& config) {
+    static std::mutex mutex;
+    static std::weak_ptr<OrtEnvironment> instance;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto existing = instance.lock()) {
+        if (existing->config_.shared_allocator != config.shared_allocator ||
+            existing->config_.arena_max_bytes != config.arena_max_bytes) {
+            std::cout << "[OrtEnvironment] Reusing existing environment; "
+                      << "allocator settings of the first engine apply" << std::endl;
+        }
+        return existing;
+    }
+
+    std::shared_ptr<OrtEnvironment> created(new OrtEnvironment(config));
+    instance = created;
+    return created;
+}
+
+OrtEnvironment::OrtEnvironment(const OrtEnvConfig& config)
+    : env_(createQuietEnv())
+    , config_(config) {
+    if (!config_.shared_allocator) {
+        return;
+    }
+
+#if defined(__riscv) || defined(__riscv__)
+    // RISC-V: arena 存在对齐问题 (与会话级 DisableCpuMemArena 一致), 共享不带 arena 的分配器
+    Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeDefault);
+    env_.CreateAndRegisterAllocator(memory_info, nullptr);
+#else
+    // -1 表示使用 ORT 默认值 (扩展策略 kNextPowerOfTwo、初始块大小、死区上限)
+    Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+    Ort::ArenaCfg arena_cfg(config_.arena_max_bytes, -1, -1, -1);
+    env_.CreateAndRegisterAllocator(memory_info, arena_cfg);
+#endif
+}
+
+// =============================================================================
+// 会话配置
+// =============================================================================
+
+void OrtEnvironment::configureSession(Ort::SessionOptions& options, const std::string& log_id) const {
+    options.SetLogId(log_id.c_str());
+    if (config_.shared_allocator) {
+        options.AddConfigEntry("session.use_env_allocators", "1");
+        // 初始化器由会话自己的设备分配器分配: 权重随会话释放, 不占用共享 arena,
+        // 驻留控制也只作用于本会话的权重
+        options.AddConfigEntry("session.use_device_allocator_for_initializers", "1");
+    }
+}
+
+// =============================================================================
+// 按执行提供器创建会话
+// =============================================================================
+
+std::unique_ptr<Ort::Session> OrtEnvironment::createSession(const std::string& model_path,
+                                                            const Ort::SessionOptions& base_options,
+                                                            const ExecutionProviderConfig& providers,
+                                                            const std::string& log_id) const {
+    // CPU 是 ORT 的隐式兜底, 排在 cpu 之后的 EP 不会被使用
+    std::vector<std::string> chain;
+    for (const auto& provider : providers.providers) {
+        std::string name = toLower(provider);
+        if (name == "cpu") {
+            break;
+        }
+        if (std::find(chain.begin(), chain.end(), name) == chain.end()) {
+            chain.push_back(name);
+        }
+    }
+
+    static const std::map<std::string, std::string> kNoOptions;
+    size_t first = 0;
+    while (true) {
+        Ort::SessionOptions options = base_options.Clone();
+        configureSession(options, log_id);
+
+        std::vector<std::string> applied;
+        for (size_t i = first; i < chain.size(); ++i) {
+            auto opt_it = providers.options.find(chain[i]);
+            try {
+                appendProvider(options, chain[i], opt_it != providers.options.end() ? opt_it->second : kNoOptions);
+                applied.push_back(chain[i]);
+            } catch (const Ort::Exception& e) {
+                std::cerr << "[OrtEnvironment] " << log_id << ": execution provider '" << chain[i]
+                          << "' unavailable, skipped: " << e.what() << std::endl;
+            }
+        }
+
+        try {
+            auto session = std::make_unique<Ort::Session>(env_, model_path.c_str(), options);
+            if (!chain.empty()) {
+                std::cout << "[OrtEnvironment] " << log_id << ": execution providers "
+                          << joinNames(applied) << std::endl;
+            }
+            return session;
+        } catch (const Ort::Exception& e) {
+            if (applied.empty()) {
+                throw;
+            }
+            // 首选 EP 拒绝了模型 (或初始化失败), 去掉它后重试
+            std::cerr << "[OrtEnvironment] " << log_id << ": session creation with '" << applied.front()
+                      << "' failed, falling back: " << e.what() << std::endl;
+            first = static_cast<size_t>(std::find(chain.begin(), chain.end(), applied.front()) - chain.begin()) + 1;
+        }
+    }
+}
+
+}  // namespace tts
@@ -0,0 +1,159 @@
+#include "internal/tts_single_flight.hpp"
+
+#include <chrono>
+#include <exception>
+#include <utility>
+
+namespace tts {
+
+namespace {
+
+// follower 等待新音频块时轮询自身取消状态的间隔
+constexpr std::chrono::milliseconds kCancelPollInterval(20);
+
+ErrorInfo cancelledError() {
+    return ErrorInfo::error(ErrorCode::CANCELLED, "Cancelled");
+}
+
+}  // namespace
+
+// =============================================================================
+// LeaderSink - leader 线程中接收后端输出的音频块
+// =============================================================================
+
+class SingleFlight::LeaderSink : public ITtsCallback {
+public:
+    LeaderSink(Flight& flight, ITtsCallback& subscriber)
+        : flight_(flight), subscriber_(subscriber) {}
+
+    void onAudioChunk(const AudioChunk& chunk) override {
+        auto shared = std::make_shared<const AudioChunk>(chunk);
+        {
+            std::lock_guard<std::mutex> lock(flight_.mutex);
+            flight_.chunks.push_back(shared);
+        }
+        flight_.cv.notify_all();
+
+        if (!cancelled_) {
+            subscriber_.onAudioChunk(*shared);
+        }
+    }
+
+    bool isCancelled() const override {
+        bool newly_cancelled = !cancelled_ && subscriber_.isCancelled();
+        std::lock_guard<std::mutex> lock(flight_.mutex);
+        if (newly_cancelled) {
+            cancelled_ = true;
+            detachLocked(flight_);
+        }
+        return flight_.abandoned;
+    }
+
+    bool subscriberCancelled() const { return cancelled_; }
+
+private:
+    Flight& flight_;
+    ITtsCallback& subscriber_;
+    mutable bool cancelled_ = false;    // 只在 leader 线程中访问
+};
+
+// =============================================================================
+// 执行或加入
+// =============================================================================
+
+ErrorInfo SingleFlight::run(const std::string& key, ITtsCallback& subscriber, const Work& work) {
+    std::shared_ptr<Flight> flight;
+    bool leader = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = flights_.find(key);
+        if (it != flights_.end()) {
+            std::lock_guard<std::mutex> flight_lock(it->second->mutex);
+            // 已被所有订阅者放弃的合成即将中止, 不再加入
+            if (!it->second->abandoned) {
+                flight = it->second;
+                ++flight->active;
+            }
+        }
+        if (!flight) {
+            flight = std::make_shared<Flight>();
+            flights_[key] = flight;
+            leader = true;
+        }
+    }
+
+    return leader ? lead(key, flight, subscriber, work) : follow(flight, subscriber);
+}
+
+size_t SingleFlight::inflight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return flights_.size();
+}
+
+ErrorInfo SingleFlight::lead(const std::string& key, const std::shared_ptr<Flight>& flight,
+                             ITtsCallback& subscriber, const Work& work) {
+    LeaderSink sink(*flight, subscriber);
+    ErrorInfo error = ErrorInfo::ok();
+    try {
+        error = work(sink);
+    } catch (const std::exception& e) {
+        error = ErrorInfo::error(ErrorCode::SYNTHESIS_FAILED, std::string("Synthesis failed: ") + e.what());
+    }
+
+    // 先移出注册表再标记完成: 之后到达的相同请求开始新的合成 (或命中缓存)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = flights_.find(key);
+        if (it != flights_.end() && it->second == flight) {
+            flights_.erase(it);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(flight->mutex);
+        flight->done = true;
+        flight->error = error;
+    }
+    flight->cv.notify_all();
+
+    return sink.subscriberCancelled() ? cancelledError() : error;
+}
+
+ErrorInfo SingleFlight::follow(const std::shared_ptr<Flight>& flight, ITtsCallback& subscriber) {
+    size_t next = 0;
+    while (true) {
+        std::vector<std::shared_ptr<const AudioChunk>> pending;
+        bool done = false;
+        ErrorInfo error = ErrorInfo::ok();
+        {
+            std::unique_lock<std::mutex> lock(flight->mutex);
+            flight->cv.wait_for(lock, kCancelPollInterval, [&]() {
+                return flight->done || flight->chunks.size() > next;
+            });
+            pending.assign(flight->chunks.begin() + static_cast<std::ptrdiff_t>(next), flight->chunks.end());
+            next = flight->chunks.size();
+            done = flight->done;
+            error = flight->error;
+
+            if (!done && subscriber.isCancelled()) {
+                detachLocked(*flight);
+                return cancelledError();
+            }
+        }
+
+        // 回调在锁外执行, 慢订阅者不阻塞 leader 与其他订阅者
+        for (const auto& chunk : pending) {
+            subscriber.onAudioChunk(*chunk);
+        }
+        if (done) {
+            return error;
+        }
+    }
+}
+
+void SingleFlight::detachLocked(Flight& flight) {
+    if (--flight.active <= 0) {
+        flight.abandoned = true;
+    }
+}
+
+}  // namespace tts